@@ -64,15 +64,18 @@ void InsertionSort(int arr[], size_t size);
 /******************************************************************************/
 void CountingSort(int arr[], size_t size);
 
-/* Complexity: Time: O(d * (n + 10)) worst/avg/best | Space: O(n) | Stability: Stable */
+/* Complexity: Time: O(w * (n + 256)) worst/avg/best | Space: O(n) | Stability: Stable */
 /******************************************************************************/
 /* Description:  Sorts an array of integers using the Radix Sort algorithm.   */
-/* It processes the elements digit by digit, from least to most */
-/* significant, using a stable Counting Sort subroutine.        */
+/* It processes the elements a byte at a time, from least to    */
+/* most significant, with a stable counting pass per byte. All  */
+/* the counts come from one read of the array, and a byte that  */
+/* is the same in every element is skipped. ('w' is sizeof(int))*/
 /* Arguments:    arr - pointer to the array of integers to be sorted          */
 /* size - the number of elements in the array                   */
 /* Return value: None                                                         */
-/* Note:         Passing a size of 0 is safe and will return immediately.     */
+/* Note:         Negative numbers are sorted too. Wider keys and floats are   */
+/* in sort_typed.h.                                             */
 /******************************************************************************/
 void RadixSort(int arr[], size_t size);
 
@@ -99,26 +102,48 @@ int BinarySearch(int sorted_arr[], size_t size, int target);
 /******************************************************************************/
 int BinarySearchRecursive(int sorted_arr[], size_t size, int target);
 
-/* Complexity: Time: O(n log n) worst/avg/best | Space: O(n) | Stability: Stable */
-/******************************************************************************/
-/* Description:  Sorts an array using the recursive Merge Sort algorithm.     */
-/* It divides the array into halves, sorts them, and merges     */
-/* the sorted halves back together.                             */
+/* Complexity: Time: O(n log n) worst/avg, O(n) best | Space: O(n) | Stability: Stable */
+/******************************************************************************/
+/* Description:  Sorts an array using a natural Merge Sort, as TimSort does.  */
+/* It splits the array into the runs already sorted in it -     */
+/* reversing descending ones, and insertion sorting short ones  */
+/* up to a minimum size - and merges them in balanced pairs.    */
+/* A merge skips the ends of the runs that are in place, and    */
+/* once one run keeps winning it copies whole blocks of it,     */
+/* found by galloping, so nearly sorted input sorts in about    */
+/* linear time.                                                 */
 /* Arguments:    arr_to_sort - pointer to the array of integers to be sorted  */
 /* num_elements - the number of elements in the array           */
 /* Return value: Returns 0 on success, or 1 if a memory allocation fails.     */
+/* Note:         Allocates a single buffer of num_elements / 2 integers.      */
 /******************************************************************************/
 int MergeSort(int *arr_to_sort, size_t num_elements);
 
-/* Complexity: Time: O(n^2) worst, O(n log n) avg/best | Space: O(log n) avg | Stability: Unstable */
+/* Complexity: Time: O(n log n) worst/avg, O(n) best | Space: O(1) | Stability: Stable */
+/******************************************************************************/
+/* Description:  Same as MergeSort, but merges through the caller's buffer    */
+/* and allocates nothing, e.g. to reuse one buffer across calls.*/
+/* Arguments:    arr_to_sort - pointer to the array of integers to be sorted  */
+/* num_elements - the number of elements in the array           */
+/* scratch - buffer of at least num_elements / 2 integers       */
+/* Return value: None                                                         */
+/******************************************************************************/
+void MergeSortScratch(int *arr_to_sort, size_t num_elements, int *scratch);
+
+/* Complexity: Time: O(n log n) worst/avg, O(n) best | Space: O(log n) | Stability: Unstable */
 /******************************************************************************/
-/* Description:  Sorts an array of any data type using the Quick Sort         */
-/* algorithm. A random pivot is selected to partition the array.*/
+/* Description:  Sorts an array of any data type using a pattern-defeating    */
+/* quicksort. Pivots are a median of 3, or a median of medians  */
+/* on large ranges. Small ranges are insertion sorted, sorted   */
+/* and duplicate heavy inputs are finished early, and a heap    */
+/* sort takes over if the pivots keep splitting badly.          */
 /* Arguments:    base - pointer to the first element of the array             */
 /* nmemb - number of elements in the array                      */
 /* size - size in bytes of each element                         */
 /* compar - function pointer to compare two elements            */
 /* Return value: None                                                         */
+/* Note:         Elements whose size and address are multiples of a long are  */
+/* swapped a long at a time.                                    */
 /******************************************************************************/
 void Qsort(
     void *base, 
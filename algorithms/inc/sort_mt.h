@@ -0,0 +1,79 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Parallel Sorting
+
+Description:
+Multi-threaded versions of MergeSort and Qsort from sort.h, for arrays
+large enough to keep several cores busy.
+
+Both split the array recursively into tasks for a small pool of threads
+that lives for the duration of the call. The calling thread is one of the
+threads: while it waits for a task it runs queued ones, as does every
+thread waiting on the tasks it spawned, so no thread sits idle while there
+is work.
+
+ParallelMergeSort sorts the halves in parallel down to a grain size, and
+sorts the grains with MergeSortScratch. The merges are parallel too: the
+output of a merge is cut into equal pieces, and a binary search along each
+cut (merge path) finds the elements of both halves that land in the piece,
+so every piece merges on its own and the final merge does not run on a
+single thread. The halves are merged back and forth between the array and
+one buffer allocated up front, which is also the scratch of the grains, so
+nothing else is allocated and no level copies its result back.
+
+ParallelQsort partitions in parallel down to the grain size and sorts the
+grains with Qsort. A partition runs on one thread, so the first levels
+are serial and it scales less than ParallelMergeSort - but it needs no
+extra memory, and takes any element type.
+
+Link with -pthread (make TARGET=sort_mt AF=-pthread).
+*/
+
+#ifndef SORT_MT_HEADER
+#define SORT_MT_HEADER
+
+#include <stddef.h> /* size_t */
+
+/* Complexity: Time: O(n log n / p) worst/avg/best, p threads | Space: O(n) | Stability: Stable */
+/******************************************************************************/
+/* Description:  Sorts an array of integers in ascending order using a        */
+/* parallel merge sort, with parallel merges.                   */
+/* Arguments:    arr_to_sort - pointer to the array of integers to be sorted  */
+/* num_elements - the number of elements in the array           */
+/* num_threads - number of threads to sort with, including the  */
+/* calling thread. 0 means one per online CPU                   */
+/* Return value: Returns 0 on success, or 1 if a memory allocation fails.     */
+/* Note:         If fewer threads could be started than asked for, the sort   */
+/* runs on the ones that were.                                  */
+/******************************************************************************/
+int ParallelMergeSort(
+    int *arr_to_sort,
+    size_t num_elements,
+    size_t num_threads);
+
+/* Complexity: Time: O(n log n / p + n) avg, p threads, O(n log n) worst | Space: O(log n) | Stability: Unstable */
+/******************************************************************************/
+/* Description:  Sorts an array of any data type using a parallel quicksort.  */
+/* Pivots are a median of medians, and ranges that keep         */
+/* splitting badly are left to Qsort.                           */
+/* Arguments:    base - pointer to the first element of the array             */
+/* nmemb - number of elements in the array                      */
+/* size - size in bytes of each element                         */
+/* compar - function pointer to compare two elements, it is     */
+/* called from several threads at once                          */
+/* num_threads - number of threads to sort with, including the  */
+/* calling thread. 0 means one per online CPU                   */
+/* Return value: Returns 0 on success, or 1 if a memory allocation fails.     */
+/* Note:         If fewer threads could be started than asked for, the sort   */
+/* runs on the ones that were.                                  */
+/******************************************************************************/
+int ParallelQsort(
+    void *base,
+    size_t nmemb,
+    size_t size,
+    int (*compar)(const void *, const void *),
+    size_t num_threads);
+
+#endif /* SORT_MT_HEADER */
@@ -0,0 +1,483 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Type-Specialized Sorting
+
+Description:
+Qsort in sort.h sorts any type, so it calls compar through a pointer for
+every comparison and swaps elements without knowing their type.
+SORT_DEFINE stamps out the same pattern-defeating quicksort for a single
+element type, with the comparison given as a macro. The compiler sees both,
+inlines the comparison and moves elements as plain assignments.
+
+Usage, in a single source file:
+    #define U64_LESS(a, b) ((a) < (b))
+    SORT_DEFINE(U64, uint64_t, U64_LESS)
+
+defines void SortU64(uint64_t *arr, size_t nmemb). Other files see it
+through SORT_DECLARE(U64, uint64_t). The less macro takes two elements (not
+pointers) and must be a strict weak ordering. It may evaluate its arguments
+more than once.
+
+The sorts for the common types below are defined in sort_typed.c, next to
+radix sorts for the same types. Those sort by one key byte per pass and
+make no comparisons at all, which beats the quicksort on large arrays of
+integer or float keys. RADIX_DEFINE(name, type, key_type, key_of) stamps
+out such a sort, int RadixSort##name(type *arr, size_t nmemb), where key_of
+maps an element to an unsigned key_type that orders like the elements.
+Put static in front of it for a sort private to the file, as RadixSort in
+sort.c does.
+*/
+
+#ifndef SORT_TYPED_HEADER
+#define SORT_TYPED_HEADER
+
+#include <stddef.h> /* size_t */
+#include <stdint.h> /* uint64_t */
+#include <assert.h> /* assert, used by SORT_DEFINE */
+#include <stdlib.h> /* malloc, used by RADIX_DEFINE */
+#include <string.h> /* memcpy, used by RADIX_DEFINE */
+
+#include "sort_util.h" /* SortLog2, used by SORT_DEFINE */
+
+typedef struct sort_kv
+{
+    uint64_t key;
+    uint64_t value; /* e.g. a row index, moved along with the key */
+} sort_kv_t;
+
+#define SORT_DECLARE(name, type) \
+    void Sort##name(type *arr, size_t nmemb)
+
+/* Complexity: Time: O(n log n) worst/avg, O(n) best | Space: O(log n) | Stability: Unstable */
+/******************************************************************************/
+/* Description:  Sorts the int32_t / int64_t / uint64_t array in ascending    */
+/* order, with the algorithm of Qsort and an inlined <.         */
+/* Arguments:    arr - pointer to the array to be sorted                      */
+/* nmemb - the number of elements in the array                  */
+/* Return value: None                                                         */
+/******************************************************************************/
+SORT_DECLARE(Int32, int32_t);
+SORT_DECLARE(Int64, int64_t);
+SORT_DECLARE(Uint64, uint64_t);
+
+/* Complexity: Time: O(n log n) worst/avg, O(n) best | Space: O(log n) | Stability: Unstable */
+/******************************************************************************/
+/* Description:  Sorts the float / double array in ascending order.           */
+/* Arguments:    arr - pointer to the array to be sorted                      */
+/* nmemb - the number of elements in the array                  */
+/* Return value: None                                                         */
+/* Note:         NaNs compare greater than any number and end up last.        */
+/******************************************************************************/
+SORT_DECLARE(Float, float);
+SORT_DECLARE(Double, double);
+
+/* Complexity: Time: O(n log n) worst/avg, O(n) best | Space: O(log n) | Stability: Unstable */
+/******************************************************************************/
+/* Description:  Sorts key and value pairs in ascending order of key.         */
+/* Arguments:    arr - pointer to the array to be sorted                      */
+/* nmemb - the number of elements in the array                  */
+/* Return value: None                                                         */
+/* Note:         Pairs with equal keys end up in no particular order.         */
+/******************************************************************************/
+SORT_DECLARE(KeyValue, sort_kv_t);
+
+/* Complexity: Time: O(w * (n + 256)) worst/avg/best | Space: O(n) | Stability: Stable */
+/******************************************************************************/
+/* Description:  Sorts the array in ascending order with a byte-wise LSD      */
+/* radix sort, w passes for a w-byte key. One read of the array */
+/* counts the bytes for every pass, and a pass where all keys   */
+/* share the byte is skipped. Signed keys have their sign bit   */
+/* flipped and floats all of their bits if negative, so they    */
+/* order as unsigned integers.                                  */
+/* Arguments:    arr - pointer to the array to be sorted                      */
+/* nmemb - the number of elements in the array                  */
+/* Return value: Returns 0 on success, or 1 if a memory allocation fails.     */
+/* Note:         Float keys order -0 before +0 and NaNs with the sign bit     */
+/* clear last, those with it set first. KeyValue sorts by key   */
+/* and keeps pairs with equal keys in their original order, so  */
+/* (key, row index) pairs give a stable ordering of a column.   */
+/******************************************************************************/
+int RadixSortUint32(uint32_t *arr, size_t nmemb);
+int RadixSortInt32(int32_t *arr, size_t nmemb);
+int RadixSortUint64(uint64_t *arr, size_t nmemb);
+int RadixSortInt64(int64_t *arr, size_t nmemb);
+int RadixSortFloat(float *arr, size_t nmemb);
+int RadixSortDouble(double *arr, size_t nmemb);
+int RadixSortKeyValue(sort_kv_t *arr, size_t nmemb);
+
+/******************** IMPLEMENTATION ********************/
+#define SORT_INSERTION_THRESHOLD (24)
+#define SORT_NINTHER_THRESHOLD (128)
+#define SORT_PARTIAL_INSERTION_LIMIT (8)
+#define SORT_RADIX_BITS (8) /* radix sorts go a byte at a time */
+#define SORT_RADIX (1 << SORT_RADIX_BITS)
+#define SORT_RADIX_DIGIT(key, shift) (((key) >> (shift)) & (SORT_RADIX - 1))
+
+#define SORT_SWAP(type, a, b) \
+    do \
+    { \
+        type swap_tmp_ = *(a); \
+        *(a) = *(b); \
+        *(b) = swap_tmp_; \
+    } while (0)
+
+#define SORT_DEFINE(name, type, less) \
+static void SortInsertion##name(type *begin, type *end) \
+{ \
+    type *curr = NULL; \
+    type *sift = NULL; \
+    type elem; \
+    \
+    for (curr = begin + 1; curr < end; ++curr) \
+    { \
+        elem = *curr; \
+        for (sift = curr; sift > begin && less(elem, sift[-1]); --sift) \
+        { \
+            *sift = sift[-1]; \
+        } \
+        *sift = elem; \
+    } \
+} \
+\
+static int SortPartialInsertion##name(type *begin, type *end) \
+{ \
+    size_t moves = 0; \
+    type *curr = NULL; \
+    type *sift = NULL; \
+    type elem; \
+    \
+    for (curr = begin + 1; curr < end; ++curr) \
+    { \
+        elem = *curr; \
+        for (sift = curr; sift > begin && less(elem, sift[-1]); --sift) \
+        { \
+            *sift = sift[-1]; \
+        } \
+        *sift = elem; \
+        \
+        moves += (size_t)(curr - sift); \
+        if (moves > SORT_PARTIAL_INSERTION_LIMIT) \
+        { \
+            return (0); \
+        } \
+    } \
+    \
+    return (1); \
+} \
+\
+static void SortSiftDown##name(type *heap, size_t root, size_t nmemb) \
+{ \
+    size_t child = 2 * root + 1; \
+    \
+    while (child < nmemb) \
+    { \
+        if (child + 1 < nmemb && less(heap[child], heap[child + 1])) \
+        { \
+            ++child; \
+        } \
+        if (!less(heap[root], heap[child])) \
+        { \
+            return; \
+        } \
+        SORT_SWAP(type, heap + root, heap + child); \
+        root = child; \
+        child = 2 * root + 1; \
+    } \
+} \
+\
+static void SortHeap##name(type *begin, type *end) \
+{ \
+    size_t nmemb = (size_t)(end - begin); \
+    size_t i = 0; \
+    \
+    for (i = nmemb / 2; i > 0; --i) \
+    { \
+        SortSiftDown##name(begin, i - 1, nmemb); \
+    } \
+    for (i = nmemb - 1; i > 0; --i) \
+    { \
+        SORT_SWAP(type, begin, begin + i); \
+        SortSiftDown##name(begin, 0, i); \
+    } \
+} \
+\
+static void Sort3##name(type *a, type *b, type *c) \
+{ \
+    if (less(*b, *a)) \
+    { \
+        SORT_SWAP(type, a, b); \
+    } \
+    if (less(*c, *b)) \
+    { \
+        SORT_SWAP(type, b, c); \
+    } \
+    if (less(*b, *a)) \
+    { \
+        SORT_SWAP(type, a, b); \
+    } \
+} \
+\
+/* the pivot is at begin. returns where it lands */ \
+static type *SortPartitionRight##name(type *begin, type *end, \
+                                      int *already_partitioned) \
+{ \
+    type pivot = *begin; \
+    type *first = begin + 1; \
+    type *last = end - 1; \
+    \
+    while (first <= last && less(*first, pivot)) \
+    { \
+        ++first; \
+    } \
+    while (first <= last && !less(*last, pivot)) \
+    { \
+        --last; \
+    } \
+    \
+    *already_partitioned = (first > last); \
+    \
+    while (first < last) \
+    { \
+        SORT_SWAP(type, first, last); \
+        ++first; \
+        --last; \
+        while (less(*first, pivot)) \
+        { \
+            ++first; \
+        } \
+        while (!less(*last, pivot)) \
+        { \
+            --last; \
+        } \
+    } \
+    \
+    *begin = *last; \
+    *last = pivot; \
+    \
+    return (last); \
+} \
+\
+static type *SortPartitionLeft##name(type *begin, type *end) \
+{ \
+    type pivot = *begin; \
+    type *first = begin + 1; \
+    type *last = end - 1; \
+    \
+    while (first <= last && !less(pivot, *first)) \
+    { \
+        ++first; \
+    } \
+    while (first <= last && less(pivot, *last)) \
+    { \
+        --last; \
+    } \
+    \
+    while (first < last) \
+    { \
+        SORT_SWAP(type, first, last); \
+        ++first; \
+        --last; \
+        while (!less(pivot, *first)) \
+        { \
+            ++first; \
+        } \
+        while (less(pivot, *last)) \
+        { \
+            --last; \
+        } \
+    } \
+    \
+    *begin = *last; \
+    *last = pivot; \
+    \
+    return (last); \
+} \
+\
+static void SortBreakPatterns##name(type *begin, type *end, size_t nmemb) \
+{ \
+    size_t quarter = nmemb / 4; \
+    \
+    if (nmemb < SORT_INSERTION_THRESHOLD) \
+    { \
+        return; \
+    } \
+    SORT_SWAP(type, begin, begin + quarter); \
+    SORT_SWAP(type, end - 1, end - 1 - quarter); \
+    if (nmemb > SORT_NINTHER_THRESHOLD) \
+    { \
+        SORT_SWAP(type, begin + 1, begin + quarter + 1); \
+        SORT_SWAP(type, begin + 2, begin + quarter + 2); \
+        SORT_SWAP(type, end - 2, end - quarter - 2); \
+        SORT_SWAP(type, end - 3, end - quarter - 3); \
+    } \
+} \
+\
+static void SortLoop##name(type *begin, type *end, size_t bad_allowed, \
+                           int leftmost) \
+{ \
+    size_t nmemb = 0; \
+    size_t half = 0; \
+    size_t l_size = 0; \
+    size_t r_size = 0; \
+    type *pivot_pos = NULL; \
+    int already_partitioned = 0; \
+    \
+    for (;;) \
+    { \
+        nmemb = (size_t)(end - begin); \
+        if (nmemb < SORT_INSERTION_THRESHOLD) \
+        { \
+            SortInsertion##name(begin, end); \
+            return; \
+        } \
+        \
+        half = nmemb / 2; \
+        if (nmemb > SORT_NINTHER_THRESHOLD) \
+        { \
+            Sort3##name(begin, begin + half, end - 1); \
+            Sort3##name(begin + 1, begin + half - 1, end - 2); \
+            Sort3##name(begin + 2, begin + half + 1, end - 3); \
+            Sort3##name(begin + half - 1, begin + half, begin + half + 1); \
+            SORT_SWAP(type, begin, begin + half); \
+        } \
+        else \
+        { \
+            Sort3##name(begin + half, begin, end - 1); \
+        } \
+        \
+        if (!leftmost && !less(begin[-1], *begin)) \
+        { \
+            begin = SortPartitionLeft##name(begin, end) + 1; \
+            continue; \
+        } \
+        \
+        pivot_pos = SortPartitionRight##name(begin, end, \
+                                             &already_partitioned); \
+        l_size = (size_t)(pivot_pos - begin); \
+        r_size = nmemb - l_size - 1; \
+        \
+        if (l_size < nmemb / 8 || r_size < nmemb / 8) \
+        { \
+            if (0 == --bad_allowed) \
+            { \
+                SortHeap##name(begin, end); \
+                return; \
+            } \
+            SortBreakPatterns##name(begin, pivot_pos, l_size); \
+            SortBreakPatterns##name(pivot_pos + 1, end, r_size); \
+        } \
+        else if (already_partitioned && \
+                 SortPartialInsertion##name(begin, pivot_pos) && \
+                 SortPartialInsertion##name(pivot_pos + 1, end)) \
+        { \
+            return; \
+        } \
+        \
+        if (l_size < r_size) \
+        { \
+            SortLoop##name(begin, pivot_pos, bad_allowed, leftmost); \
+            begin = pivot_pos + 1; \
+            leftmost = 0; \
+        } \
+        else \
+        { \
+            SortLoop##name(pivot_pos + 1, end, bad_allowed, 0); \
+            end = pivot_pos; \
+        } \
+    } \
+} \
+\
+void Sort##name(type *arr, size_t nmemb) \
+{ \
+    assert(arr || 0 == nmemb); \
+    \
+    if (nmemb < 2) \
+    { \
+        return; \
+    } \
+    \
+    SortLoop##name(arr, arr + nmemb, SortLog2(nmemb), 1); \
+}
+
+/* byte-wise LSD radix sort of 'type' elements by a 'key_type' key. the */
+/* elements go back and forth between arr and one buffer               */
+#define RADIX_DEFINE(name, type, key_type, key_of) \
+int RadixSort##name(type *arr, size_t nmemb) \
+{ \
+    size_t counts[sizeof(key_type)][SORT_RADIX]; \
+    type *buffer = NULL; \
+    type *src = arr; \
+    type *dest = NULL; \
+    type *tmp = NULL; \
+    key_type key = 0; \
+    size_t shift = 0; \
+    size_t pass = 0; \
+    size_t sum = 0; \
+    size_t count = 0; \
+    size_t i = 0; \
+    \
+    assert(arr || 0 == nmemb); \
+    \
+    if (nmemb < 2) \
+    { \
+        return (0); \
+    } \
+    \
+    buffer = (type *)malloc(nmemb * sizeof(type)); \
+    if (NULL == buffer) \
+    { \
+        return (1); \
+    } \
+    dest = buffer; \
+    \
+    /* the counts of every pass in one read of the array */ \
+    memset(counts, 0, sizeof(counts)); \
+    for (i = 0; i < nmemb; ++i) \
+    { \
+        key = key_of(arr[i]); \
+        for (pass = 0; pass < sizeof(key_type); ++pass) \
+        { \
+            ++counts[pass][SORT_RADIX_DIGIT(key, pass * SORT_RADIX_BITS)]; \
+        } \
+    } \
+    \
+    for (pass = 0; pass < sizeof(key_type); ++pass) \
+    { \
+        shift = pass * SORT_RADIX_BITS; \
+        \
+        /* every key has the same byte here, the pass would move nothing */ \
+        if (nmemb == counts[pass][SORT_RADIX_DIGIT(key_of(arr[0]), shift)]) \
+        { \
+            continue; \
+        } \
+        \
+        for (i = 0, sum = 0; i < SORT_RADIX; ++i) \
+        { \
+            count = counts[pass][i]; \
+            counts[pass][i] = sum; \
+            sum += count; \
+        } \
+        \
+        for (i = 0; i < nmemb; ++i) \
+        { \
+            dest[counts[pass][SORT_RADIX_DIGIT(key_of(src[i]), shift)]++] = \
+                                                                src[i]; \
+        } \
+        \
+        tmp = src; \
+        src = dest; \
+        dest = tmp; \
+    } \
+    \
+    if (src != arr) \
+    { \
+        memcpy(arr, src, nmemb * sizeof(type)); \
+    } \
+    free(buffer); \
+    \
+    return (0); \
+}
+
+#endif /* SORT_TYPED_HEADER */
@@ -0,0 +1,108 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Sorting Helpers
+
+Description:
+The element helpers that the generic sorts share - Qsort in sort.h and
+ParallelQsort in sort_mt.h - and the log2 that bounds the unbalanced
+partitions of every quicksort, including the typed ones of sort_typed.h.
+A sort_elem_t describes the elements of one call: their size, how they
+compare, and the widest unit - long, int, short or char - they can be
+swapped in. The swap is a macro, so the sorts do not pay a call for it.
+*/
+
+#ifndef SORT_UTIL_HEADER
+#define SORT_UTIL_HEADER
+
+#include <stddef.h> /* size_t */
+
+typedef struct sort_elem
+{
+    size_t size;
+    int (*compar)(const void *, const void *);
+    size_t unit; /* sizeof the widest type dividing both size and base */
+} sort_elem_t;
+
+/* Complexity: O(1) compar call                                               */
+/******************************************************************************/
+/* Description:  Tells whether the element at a goes before the one at b.     */
+/* Arguments:    a, b - pointers to the elements                              */
+/* elem - the elements' description                             */
+/* Return value: Non-zero if compar puts a before b, 0 otherwise.             */
+/******************************************************************************/
+#define SORT_LESS(a, b, elem) ((elem)->compar((a), (b)) < 0)
+
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Describes the elements of an array to be sorted.             */
+/* Arguments:    elem - the description to fill in                            */
+/* base - pointer to the first element of the array             */
+/* size - size in bytes of each element                         */
+/* compar - function pointer to compare two elements            */
+/* Return value: None                                                         */
+/******************************************************************************/
+void SortElemInit(
+    sort_elem_t *elem,
+    const void *base,
+    size_t size,
+    int (*compar)(const void *, const void *));
+
+/* swaps the size bytes at a and b a unit_t at a time */
+#define SORT_SWAP_UNITS(a, b, size, unit_t)                                    \
+    do                                                                         \
+    {                                                                          \
+        unit_t *swap_a_ = (unit_t *)(a);                                       \
+        unit_t *swap_b_ = (unit_t *)(b);                                       \
+        unit_t *swap_end_ = (unit_t *)((a) + (size));                          \
+        unit_t swap_tmp_;                                                      \
+                                                                               \
+        while (swap_a_ < swap_end_)                                            \
+        {                                                                      \
+            swap_tmp_ = *swap_a_;                                              \
+            *swap_a_++ = *swap_b_;                                             \
+            *swap_b_++ = swap_tmp_;                                            \
+        }                                                                      \
+    } while (0)
+
+/* Complexity: O(size)                                                        */
+/******************************************************************************/
+/* Description:  Swaps two elements, in the unit that elem allows.            */
+/* Arguments:    a, b - pointers to the elements, each evaluated once         */
+/* elem - the elements' description                             */
+/* Return value: None                                                         */
+/******************************************************************************/
+#define SORT_SWAP_ELEM(a, b, elem)                                             \
+    do                                                                         \
+    {                                                                          \
+        char *sort_a_ = (a);                                                   \
+        char *sort_b_ = (b);                                                   \
+                                                                               \
+        if (sizeof(long) == (elem)->unit)                                      \
+        {                                                                      \
+            SORT_SWAP_UNITS(sort_a_, sort_b_, (elem)->size, long);             \
+        }                                                                      \
+        else if (sizeof(int) == (elem)->unit)                                  \
+        {                                                                      \
+            SORT_SWAP_UNITS(sort_a_, sort_b_, (elem)->size, int);              \
+        }                                                                      \
+        else if (sizeof(short) == (elem)->unit)                                \
+        {                                                                      \
+            SORT_SWAP_UNITS(sort_a_, sort_b_, (elem)->size, short);            \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+            SORT_SWAP_UNITS(sort_a_, sort_b_, (elem)->size, char);             \
+        }                                                                      \
+    } while (0)
+
+/* Complexity: O(log n)                                                       */
+/******************************************************************************/
+/* Description:  Computes floor(log2(n)).                                     */
+/* Arguments:    n - the number                                               */
+/* Return value: floor(log2(n)), or 0 if n is 0 or 1.                         */
+/******************************************************************************/
+size_t SortLog2(size_t n);
+
+#endif /* SORT_UTIL_HEADER */
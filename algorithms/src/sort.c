@@ -4,40 +4,109 @@ Date: Mar 31, 2024
 */
 
 #include <stdlib.h> /* malloc */
+#include <string.h> /* memcpy */
 #include <stdio.h> /* printf for helper function */
 #include <assert.h> /* assert */
-#include <time.h> /* srand */
+#include <limits.h> /* UINT_MAX */
+
+#include "sort.h" /* MergeSortScratch */
+#include "sort_typed.h" /* RADIX_DEFINE */
+#include "sort_util.h" /* sort_elem_t, SORT_SWAP_ELEM */
+
+#define INSERTION_SORT_THRESHOLD (24) /* ranges below it are insertion sorted */
+#define NINTHER_THRESHOLD (128) /* ranges above it take a median of medians */
+#define PARTIAL_INSERTION_LIMIT (8) /* moves before giving up on "sorted" */
+#define MIN_MERGE (64) /* Merge Sort insertion sorts arrays below it */
+#define MIN_GALLOP (7) /* wins in a row before a merge starts galloping */
+#define MAX_RUNS (85) /* pending runs, enough for 2^64 elements */
+
+/******************** TYPEDEFS ********************/
+typedef struct run
+{
+    size_t start;
+    size_t size;
+} run_t;
 
 /******************** FORWARD DECLARATIONS ********************/
 static void CopyArray(int *dest, int *src, size_t size);
-static void CountingSortForDigits(int arr[], size_t size, size_t digit);
-static int GetMaxDigits(int num);
+static unsigned int RadixKey(int num);
 static int BinarySearchRecursiveHelper(
     int sorted_arr[],
     size_t left,
     size_t right,
     int target
 );
-static int Merge(
-    int *left_arr, 
-    int *right_arr, 
-    size_t left_size, 
-    size_t right_size
+static size_t MinRunSize(size_t num_elements);
+static size_t CountRun(int *arr, size_t size);
+static void BinaryInsertionSort(int *arr, size_t size, size_t sorted);
+static void MergeCollapse(
+    int *arr,
+    run_t *runs,
+    size_t *num_runs,
+    int *scratch,
+    int force
 );
-static void GenericSwap(void *a, void *b, size_t elem_size);
-static size_t Partition(void *base, 
-size_t low, 
-size_t high, 
-size_t size, 
-int (*compar)(const void *, const void *)
+static void MergeAt(
+    int *arr,
+    run_t *runs,
+    size_t *num_runs,
+    size_t idx,
+    int *scratch
 );
-static void QsortRecursion(
-    void *base, 
-    size_t low, 
-    size_t high, 
-    size_t size, 
-    int (*compar)(const void *, const void *)
+static void MergeLow(
+    int *arr,
+    size_t left_size,
+    size_t right_size,
+    int *scratch
+);
+static void MergeHigh(
+    int *arr,
+    size_t left_size,
+    size_t right_size,
+    int *scratch
+);
+static size_t Gallop(
+    int key,
+    const int *arr,
+    size_t size,
+    size_t hint,
+    int past_equal
+);
+static int GoesBefore(int num, int key, int past_equal);
+static void PdqsortLoop(
+    char *begin, 
+    char *end, 
+    const sort_elem_t *ctx, 
+    size_t bad_allowed, 
+    int leftmost
+);
+static char *PartitionRight(
+    char *begin, 
+    char *end, 
+    const sort_elem_t *ctx, 
+    int *already_partitioned
+);
+static char *PartitionLeft(char *begin, char *end, const sort_elem_t *ctx);
+static void InsertionSortRange(char *begin, char *end, const sort_elem_t *ctx);
+static int PartialInsertionSort(
+    char *begin, 
+    char *end, 
+    const sort_elem_t *ctx
 );
+static void HeapSortRange(char *begin, char *end, const sort_elem_t *ctx);
+static void SiftDown(
+    char *heap, 
+    size_t root, 
+    size_t nmemb, 
+    const sort_elem_t *ctx
+);
+static void BreakPatterns(
+    char *begin, 
+    char *end, 
+    size_t nmemb, 
+    const sort_elem_t *ctx
+);
+static void Sort3(char *a, char *b, char *c, const sort_elem_t *ctx);
 
 
 /******************** FUNCTIONS ********************/
@@ -168,32 +237,13 @@ void CountingSort(int arr[], size_t size)
 }
 
 
+/* the same engine as the radix sorts of sort_typed.c */
+static RADIX_DEFINE(Int, int, unsigned int, RadixKey)
+
 void RadixSort(int arr[], size_t size)
 {
-    int max = 0;
-    size_t i = 0;
-    size_t digit = 1;
-    size_t max_digits = 1; 
-
-    if (0 == size) return; 
-    
-    max = arr[0];
-
-    for (i = 0; i < size; i++)
-    {
-        if (arr[i] > max)
-        {
-            max = arr[i];
-        }
-    }
-
-    max_digits = GetMaxDigits(max);
-
-    for (i = 0; i < max_digits; i++)
-    {
-        CountingSortForDigits(arr, size, digit);
-        digit *= 10;
-    }
+    /* a failed allocation leaves the array as it was */
+    (void)RadixSortInt(arr, size);
 }
 
 int BinarySearch(int sorted_arr[], size_t size, int target)
@@ -249,10 +299,7 @@ int BinarySearchRecursive(int sorted_arr[], size_t size, int target)
 
 int MergeSort(int *arr_to_sort, size_t num_elements)
 {
-    size_t left_size = 0;
-    size_t right_size = 0;
-    int *left_arr = NULL;
-    int *right_arr = NULL;
+    int *scratch = NULL;
 
     assert(arr_to_sort);
 
@@ -261,16 +308,54 @@ int MergeSort(int *arr_to_sort, size_t num_elements)
         return (0);
     }
 
-    left_size = num_elements / 2;
-    right_size = num_elements - left_size;
+    scratch = (int *)malloc(num_elements / 2 * sizeof(int));
+    if (NULL == scratch)
+    {
+        return (1);
+    }
+
+    MergeSortScratch(arr_to_sort, num_elements, scratch);
+
+    free(scratch);
+
+    return (0);
+}
+
+void MergeSortScratch(int *arr_to_sort, size_t num_elements, int *scratch)
+{
+    run_t runs[MAX_RUNS];
+    size_t num_runs = 0;
+    size_t min_run = MinRunSize(num_elements);
+    size_t start = 0;
+    size_t run_size = 0;
+    size_t forced_size = 0;
+
+    assert(arr_to_sort);
+    assert(scratch || num_elements < 2);
+
+    while (start < num_elements)
+    {
+        run_size = CountRun(arr_to_sort + start, num_elements - start);
+
+        /* a short run is stretched to min_run by insertion */
+        if (run_size < min_run)
+        {
+            forced_size = num_elements - start;
+            forced_size = forced_size < min_run ? forced_size : min_run;
+            BinaryInsertionSort(arr_to_sort + start, forced_size, run_size);
+            run_size = forced_size;
+        }
 
-    left_arr = arr_to_sort;
-    right_arr = arr_to_sort + left_size;
+        runs[num_runs].start = start;
+        runs[num_runs].size = run_size;
+        ++num_runs;
 
-    MergeSort(left_arr, left_size);
-    MergeSort(right_arr, right_size);
+        MergeCollapse(arr_to_sort, runs, &num_runs, scratch, 0);
 
-    return (Merge(left_arr, right_arr, left_size, right_size));
+        start += run_size;
+    }
+
+    MergeCollapse(arr_to_sort, runs, &num_runs, scratch, 1);
 }
 
 void Qsort(
@@ -279,147 +364,721 @@ void Qsort(
     size_t size, 
     int (*compar)(const void *, const void *))
 {
+    sort_elem_t ctx;
+
     assert(base);
     assert(nmemb);
     assert(size);
     assert(compar);
 
-    if (2 > nmemb)
+    SortElemInit(&ctx, base, size, compar);
+
+    /* log2(n) unbalanced partitions are allowed before heap sort takes over */
+    PdqsortLoop((char *)base, (char *)base + nmemb * size, &ctx, 
+                SortLog2(nmemb), 1);
+}
+
+
+/******************** HELPER FUNCS ********************/
+/* pattern-defeating quicksort: loops on the larger side, recurses on the
+   smaller one, and falls back to heap sort once the pivots keep failing */
+static void PdqsortLoop(
+    char *begin, 
+    char *end, 
+    const sort_elem_t *ctx, 
+    size_t bad_allowed, 
+    int leftmost)
+{
+    size_t size = ctx->size;
+    size_t nmemb = 0;
+    size_t half = 0;
+    size_t l_size = 0;
+    size_t r_size = 0;
+    char *pivot_pos = NULL;
+    int already_partitioned = 0;
+
+    for (;;)
     {
-        return;
+        nmemb = (size_t)(end - begin) / size;
+        if (nmemb < INSERTION_SORT_THRESHOLD)
+        {
+            InsertionSortRange(begin, end, ctx);
+            return;
+        }
+
+        /* the pivot ends up at begin */
+        half = nmemb / 2 * size;
+        if (nmemb > NINTHER_THRESHOLD)
+        {
+            Sort3(begin, begin + half, end - size, ctx);
+            Sort3(begin + size, begin + half - size, end - 2 * size, ctx);
+            Sort3(begin + 2 * size, begin + half + size, end - 3 * size, ctx);
+            Sort3(begin + half - size, begin + half, begin + half + size, ctx);
+            SORT_SWAP_ELEM(begin, begin + half, ctx);
+        }
+        else
+        {
+            Sort3(begin + half, begin, end - size, ctx);
+        }
+
+        /* no greater than the element before the range, so equal to it -  */
+        /* the run of equal elements goes left and needs no more sorting   */
+        if (!leftmost && !SORT_LESS(begin - size, begin, ctx))
+        {
+            begin = PartitionLeft(begin, end, ctx) + size;
+            continue;
+        }
+
+        pivot_pos = PartitionRight(begin, end, ctx, &already_partitioned);
+        l_size = (size_t)(pivot_pos - begin) / size;
+        r_size = nmemb - l_size - 1;
+
+        if (l_size < nmemb / 8 || r_size < nmemb / 8)
+        {
+            if (0 == --bad_allowed)
+            {
+                HeapSortRange(begin, end, ctx);
+                return;
+            }
+
+            BreakPatterns(begin, pivot_pos, l_size, ctx);
+            BreakPatterns(pivot_pos + size, end, r_size, ctx);
+        }
+        /* a balanced split with no swaps is likely sorted input */
+        else if (already_partitioned && 
+                 PartialInsertionSort(begin, pivot_pos, ctx) &&
+                 PartialInsertionSort(pivot_pos + size, end, ctx))
+        {
+            return;
+        }
+
+        /* recursing on the smaller side bounds the stack at O(log n) */
+        if (l_size < r_size)
+        {
+            PdqsortLoop(begin, pivot_pos, ctx, bad_allowed, leftmost);
+            begin = pivot_pos + size;
+            leftmost = 0;
+        }
+        else
+        {
+            PdqsortLoop(pivot_pos + size, end, ctx, bad_allowed, 0);
+            end = pivot_pos;
+        }
     }
+}
 
-    /* srand is used to choose a random pivot each run */
-    srand(time(NULL));
-    QsortRecursion(base, 0, nmemb - 1, size, compar);
+/* elements less than the pivot at begin go left, the rest right.        */
+/* returns where the pivot lands                                          */
+static char *PartitionRight(
+    char *begin, 
+    char *end, 
+    const sort_elem_t *ctx, 
+    int *already_partitioned)
+{
+    size_t size = ctx->size;
+    char *first = begin + size;
+    char *last = end - size;
+
+    while (first <= last && SORT_LESS(first, begin, ctx))
+    {
+        first += size;
+    }
+    while (first <= last && !SORT_LESS(last, begin, ctx))
+    {
+        last -= size;
+    }
+
+    *already_partitioned = (first > last);
+
+    /* after a swap each scan stops at the element the other one moved */
+    while (first < last)
+    {
+        SORT_SWAP_ELEM(first, last, ctx);
+        first += size;
+        last -= size;
+
+        while (SORT_LESS(first, begin, ctx))
+        {
+            first += size;
+        }
+        while (!SORT_LESS(last, begin, ctx))
+        {
+            last -= size;
+        }
+    }
+
+    SORT_SWAP_ELEM(begin, last, ctx);
+
+    return (last);
 }
 
+/* elements no greater than the pivot at begin go left, the rest right */
+static char *PartitionLeft(char *begin, char *end, const sort_elem_t *ctx)
+{
+    size_t size = ctx->size;
+    char *first = begin + size;
+    char *last = end - size;
 
-/******************** HELPER FUNCS ********************/
-static void QsortRecursion(
-    void *base, 
-    size_t low, 
-    size_t high, 
-    size_t size, 
-    int (*compar)(const void *, const void *))
+    while (first <= last && !SORT_LESS(begin, first, ctx))
+    {
+        first += size;
+    }
+    while (first <= last && SORT_LESS(begin, last, ctx))
+    {
+        last -= size;
+    }
+
+    while (first < last)
+    {
+        SORT_SWAP_ELEM(first, last, ctx);
+        first += size;
+        last -= size;
+
+        while (!SORT_LESS(begin, first, ctx))
+        {
+            first += size;
+        }
+        while (SORT_LESS(begin, last, ctx))
+        {
+            last -= size;
+        }
+    }
+
+    SORT_SWAP_ELEM(begin, last, ctx);
+
+    return (last);
+}
+
+static void InsertionSortRange(char *begin, char *end, const sort_elem_t *ctx)
 {
-    if (low < high)
+    size_t size = ctx->size;
+    char *curr = NULL;
+    char *sift = NULL;
+
+    for (curr = begin + size; curr < end; curr += size)
     {
-        size_t pivot_index = Partition(base, low, high, size, compar);
-        
-        if (pivot_index > 0)
+        for (sift = curr; sift > begin && SORT_LESS(sift, sift - size, ctx); 
+             sift -= size)
         {
-            QsortRecursion(base, low, pivot_index - 1, size, compar);
+            SORT_SWAP_ELEM(sift, sift - size, ctx);
         }
-        
-        QsortRecursion(base, pivot_index + 1, high, size, compar);
     }
 }
 
-static size_t Partition(void *base, size_t low, size_t high, size_t size, int (*compar)(const void *, const void *))
+/* insertion sort that gives up after a few moves, returns 1 if it sorted */
+static int PartialInsertionSort(
+    char *begin, 
+    char *end, 
+    const sort_elem_t *ctx)
 {
-    size_t pivot_index = 0;
+    size_t size = ctx->size;
+    size_t moves = 0;
+    char *curr = NULL;
+    char *sift = NULL;
+
+    for (curr = begin + size; curr < end; curr += size)
+    {
+        for (sift = curr; sift > begin && SORT_LESS(sift, sift - size, ctx); 
+             sift -= size)
+        {
+            SORT_SWAP_ELEM(sift, sift - size, ctx);
+            ++moves;
+        }
+
+        if (moves > PARTIAL_INSERTION_LIMIT)
+        {
+            return (0);
+        }
+    }
+
+    return (1);
+}
+
+static void HeapSortRange(char *begin, char *end, const sort_elem_t *ctx)
+{
+    size_t nmemb = (size_t)(end - begin) / ctx->size;
     size_t i = 0;
-    size_t j = 0;
-    void *pivot_value = NULL;
 
-    /* choose a random pivot between low and high inclusive*/
-    pivot_index = low + (rand() % (high - low));
+    for (i = nmemb / 2; i > 0; --i)
+    {
+        SiftDown(begin, i - 1, nmemb, ctx);
+    }
 
-    /* if pivot index isn't the last element, swap with last elem. */
-    if (pivot_index != high)
+    for (i = nmemb - 1; i > 0; --i)
     {
-        GenericSwap(((char *)base + (pivot_index * size)), 
-                    ((char *)base + (high * size)), size);
+        SORT_SWAP_ELEM(begin, begin + i * ctx->size, ctx);
+        SiftDown(begin, 0, i, ctx);
     }
-    
-    pivot_value = (char *)base + (high * size);
-    i = low;
+}
+
+static void SiftDown(
+    char *heap, 
+    size_t root, 
+    size_t nmemb, 
+    const sort_elem_t *ctx)
+{
+    size_t size = ctx->size;
+    size_t child = 2 * root + 1;
 
-    /* go over array and sort it compared to pivot value */
-    for (j = low; j < high; j++)
+    while (child < nmemb)
     {
-        if (compar((char *)base + (j * size), pivot_value) <= 0)
+        if (child + 1 < nmemb && 
+            SORT_LESS(heap + child * size, heap + (child + 1) * size, ctx))
         {
-            GenericSwap(((char *)base + (i * size)), ((char *)base + (j * size)), size);
-            i++;
+            ++child;
         }
+
+        if (!SORT_LESS(heap + root * size, heap + child * size, ctx))
+        {
+            return;
+        }
+
+        SORT_SWAP_ELEM(heap + root * size, heap + child * size, ctx);
+        root = child;
+        child = 2 * root + 1;
+    }
+}
+
+/* swaps a few elements after an unbalanced partition, so an input built */
+/* against the pivot choice does not keep producing one                  */
+static void BreakPatterns(
+    char *begin, 
+    char *end, 
+    size_t nmemb, 
+    const sort_elem_t *ctx)
+{
+    size_t size = ctx->size;
+    size_t quarter = nmemb / 4 * size;
+
+    if (nmemb < INSERTION_SORT_THRESHOLD)
+    {
+        return;
+    }
+
+    SORT_SWAP_ELEM(begin, begin + quarter, ctx);
+    SORT_SWAP_ELEM(end - size, end - size - quarter, ctx);
+
+    if (nmemb > NINTHER_THRESHOLD)
+    {
+        SORT_SWAP_ELEM(begin + size, begin + quarter + size, ctx);
+        SORT_SWAP_ELEM(begin + 2 * size, begin + quarter + 2 * size, ctx);
+        SORT_SWAP_ELEM(end - 2 * size, end - quarter - 2 * size, ctx);
+        SORT_SWAP_ELEM(end - 3 * size, end - quarter - 3 * size, ctx);
+    }
+}
+
+/* leaves the median of the three in b */
+static void Sort3(char *a, char *b, char *c, const sort_elem_t *ctx)
+{
+    if (SORT_LESS(b, a, ctx))
+    {
+        SORT_SWAP_ELEM(a, b, ctx);
+    }
+    if (SORT_LESS(c, b, ctx))
+    {
+        SORT_SWAP_ELEM(b, c, ctx);
+    }
+    if (SORT_LESS(b, a, ctx))
+    {
+        SORT_SWAP_ELEM(a, b, ctx);
     }
+}
+
+/* the run ends below MIN_MERGE, and above it a bit over a power of two */
+/* part of num_elements, so the runs merge in balanced pairs             */
+static size_t MinRunSize(size_t num_elements)
+{
+    size_t low_bits = 0;
 
-    /* place pivot value in correct spot and return it's index */
-    GenericSwap(((char *)base + (i * size)), ((char *)base + (high * size)), size);
-    return i;
+    while (num_elements >= MIN_MERGE)
+    {
+        low_bits |= num_elements & 1;
+        num_elements >>= 1;
+    }
+
+    return (num_elements + low_bits);
 }
 
-static void GenericSwap(void *a, void *b, size_t elem_size)
+/* the size of the sorted run arr starts with, a descending one is reversed */
+static size_t CountRun(int *arr, size_t size)
 {
-    char temp = '\0';
+    size_t end = 1;
     size_t i = 0;
+    int temp = 0;
 
-    assert(a);
-    assert(b);
-    assert(elem_size);
+    if (size < 2)
+    {
+        return (size);
+    }
 
-    for (i = 0; i < elem_size; i++)
+    if (arr[1] < arr[0])
     {
-        temp = *((char *)a + i);
-        *((char *)a + i) = *((char *)b + i);
-        *((char *)b + i) = temp;
+        /* strictly descending, or reversing it would reorder equal ones */
+        while (end < size && arr[end] < arr[end - 1])
+        {
+            ++end;
+        }
+
+        for (i = 0; i < end / 2; ++i)
+        {
+            temp = arr[i];
+            arr[i] = arr[end - 1 - i];
+            arr[end - 1 - i] = temp;
+        }
+    }
+    else
+    {
+        while (end < size && arr[end] >= arr[end - 1])
+        {
+            ++end;
+        }
     }
+
+    return (end);
 }
 
-static int Merge(
-    int *left_arr, 
-    int *right_arr, 
-    size_t left_size, 
-    size_t right_size) 
+/* the first 'sorted' elements are sorted already */
+static void BinaryInsertionSort(int *arr, size_t size, size_t sorted)
 {
     size_t i = 0;
-    size_t j = 0;
-    size_t k = 0;
+    size_t low = 0;
+    size_t high = 0;
+    size_t mid = 0;
+    int key = 0;
 
-    int *merged_arr = (int *)malloc((left_size + right_size) * sizeof(int));
-    if (NULL == merged_arr)
+    for (i = (0 == sorted) ? 1 : sorted; i < size; ++i)
     {
-        return (1);
+        key = arr[i];
+        low = 0;
+        high = i;
+
+        /* after the equal ones, to stay stable */
+        while (low < high)
+        {
+            mid = low + (high - low) / 2;
+            if (key < arr[mid])
+            {
+                high = mid;
+            }
+            else
+            {
+                low = mid + 1;
+            }
+        }
+
+        memmove(arr + low + 1, arr + low, (i - low) * sizeof(int));
+        arr[low] = key;
     }
+}
+
+/* merges until every pending run is longer than the next two together, */
+/* so merges stay balanced - or, when forced, down to a single run      */
+static void MergeCollapse(
+    int *arr,
+    run_t *runs,
+    size_t *num_runs,
+    int *scratch,
+    int force)
+{
+    size_t idx = 0;
 
-    while (i < left_size && j < right_size) 
+    while (*num_runs > 1)
     {
-        if (left_arr[i] <= right_arr[j]) 
+        idx = *num_runs - 2;
+
+        if (force)
+        {
+            if (idx > 0 && runs[idx - 1].size < runs[idx + 1].size)
+            {
+                --idx;
+            }
+        }
+        else if ((idx > 0 && 
+                  runs[idx - 1].size <= runs[idx].size + runs[idx + 1].size) ||
+                 (idx > 1 &&
+                  runs[idx - 2].size <= runs[idx - 1].size + runs[idx].size))
+        {
+            if (runs[idx - 1].size < runs[idx + 1].size)
+            {
+                --idx;
+            }
+        }
+        else if (runs[idx].size > runs[idx + 1].size)
         {
-            merged_arr[k] = left_arr[i];
-            i++;
-        } else {
-            merged_arr[k] = right_arr[j];
-            j++;
+            break;
         }
-        k++;
+
+        MergeAt(arr, runs, num_runs, idx, scratch);
     }
+}
 
-    while (i < left_size) 
+/* merges run idx with run idx + 1 */
+static void MergeAt(
+    int *arr,
+    run_t *runs,
+    size_t *num_runs,
+    size_t idx,
+    int *scratch)
+{
+    int *left = arr + runs[idx].start;
+    int *right = arr + runs[idx + 1].start;
+    size_t left_size = runs[idx].size;
+    size_t right_size = runs[idx + 1].size;
+    size_t in_place = 0;
+
+    runs[idx].size += right_size;
+    if (idx + 3 == *num_runs)
     {
-        merged_arr[k] = left_arr[i];
-        i++;
-        k++;
+        runs[idx + 1] = runs[idx + 2];
     }
+    --*num_runs;
 
-    while (j < right_size) 
+    /* left elements no larger than the first right one are in place */
+    in_place = Gallop(right[0], left, left_size, 0, 1);
+    left += in_place;
+    left_size -= in_place;
+    if (0 == left_size)
     {
-        merged_arr[k] = right_arr[j];
-        j++;
-        k++;
+        return;
     }
 
-    for (i = 0; i < left_size; i++)
-        left_arr[i] = merged_arr[i];
+    /* and so are right elements no smaller than the last left one */
+    right_size = Gallop(left[left_size - 1], right, right_size, 
+                                                        right_size - 1, 0);
+    if (0 == right_size)
+    {
+        return;
+    }
 
-    for (j = 0; j < right_size; j++)
-        left_arr[left_size + j] = merged_arr[left_size + j];
+    /* the smaller run goes to scratch, so it needs half the array at most */
+    if (left_size <= right_size)
+    {
+        MergeLow(left, left_size, right_size, scratch);
+    }
+    else
+    {
+        MergeHigh(left, left_size, right_size, scratch);
+    }
+}
+
+/* copies the left run to scratch and merges forward, from the start */
+static void MergeLow(
+    int *arr,
+    size_t left_size,
+    size_t right_size,
+    int *scratch)
+{
+    int *right = arr + left_size;
+    size_t i = 0;
+    size_t j = 0;
+    size_t dest = 0;
+    size_t left_wins = 0;
+    size_t right_wins = 0;
+    size_t count = 0;
 
-    free(merged_arr);
+    memcpy(scratch, arr, left_size * sizeof(int));
 
-    return (0);
+    while (i < left_size && j < right_size)
+    {
+        /* one at a time, until one run keeps winning */
+        left_wins = 0;
+        right_wins = 0;
+        while (i < left_size && j < right_size && 
+               left_wins < MIN_GALLOP && right_wins < MIN_GALLOP)
+        {
+            if (right[j] < scratch[i])
+            {
+                arr[dest++] = right[j++];
+                ++right_wins;
+                left_wins = 0;
+            }
+            else
+            {
+                arr[dest++] = scratch[i++];
+                ++left_wins;
+                right_wins = 0;
+            }
+        }
+
+        /* then a block at a time, for as long as the blocks stay long */
+        while (i < left_size && j < right_size)
+        {
+            count = Gallop(right[j], scratch + i, left_size - i, 0, 1);
+            memcpy(arr + dest, scratch + i, count * sizeof(int));
+            dest += count;
+            i += count;
+            if (i == left_size)
+            {
+                break;
+            }
+            arr[dest++] = right[j++];
+            if (j == right_size)
+            {
+                break;
+            }
+
+            left_wins = count;
+
+            count = Gallop(scratch[i], right + j, right_size - j, 0, 0);
+            memmove(arr + dest, right + j, count * sizeof(int));
+            dest += count;
+            j += count;
+            if (j == right_size)
+            {
+                break;
+            }
+            arr[dest++] = scratch[i++];
+
+            if (left_wins < MIN_GALLOP && count < MIN_GALLOP)
+            {
+                break;
+            }
+        }
+    }
+
+    /* whatever is left of the right run is in place already */
+    memcpy(arr + dest, scratch + i, (left_size - i) * sizeof(int));
+}
+
+/* copies the right run to scratch and merges backward, from the end */
+static void MergeHigh(
+    int *arr,
+    size_t left_size,
+    size_t right_size,
+    int *scratch)
+{
+    size_t i = left_size;
+    size_t j = right_size;
+    size_t dest = left_size + right_size;
+    size_t left_wins = 0;
+    size_t right_wins = 0;
+    size_t count = 0;
+
+    memcpy(scratch, arr + left_size, right_size * sizeof(int));
+
+    while (0 < i && 0 < j)
+    {
+        left_wins = 0;
+        right_wins = 0;
+        while (0 < i && 0 < j && 
+               left_wins < MIN_GALLOP && right_wins < MIN_GALLOP)
+        {
+            /* on a tie the right one goes last */
+            if (scratch[j - 1] < arr[i - 1])
+            {
+                arr[--dest] = arr[--i];
+                ++left_wins;
+                right_wins = 0;
+            }
+            else
+            {
+                arr[--dest] = scratch[--j];
+                ++right_wins;
+                left_wins = 0;
+            }
+        }
+
+        while (0 < i && 0 < j)
+        {
+            count = i - Gallop(scratch[j - 1], arr, i, i - 1, 1);
+            dest -= count;
+            i -= count;
+            memmove(arr + dest, arr + i, count * sizeof(int));
+            if (0 == i)
+            {
+                break;
+            }
+            arr[--dest] = scratch[--j];
+            if (0 == j)
+            {
+                break;
+            }
+
+            left_wins = count;
+
+            count = j - Gallop(arr[i - 1], scratch, j, j - 1, 0);
+            dest -= count;
+            j -= count;
+            memcpy(arr + dest, scratch + j, count * sizeof(int));
+            if (0 == j)
+            {
+                break;
+            }
+            arr[--dest] = arr[--i];
+
+            if (left_wins < MIN_GALLOP && count < MIN_GALLOP)
+            {
+                break;
+            }
+        }
+    }
+
+    /* whatever is left of the left run is in place already */
+    memcpy(arr, scratch, j * sizeof(int));
+}
+
+/* the number of elements in sorted arr that go before key - the ones      */
+/* smaller than it, and the equal ones too if past_equal. Steps of 1, 3, 7 */
+/* ... away from arr[hint] find the range, and a binary search the spot,   */
+/* so it takes O(log d) for an answer d away from the hint                 */
+static size_t Gallop(
+    int key,
+    const int *arr,
+    size_t size,
+    size_t hint,
+    int past_equal)
+{
+    size_t last = 0;
+    size_t offset = 1;
+    size_t max = 0;
+    size_t low = 0;
+    size_t high = 0;
+    size_t mid = 0;
+
+    if (GoesBefore(arr[hint], key, past_equal))
+    {
+        max = size - hint;
+        while (offset < max && 
+               GoesBefore(arr[hint + offset], key, past_equal))
+        {
+            last = offset;
+            offset = (offset << 1) + 1;
+        }
+        low = hint + last + 1;
+        high = hint + (offset < max ? offset : max);
+    }
+    else
+    {
+        max = hint + 1;
+        while (offset < max && 
+               !GoesBefore(arr[hint - offset], key, past_equal))
+        {
+            last = offset;
+            offset = (offset << 1) + 1;
+        }
+        low = hint + 1 - (offset < max ? offset : max);
+        high = hint - last;
+    }
+
+    while (low < high)
+    {
+        mid = low + (high - low) / 2;
+        if (GoesBefore(arr[mid], key, past_equal))
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return (low);
+}
+
+static int GoesBefore(int num, int key, int past_equal)
+{
+    return (num < key || (past_equal && num == key));
 }
 
 
@@ -468,48 +1127,8 @@ static void CopyArray(int *dest, int *src, size_t size)
     }
 }
 
-static void CountingSortForDigits(int arr[], size_t size, size_t digit)
+/* flipping the sign bit orders ints the way their unsigned keys order */
+static unsigned int RadixKey(int num)
 {
-    int range_arr[10] = {0};
-    int *new_arr = NULL;
-    size_t i = 0;
-
-    new_arr = (int *)malloc(size * sizeof(int));
-    if (NULL == new_arr)
-    {
-        return;
-    }
-	
-    for (i = 0; i < size; i++)
-    {
-        (range_arr[(arr[i] / digit) % 10])++;
-    }
-
-    for (i = 1; i < 10; i++)
-    {
-        range_arr[i] += range_arr[i - 1];
-    }
-
-    for (i = size; i > 0; i--) 
-    {
-        new_arr[range_arr[(arr[i - 1] / digit) % 10] - 1] = arr[i - 1];
-        --range_arr[(arr[i - 1] / digit) % 10];
-    }
-
-    CopyArray(arr, new_arr, size);
-
-    free(new_arr);
+    return ((unsigned int)num ^ (UINT_MAX ^ (UINT_MAX >> 1)));
 }
-
-static int GetMaxDigits(int num)
-{
-    int count = 0;
-
-    while (num)
-    {
-        count++;
-        num /= 10;
-    }
-
-    return count;
-}
\ No newline at end of file
@@ -0,0 +1,617 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#define _POSIX_C_SOURCE 200112L /* sysconf */
+
+#include <stdlib.h> /* malloc */
+#include <string.h> /* memcpy */
+#include <assert.h> /* assert */
+#include <pthread.h> /* pthread_create */
+#include <unistd.h> /* sysconf */
+
+#include "sort.h" /* MergeSortScratch, Qsort */
+#include "sort_mt.h" /* ParallelMergeSort */
+#include "sort_util.h" /* sort_elem_t, SORT_SWAP_ELEM */
+
+#define TASKS_PER_THREAD (4) /* grains per thread, so uneven ones even out */
+#define MIN_GRAIN (8192) /* below it a task costs more to hand out than run */
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+
+/******************** TYPEDEFS ********************/
+typedef struct task_pool task_pool_t;
+
+typedef struct pool_task
+{
+    void (*run)(task_pool_t *pool, void *arg);
+    void *arg;
+    size_t *pending; /* tasks the spawner still waits for */
+    struct pool_task *newer;
+    struct pool_task *older;
+} pool_task_t;
+
+/*
+Tasks live on the stack of the thread that spawned them, which waits for
+them before it returns. Idle workers take the oldest task, the largest
+part of the array, and a waiting thread the newest, most likely the one it
+just spawned and its data still in cache.
+*/
+struct task_pool
+{
+    pthread_mutex_t lock;
+    pthread_cond_t changed; /* a task was queued or finished, or stop */
+    pool_task_t *newest;
+    pool_task_t *oldest;
+    int stop;
+    pthread_t *workers;
+    size_t num_workers;
+};
+
+typedef struct msort_job
+{
+    int *src; /* holds the elements to sort */
+    int *tmp; /* as large as src, scratch */
+    size_t size;
+    int to_tmp; /* the sorted result goes to tmp rather than to src */
+    size_t grain;
+} msort_job_t;
+
+typedef struct merge_job
+{
+    const int *left;
+    size_t left_size;
+    const int *right;
+    size_t right_size;
+    int *dest;
+    size_t begin; /* the part of dest this job fills */
+    size_t end;
+    size_t grain;
+} merge_job_t;
+
+typedef struct pqsort_ctx
+{
+    sort_elem_t elem;
+    size_t grain;
+} pqsort_ctx_t;
+
+typedef struct pqsort_job
+{
+    char *begin;
+    char *end;
+    size_t bad_allowed; /* unbalanced partitions left before Qsort takes over */
+    const pqsort_ctx_t *ctx;
+} pqsort_job_t;
+
+/******************** FORWARD DECLARATIONS ********************/
+static int PoolStart(task_pool_t *pool, size_t num_threads);
+static void PoolStop(task_pool_t *pool);
+static void PoolSpawn(
+    task_pool_t *pool,
+    pool_task_t *task,
+    void (*run)(task_pool_t *, void *),
+    void *arg,
+    size_t *pending
+);
+static void PoolWait(task_pool_t *pool, size_t *pending);
+static void RunTaskLocked(task_pool_t *pool, pool_task_t *task);
+static void *WorkerThread(void *pool);
+static void MergeSortTask(task_pool_t *pool, void *job);
+static void MergeTask(task_pool_t *pool, void *job);
+static void MergeRange(const merge_job_t *job);
+static size_t MergePath(const merge_job_t *job, size_t diagonal);
+static void QsortTask(task_pool_t *pool, void *job);
+static char *Partition(char *begin, char *end, const sort_elem_t *ctx);
+static char *Median3(char *a, char *b, char *c, const sort_elem_t *ctx);
+static size_t ThreadCount(size_t num_threads);
+static size_t Grain(size_t nmemb, size_t num_threads);
+
+/******************** FUNCTIONS ********************/
+int ParallelMergeSort(
+    int *arr_to_sort,
+    size_t num_elements,
+    size_t num_threads)
+{
+    task_pool_t pool;
+    msort_job_t job;
+    int *tmp = NULL;
+
+    assert(arr_to_sort);
+
+    num_threads = ThreadCount(num_threads);
+    job.grain = Grain(num_elements, num_threads);
+
+    if (num_elements <= job.grain)
+    {
+        return (MergeSort(arr_to_sort, num_elements));
+    }
+
+    tmp = (int *)malloc(num_elements * sizeof(int));
+    if (NULL == tmp)
+    {
+        return (1);
+    }
+
+    if (0 != PoolStart(&pool, num_threads))
+    {
+        free(tmp);
+        return (1);
+    }
+
+    job.src = arr_to_sort;
+    job.tmp = tmp;
+    job.size = num_elements;
+    job.to_tmp = 0;
+
+    MergeSortTask(&pool, &job);
+
+    PoolStop(&pool);
+    free(tmp);
+
+    return (0);
+}
+
+int ParallelQsort(
+    void *base,
+    size_t nmemb,
+    size_t size,
+    int (*compar)(const void *, const void *),
+    size_t num_threads)
+{
+    task_pool_t pool;
+    pqsort_ctx_t ctx;
+    pqsort_job_t job;
+
+    assert(base);
+    assert(size);
+    assert(compar);
+
+    num_threads = ThreadCount(num_threads);
+
+    SortElemInit(&ctx.elem, base, size, compar);
+    ctx.grain = Grain(nmemb, num_threads);
+
+    if (nmemb <= ctx.grain)
+    {
+        if (nmemb > 1)
+        {
+            Qsort(base, nmemb, size, compar);
+        }
+        return (0);
+    }
+
+    if (0 != PoolStart(&pool, num_threads))
+    {
+        return (1);
+    }
+
+    job.begin = (char *)base;
+    job.end = (char *)base + nmemb * size;
+    job.bad_allowed = SortLog2(nmemb);
+    job.ctx = &ctx;
+
+    QsortTask(&pool, &job);
+
+    PoolStop(&pool);
+
+    return (0);
+}
+
+/******************** HELPER FUNCS ********************/
+/* the calling thread is one of the threads, so it starts one less */
+static int PoolStart(task_pool_t *pool, size_t num_threads)
+{
+    size_t i = 0;
+
+    pool->newest = NULL;
+    pool->oldest = NULL;
+    pool->stop = 0;
+    pool->num_workers = 0;
+
+    pool->workers = (pthread_t *)malloc(num_threads * sizeof(pthread_t));
+    if (NULL == pool->workers)
+    {
+        return (1);
+    }
+
+    if (0 != pthread_mutex_init(&pool->lock, NULL))
+    {
+        free(pool->workers);
+        return (1);
+    }
+
+    if (0 != pthread_cond_init(&pool->changed, NULL))
+    {
+        pthread_mutex_destroy(&pool->lock);
+        free(pool->workers);
+        return (1);
+    }
+
+    for (i = 0; i + 1 < num_threads; ++i)
+    {
+        if (0 != pthread_create(&pool->workers[i], NULL, WorkerThread, pool))
+        {
+            break;
+        }
+    }
+    pool->num_workers = i;
+
+    return (0);
+}
+
+static void PoolStop(task_pool_t *pool)
+{
+    size_t i = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->changed);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < pool->num_workers; ++i)
+    {
+        pthread_join(pool->workers[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->changed);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->workers);
+}
+
+static void PoolSpawn(
+    task_pool_t *pool,
+    pool_task_t *task,
+    void (*run)(task_pool_t *, void *),
+    void *arg,
+    size_t *pending)
+{
+    task->run = run;
+    task->arg = arg;
+    task->pending = pending;
+    task->newer = NULL;
+
+    pthread_mutex_lock(&pool->lock);
+
+    ++*pending;
+    task->older = pool->newest;
+    if (NULL != pool->newest)
+    {
+        pool->newest->newer = task;
+    }
+    else
+    {
+        pool->oldest = task;
+    }
+    pool->newest = task;
+
+    pthread_cond_signal(&pool->changed);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/* runs queued tasks, anyone's, until the ones counted in pending are done */
+static void PoolWait(task_pool_t *pool, size_t *pending)
+{
+    pthread_mutex_lock(&pool->lock);
+
+    while (0 != *pending)
+    {
+        if (NULL != pool->newest)
+        {
+            RunTaskLocked(pool, pool->newest);
+        }
+        else
+        {
+            pthread_cond_wait(&pool->changed, &pool->lock);
+        }
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/* called and returns with the lock held, but runs the task without it */
+static void RunTaskLocked(task_pool_t *pool, pool_task_t *task)
+{
+    size_t *pending = task->pending;
+
+    if (NULL != task->newer)
+    {
+        task->newer->older = task->older;
+    }
+    else
+    {
+        pool->newest = task->older;
+    }
+    if (NULL != task->older)
+    {
+        task->older->newer = task->newer;
+    }
+    else
+    {
+        pool->oldest = task->newer;
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+    task->run(pool, task->arg);
+    pthread_mutex_lock(&pool->lock);
+
+    /* the spawner may return as soon as it sees 0 - task is gone with it */
+    if (0 == --*pending)
+    {
+        pthread_cond_broadcast(&pool->changed);
+    }
+}
+
+static void *WorkerThread(void *pool)
+{
+    task_pool_t *task_pool = (task_pool_t *)pool;
+
+    pthread_mutex_lock(&task_pool->lock);
+
+    while (!task_pool->stop)
+    {
+        if (NULL != task_pool->oldest)
+        {
+            RunTaskLocked(task_pool, task_pool->oldest);
+        }
+        else
+        {
+            pthread_cond_wait(&task_pool->changed, &task_pool->lock);
+        }
+    }
+
+    pthread_mutex_unlock(&task_pool->lock);
+
+    return (NULL);
+}
+
+/* sorts the halves into the other array, then merges them back into place */
+static void MergeSortTask(task_pool_t *pool, void *job)
+{
+    msort_job_t *msort = (msort_job_t *)job;
+    msort_job_t halves[2];
+    merge_job_t merge;
+    pool_task_t task;
+    size_t pending = 0;
+    size_t left_size = msort->size / 2;
+
+    /* the part of tmp under the grain is free until it is merged into */
+    if (msort->size <= msort->grain)
+    {
+        MergeSortScratch(msort->src, msort->size, msort->tmp);
+        if (msort->to_tmp)
+        {
+            memcpy(msort->tmp, msort->src, msort->size * sizeof(int));
+        }
+        return;
+    }
+
+    halves[0].src = msort->src;
+    halves[0].tmp = msort->tmp;
+    halves[0].size = left_size;
+    halves[0].to_tmp = !msort->to_tmp;
+    halves[0].grain = msort->grain;
+
+    halves[1] = halves[0];
+    halves[1].src += left_size;
+    halves[1].tmp += left_size;
+    halves[1].size = msort->size - left_size;
+
+    PoolSpawn(pool, &task, MergeSortTask, &halves[0], &pending);
+    MergeSortTask(pool, &halves[1]);
+    PoolWait(pool, &pending);
+
+    merge.left = msort->to_tmp ? msort->src : msort->tmp;
+    merge.left_size = left_size;
+    merge.right = merge.left + left_size;
+    merge.right_size = msort->size - left_size;
+    merge.dest = msort->to_tmp ? msort->tmp : msort->src;
+    merge.begin = 0;
+    merge.end = msort->size;
+    merge.grain = msort->grain;
+
+    MergeTask(pool, &merge);
+}
+
+/* cuts the output in halves until each is a grain, and merges those */
+static void MergeTask(task_pool_t *pool, void *job)
+{
+    merge_job_t *merge = (merge_job_t *)job;
+    merge_job_t halves[2];
+    pool_task_t task;
+    size_t pending = 0;
+
+    if (merge->end - merge->begin <= merge->grain)
+    {
+        MergeRange(merge);
+        return;
+    }
+
+    halves[0] = *merge;
+    halves[0].end = merge->begin + (merge->end - merge->begin) / 2;
+    halves[1] = *merge;
+    halves[1].begin = halves[0].end;
+
+    PoolSpawn(pool, &task, MergeTask, &halves[0], &pending);
+    MergeTask(pool, &halves[1]);
+    PoolWait(pool, &pending);
+}
+
+static void MergeRange(const merge_job_t *job)
+{
+    size_t i = MergePath(job, job->begin);
+    size_t j = job->begin - i;
+    size_t left_end = MergePath(job, job->end);
+    size_t right_end = job->end - left_end;
+    int *dest = job->dest + job->begin;
+
+    while (i < left_end && j < right_end)
+    {
+        /* ties go left, that keeps it stable */
+        if (job->right[j] < job->left[i])
+        {
+            *dest++ = job->right[j++];
+        }
+        else
+        {
+            *dest++ = job->left[i++];
+        }
+    }
+
+    while (i < left_end)
+    {
+        *dest++ = job->left[i++];
+    }
+
+    while (j < right_end)
+    {
+        *dest++ = job->right[j++];
+    }
+}
+
+/* how many of the first 'diagonal' merged elements come from the left */
+static size_t MergePath(const merge_job_t *job, size_t diagonal)
+{
+    size_t low = diagonal > job->right_size ? diagonal - job->right_size : 0;
+    size_t high = MIN(diagonal, job->left_size);
+    size_t mid = 0;
+
+    while (low < high)
+    {
+        mid = low + (high - low) / 2;
+
+        if (job->left[mid] <= job->right[diagonal - mid - 1])
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return (low);
+}
+
+static void QsortTask(task_pool_t *pool, void *job)
+{
+    pqsort_job_t *pqsort = (pqsort_job_t *)job;
+    const pqsort_ctx_t *ctx = pqsort->ctx;
+    pqsort_job_t sides[2];
+    pool_task_t task;
+    size_t pending = 0;
+    size_t nmemb = (size_t)(pqsort->end - pqsort->begin) / ctx->elem.size;
+    size_t left_nmemb = 0;
+    char *pivot = NULL;
+
+    if (nmemb <= ctx->grain || 0 == pqsort->bad_allowed)
+    {
+        if (nmemb > 1)
+        {
+            Qsort(pqsort->begin, nmemb, ctx->elem.size, ctx->elem.compar);
+        }
+        return;
+    }
+
+    pivot = Partition(pqsort->begin, pqsort->end, &ctx->elem);
+    left_nmemb = (size_t)(pivot - pqsort->begin) / ctx->elem.size;
+
+    sides[0].begin = pqsort->begin;
+    sides[0].end = pivot;
+    sides[0].bad_allowed = pqsort->bad_allowed;
+    sides[0].ctx = ctx;
+
+    /* a side under an eighth means the pivots are not working out */
+    if (left_nmemb < nmemb / 8 || nmemb - left_nmemb - 1 < nmemb / 8)
+    {
+        --sides[0].bad_allowed;
+    }
+
+    sides[1] = sides[0];
+    sides[1].begin = pivot + ctx->elem.size;
+    sides[1].end = pqsort->end;
+
+    PoolSpawn(pool, &task, QsortTask, &sides[0], &pending);
+    QsortTask(pool, &sides[1]);
+    PoolWait(pool, &pending);
+}
+
+/* Hoare partition around a median of medians, returns where the pivot lands */
+static char *Partition(char *begin, char *end, const sort_elem_t *ctx)
+{
+    size_t nmemb = (size_t)(end - begin) / ctx->size;
+    size_t step = nmemb / 8 * ctx->size;
+    char *mid = begin + nmemb / 2 * ctx->size;
+    char *last = end - ctx->size;
+    char *left = begin;
+    char *right = end;
+    char *pivot = Median3(Median3(begin, begin + step, begin + 2 * step, ctx),
+                          Median3(mid - step, mid, mid + step, ctx),
+                          Median3(last - 2 * step, last - step, last, ctx),
+                          ctx);
+
+    SORT_SWAP_ELEM(begin, pivot, ctx);
+
+    /* both scans stop on equal keys, so duplicates split evenly */
+    for (;;)
+    {
+        do
+        {
+            left += ctx->size;
+        } while (left < end && SORT_LESS(left, begin, ctx));
+
+        do
+        {
+            right -= ctx->size;
+        } while (SORT_LESS(begin, right, ctx));
+
+        if (left >= right)
+        {
+            break;
+        }
+
+        SORT_SWAP_ELEM(left, right, ctx);
+    }
+
+    SORT_SWAP_ELEM(begin, right, ctx);
+
+    return (right);
+}
+
+static char *Median3(char *a, char *b, char *c, const sort_elem_t *ctx)
+{
+    if (SORT_LESS(a, b, ctx))
+    {
+        if (SORT_LESS(b, c, ctx))
+        {
+            return (b);
+        }
+        return (SORT_LESS(a, c, ctx) ? c : a);
+    }
+
+    if (SORT_LESS(a, c, ctx))
+    {
+        return (a);
+    }
+    return (SORT_LESS(b, c, ctx) ? c : b);
+}
+
+static size_t ThreadCount(size_t num_threads)
+{
+    long cpus = 0;
+
+    if (0 != num_threads)
+    {
+        return (num_threads);
+    }
+
+    cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (cpus > 0 ? (size_t)cpus : 1);
+}
+
+static size_t Grain(size_t nmemb, size_t num_threads)
+{
+    size_t grain = nmemb / (num_threads * TASKS_PER_THREAD);
+
+    return (grain < MIN_GRAIN ? MIN_GRAIN : grain);
+}
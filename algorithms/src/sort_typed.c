@@ -0,0 +1,69 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#include <stddef.h> /* size_t */
+#include <stdint.h> /* int32_t */
+#include <stdlib.h> /* malloc */
+#include <string.h> /* memcpy */
+
+#include "sort_typed.h" /* SORT_DEFINE, RADIX_DEFINE */
+
+#define NUMBER_LESS(a, b) ((a) < (b))
+/* NaN is unordered, so it goes last - a < that is never true for it */
+/* would send the partition scans past the end of the range         */
+#define FLOAT_LESS(a, b) ((a) < (b) || ((b) != (b) && (a) == (a)))
+#define KEY_LESS(a, b) ((a).key < (b).key)
+
+#define SIGN_BIT_32 ((uint32_t)1 << 31)
+#define SIGN_BIT_64 ((uint64_t)1 << 63)
+
+/* radix keys: unsigned integers that order like the elements */
+#define UNSIGNED_KEY(x) (x)
+#define SIGNED_KEY_32(x) ((uint32_t)(x) ^ SIGN_BIT_32)
+#define SIGNED_KEY_64(x) ((uint64_t)(x) ^ SIGN_BIT_64)
+#define FLOAT_KEY(x) FloatKey(x)
+#define DOUBLE_KEY(x) DoubleKey(x)
+#define PAIR_KEY(x) ((x).key)
+
+/******************** FORWARD DECLARATIONS ********************/
+static uint32_t FloatKey(float value);
+static uint64_t DoubleKey(double value);
+
+/******************** FUNCTIONS ********************/
+SORT_DEFINE(Int32, int32_t, NUMBER_LESS)
+SORT_DEFINE(Int64, int64_t, NUMBER_LESS)
+SORT_DEFINE(Uint64, uint64_t, NUMBER_LESS)
+SORT_DEFINE(Float, float, FLOAT_LESS)
+SORT_DEFINE(Double, double, FLOAT_LESS)
+SORT_DEFINE(KeyValue, sort_kv_t, KEY_LESS)
+
+RADIX_DEFINE(Uint32, uint32_t, uint32_t, UNSIGNED_KEY)
+RADIX_DEFINE(Int32, int32_t, uint32_t, SIGNED_KEY_32)
+RADIX_DEFINE(Uint64, uint64_t, uint64_t, UNSIGNED_KEY)
+RADIX_DEFINE(Int64, int64_t, uint64_t, SIGNED_KEY_64)
+RADIX_DEFINE(Float, float, uint32_t, FLOAT_KEY)
+RADIX_DEFINE(Double, double, uint64_t, DOUBLE_KEY)
+RADIX_DEFINE(KeyValue, sort_kv_t, uint64_t, PAIR_KEY)
+
+/******************** HELPER FUNCS ********************/
+/* negative floats order backwards as integers - flip all their bits, */
+/* and just the sign bit of the positive ones to put them above       */
+static uint32_t FloatKey(float value)
+{
+    uint32_t bits = 0;
+
+    memcpy(&bits, &value, sizeof(bits));
+
+    return (bits ^ ((uint32_t)-(int32_t)(bits >> 31) | SIGN_BIT_32));
+}
+
+static uint64_t DoubleKey(double value)
+{
+    uint64_t bits = 0;
+
+    memcpy(&bits, &value, sizeof(bits));
+
+    return (bits ^ ((uint64_t)-(int64_t)(bits >> 63) | SIGN_BIT_64));
+}
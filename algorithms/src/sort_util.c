@@ -0,0 +1,49 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#include <assert.h> /* assert */
+
+#include "sort_util.h" /* sort_elem_t */
+
+/******************** FUNCTIONS ********************/
+void SortElemInit(
+    sort_elem_t *elem,
+    const void *base,
+    size_t size,
+    int (*compar)(const void *, const void *))
+{
+    static const size_t units[] = {sizeof(long), sizeof(int), sizeof(short)};
+    size_t i = 0;
+
+    assert(elem);
+    assert(size);
+    assert(compar);
+
+    elem->size = size;
+    elem->compar = compar;
+    elem->unit = 1;
+
+    for (i = 0; i < sizeof(units) / sizeof(units[0]); ++i)
+    {
+        if (0 == size % units[i] && 0 == (size_t)base % units[i])
+        {
+            elem->unit = units[i];
+            break;
+        }
+    }
+}
+
+size_t SortLog2(size_t n)
+{
+    size_t log = 0;
+
+    while (n > 1)
+    {
+        n >>= 1;
+        ++log;
+    }
+
+    return (log);
+}
@@ -0,0 +1,280 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Build: make TARGET=sort_mt AF=-pthread
+       (DEBUG=0 for benchmark numbers)
+Run:   ./sort_mt.out [elements [max threads]]
+
+The benchmark sorts 100M random ints by default, with 1 thread and then
+doubling up to max threads - by default one per online CPU - and prints
+the wall time and speedup against 1 thread next to serial MergeSort and
+Qsort. The times are wall clock, clock() would add up every thread.
+*/
+
+#define _POSIX_C_SOURCE 200112L /* clock_gettime, sysconf */
+
+#define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
+#define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
+
+#define BENCH_SIZE 100000000 /* elements per benchmark run */
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* qsort */
+#include <string.h> /* memcmp */
+#include <time.h> /* clock_gettime */
+#include <unistd.h> /* sysconf */
+
+#include "sort.h" /* MergeSort */
+#include "sort_mt.h" /* ParallelMergeSort */
+#include "sort_test_data.h" /* FillPattern, record_t */
+
+/******************** FORWARD DECLARATIONS ********************/
+static void BenchScaling(size_t size, size_t max_threads);
+static double NowSec(void);
+static int Cmp(const void *a, const void *b);
+
+/******************** TESTS ********************/
+/* every size, pattern and thread count against qsort from the C library */
+int TestFlowParallelSorts()
+{
+    size_t sizes[] = {0, 1, 2, 100, 8192, 8193, 100000, 1000003};
+    size_t threads[] = {1, 2, 3, 8};
+    size_t max_size = 1000003;
+    int *expected = (int *)malloc(max_size * sizeof(int));
+    int *merge_sorted = (int *)malloc(max_size * sizeof(int));
+    int *qsorted = (int *)malloc(max_size * sizeof(int));
+    size_t size_idx = 0;
+    size_t thread_idx = 0;
+    size_t size = 0;
+    int pattern = 0;
+    int status = 0;
+
+    if (NULL == expected || NULL == merge_sorted || NULL == qsorted)
+    {
+        free(expected);
+        free(merge_sorted);
+        free(qsorted);
+        return (1);
+    }
+
+    for (size_idx = 0; 0 == status &&
+                       size_idx < sizeof(sizes) / sizeof(sizes[0]); ++size_idx)
+    {
+        size = sizes[size_idx];
+        for (pattern = 0; 0 == status && pattern < NUM_PATTERNS; ++pattern)
+        {
+            /* the same seed refills the same input for every thread count */
+            srand(1);
+            FillPattern(expected, size, pattern);
+            memcpy(merge_sorted, expected, size * sizeof(int));
+            qsort(expected, size, sizeof(int), Cmp);
+
+            for (thread_idx = 0; 0 == status &&
+                    thread_idx < sizeof(threads) / sizeof(threads[0]);
+                                                                ++thread_idx)
+            {
+                srand(1);
+                FillPattern(merge_sorted, size, pattern);
+                memcpy(qsorted, merge_sorted, size * sizeof(int));
+
+                if (0 != ParallelMergeSort(merge_sorted, size,
+                                                        threads[thread_idx]) ||
+                    0 != memcmp(merge_sorted, expected, size * sizeof(int)))
+                {
+                    status = 2;
+                }
+                else if (0 != ParallelQsort(qsorted, size, sizeof(int), Cmp,
+                                                        threads[thread_idx]) ||
+                    0 != memcmp(qsorted, expected, size * sizeof(int)))
+                {
+                    status = 3;
+                }
+            }
+        }
+    }
+
+    free(expected);
+    free(merge_sorted);
+    free(qsorted);
+
+    return (status);
+}
+
+/* ParallelQsort moves whole elements, a word or a byte at a time */
+int TestFlowParallelQsortTypes()
+{
+    size_t size = 100000;
+    record_t *records = (record_t *)malloc(size * sizeof(record_t));
+    packed_t *packed = (packed_t *)malloc(size * sizeof(packed_t));
+    size_t i = 0;
+    long key = 0;
+    int status = 0;
+
+    if (NULL == records || NULL == packed)
+    {
+        free(records);
+        free(packed);
+        return (1);
+    }
+
+    for (i = 0; i < size; ++i)
+    {
+        /* keys within 24 bits, so the big endian bytes order as numbers */
+        key = rand() % (1L << 24);
+
+        records[i].key = key % 1000;
+        records[i].payload[0] = key;
+        records[i].payload[1] = ~key;
+
+        packed[i].key[0] = (char)(key >> 16);
+        packed[i].key[1] = (char)(key >> 8);
+        packed[i].key[2] = (char)key;
+        memcpy(packed[i].payload, packed[i].key, sizeof(packed[i].key));
+        packed[i].payload[3] = (char)(key % 7);
+    }
+
+    if (0 != ParallelQsort(records, size, sizeof(record_t), CmpRecord, 4) ||
+        0 != ParallelQsort(packed, size, sizeof(packed_t), CmpPacked, 4))
+    {
+        status = 2;
+    }
+
+    for (i = 0; 0 == status && i < size; ++i)
+    {
+        if ((0 != i && CmpRecord(&records[i - 1], &records[i]) > 0) ||
+            records[i].key != records[i].payload[0] % 1000 ||
+            records[i].payload[1] != ~records[i].payload[0])
+        {
+            status = 3;
+        }
+        else if ((0 != i && CmpPacked(&packed[i - 1], &packed[i]) > 0) ||
+                 0 != memcmp(packed[i].payload, packed[i].key,
+                                                    sizeof(packed[i].key)))
+        {
+            status = 4;
+        }
+    }
+
+    free(records);
+    free(packed);
+
+    return (status);
+}
+
+int main(int argc, char *argv[])
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t size = (argc > 1) ? (size_t)atol(argv[1]) : BENCH_SIZE;
+    size_t max_threads = (argc > 2) ? (size_t)atol(argv[2]) :
+                                                (size_t)(cpus > 0 ? cpus : 1);
+    int status = 0;
+
+    status = TestFlowParallelSorts();
+    if (0 == status)
+    {
+        status = TestFlowParallelQsortTypes();
+    }
+
+    if (0 == status)
+    {
+        printf("SortMT| ALL TESTS: %s\n", PASS);
+    }
+    else
+    {
+        printf("SortMT| %s AT %d \n", FAIL, status);
+        return (status);
+    }
+
+    BenchScaling(size, max_threads);
+
+    return (0);
+}
+
+/******************** HELPER FUNCS ********************/
+static void BenchScaling(size_t size, size_t max_threads)
+{
+    int *source = (int *)malloc(size * sizeof(int));
+    int *arr = (int *)malloc(size * sizeof(int));
+    double merge_base = 0;
+    double qsort_base = 0;
+    double merge_time = 0;
+    double qsort_time = 0;
+    double start = 0;
+    size_t threads = 1;
+
+    if (NULL == source || NULL == arr)
+    {
+        printf("BenchScaling: not enough memory for %lu elements\n",
+                                                        (unsigned long)size);
+        free(source);
+        free(arr);
+        return;
+    }
+
+    FillPattern(source, size, 0);
+
+    printf("\nSortMT| %lu random ints, wall time in seconds\n",
+                                                        (unsigned long)size);
+
+    memcpy(arr, source, size * sizeof(int));
+    start = NowSec();
+    MergeSort(arr, size);
+    merge_time = NowSec() - start;
+
+    memcpy(arr, source, size * sizeof(int));
+    start = NowSec();
+    Qsort(arr, size, sizeof(int), Cmp);
+    qsort_time = NowSec() - start;
+
+    printf("%-8s | %-20s | %-20s\n", "threads", "ParallelMergeSort",
+                                                            "ParallelQsort");
+    printf("%-8s | %8.3f %11s | %8.3f\n", "serial", merge_time, "", qsort_time);
+
+    while (threads <= max_threads)
+    {
+        memcpy(arr, source, size * sizeof(int));
+        start = NowSec();
+        ParallelMergeSort(arr, size, threads);
+        merge_time = NowSec() - start;
+
+        memcpy(arr, source, size * sizeof(int));
+        start = NowSec();
+        ParallelQsort(arr, size, sizeof(int), Cmp, threads);
+        qsort_time = NowSec() - start;
+
+        if (1 == threads)
+        {
+            merge_base = merge_time;
+            qsort_base = qsort_time;
+        }
+
+        printf("%-8lu | %8.3f (x%5.2f)    | %8.3f (x%5.2f)\n",
+                (unsigned long)threads, merge_time, merge_base / merge_time,
+                                        qsort_time, qsort_base / qsort_time);
+
+        /* doubling, but the last step lands on max_threads */
+        threads = (threads < max_threads && threads * 2 > max_threads) ?
+                                                    max_threads : threads * 2;
+    }
+
+    free(source);
+    free(arr);
+}
+
+static double NowSec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((double)now.tv_sec + (double)now.tv_nsec / 1e9);
+}
+
+static int Cmp(const void *a, const void *b)
+{
+    int lhs = *(const int *)a;
+    int rhs = *(const int *)b;
+
+    return ((lhs > rhs) - (lhs < rhs));
+}
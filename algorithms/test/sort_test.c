@@ -8,18 +8,29 @@ Date: Mar 31, 2024
 
 #define SLOW_LOOPS 100  /* loop count for slow loops - O(N^2) */
 #define FAST_LOOPS 1000 /* loop count for faster loops - O(N log N) and O(N) */
+#define PATTERN_SIZE 1000000 /* elements per Qsort benchmark pattern */
 
 #include <stdio.h> /* printf */
 #include <time.h> /* clock() */
 #include <stdlib.h> /* rand */
+#include <string.h> /* memcmp */
+#include <limits.h> /* INT_MIN */
 
 #include "sort.h" /* SelectionSort */
+#include "sort_test_data.h" /* FillPattern, record_t */
+
+static size_t g_compares = 0;
+static const char *g_pattern_names[NUM_PATTERNS] = 
+{
+    "random", "sorted", "reversed", "few unique", "organ pipe", "sorted + 1%"
+};
 
 /******************** FORWARD DECLARATIONS ********************/
 static void InitArray(int *arr, size_t size);
 static int IsArraySorted(int *arr, size_t size);
 static int Cmp(const void * a, const void * b);
 static void CopyArray(int *dest, int *src, size_t size);
+static int CmpCounted(const void *a, const void *b);
 
 /******************** TESTS ********************/
 int TestFlowSimpleSorts()
@@ -441,6 +452,282 @@ int TestFlowAdvancedSorts()
 }
 
 
+int TestFlowQsortPatterns()
+{
+    int *arr = (int *)malloc(PATTERN_SIZE * sizeof(int));
+    int *expected = (int *)malloc(PATTERN_SIZE * sizeof(int));
+    record_t *records = (record_t *)malloc(PATTERN_SIZE * sizeof(record_t));
+    packed_t *packed = (packed_t *)malloc(PATTERN_SIZE * sizeof(packed_t));
+    size_t sizes[] = {1, 2, 23, 24, 129, 5000, PATTERN_SIZE};
+    size_t size_idx = 0;
+    size_t size = 0;
+    size_t i = 0;
+    int pattern = 0;
+    int status = 0;
+
+    if (NULL == arr || NULL == expected || NULL == records || NULL == packed)
+    {
+        status = 1;
+    }
+
+    for (size_idx = 0; 0 == status && size_idx < sizeof(sizes) / sizeof(*sizes); 
+         size_idx++)
+    {
+        size = sizes[size_idx];
+
+        for (pattern = 0; 0 == status && pattern < NUM_PATTERNS; pattern++)
+        {
+            FillPattern(arr, size, pattern);
+            CopyArray(arr, expected, size);
+            qsort(expected, size, sizeof(int), Cmp);
+
+            for (i = 0; i < size; i++)
+            {
+                records[i].key = arr[i];
+                records[i].payload[0] = arr[i];
+                records[i].payload[1] = -arr[i];
+                /* big endian, so memcmp orders the keys like ints */
+                packed[i].key[0] = (char)(arr[i] >> 16);
+                packed[i].key[1] = (char)(arr[i] >> 8);
+                packed[i].key[2] = (char)arr[i];
+                packed[i].payload[3] = (char)arr[i];
+            }
+
+            Qsort(arr, size, sizeof(int), Cmp);
+            Qsort(records, size, sizeof(record_t), CmpRecord);
+            Qsort(packed, size, sizeof(packed_t), CmpPacked);
+
+            for (i = 0; 0 == status && i < size; i++)
+            {
+                if (arr[i] != expected[i])
+                {
+                    status = 2;
+                }
+                else if (records[i].key != expected[i] || 
+                         records[i].payload[0] != expected[i] ||
+                         records[i].payload[1] != -expected[i])
+                {
+                    status = 3;
+                }
+                else if (packed[i].key[2] != (char)expected[i] ||
+                         packed[i].payload[3] != (char)expected[i])
+                {
+                    status = 4;
+                }
+            }
+
+            if (0 != status)
+            {
+                printf("Testing Qsort\n");
+                printf("%s pattern of %lu: result is unsorted.\n", 
+                       g_pattern_names[pattern], (unsigned long)size);
+            }
+        }
+    }
+
+    free(arr);
+    free(expected);
+    free(records);
+    free(packed);
+
+    return status;
+}
+
+void BenchQsort()
+{
+    int *arr = (int *)malloc(PATTERN_SIZE * sizeof(int));
+    clock_t start;
+    double time_taken_my_qsort = 0;
+    double time_taken_default_qsort = 0;
+    size_t my_compares = 0;
+    int pattern = 0;
+
+    if (NULL == arr)
+    {
+        return;
+    }
+
+    printf("\nQsort vs glibc qsort, %d ints:\n", PATTERN_SIZE);
+    printf("%-12s %10s %12s %10s %12s\n", 
+           "pattern", "Qsort ms", "compares", "qsort ms", "compares");
+
+    for (pattern = 0; pattern < NUM_PATTERNS; pattern++)
+    {
+        FillPattern(arr, PATTERN_SIZE, pattern);
+        g_compares = 0;
+        start = clock();
+        Qsort(arr, PATTERN_SIZE, sizeof(int), CmpCounted);
+        time_taken_my_qsort = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+        my_compares = g_compares;
+
+        FillPattern(arr, PATTERN_SIZE, pattern);
+        g_compares = 0;
+        start = clock();
+        qsort(arr, PATTERN_SIZE, sizeof(int), CmpCounted);
+        time_taken_default_qsort = (double)(clock() - start) * 1000 / 
+                                   CLOCKS_PER_SEC;
+
+        printf("%-12s %10.1f %12lu %10.1f %12lu\n", g_pattern_names[pattern],
+               time_taken_my_qsort, (unsigned long)my_compares, 
+               time_taken_default_qsort, (unsigned long)g_compares);
+    }
+
+    free(arr);
+}
+
+
+/* MergeSort, and MergeSortScratch with exactly the scratch it asks for */
+int TestFlowMergeSortPatterns()
+{
+    int *source = (int *)malloc(PATTERN_SIZE * sizeof(int));
+    int *arr = (int *)malloc(PATTERN_SIZE * sizeof(int));
+    int *expected = (int *)malloc(PATTERN_SIZE * sizeof(int));
+    int *scratch = NULL;
+    size_t sizes[] = {0, 1, 2, 63, 64, 65, 129, 5000, PATTERN_SIZE};
+    size_t size_idx = 0;
+    size_t size = 0;
+    size_t i = 0;
+    int pattern = 0;
+    int status = 0;
+
+    if (NULL == source || NULL == arr || NULL == expected)
+    {
+        status = 1;
+    }
+
+    for (size_idx = 0; 0 == status && size_idx < sizeof(sizes) / sizeof(*sizes); 
+         size_idx++)
+    {
+        size = sizes[size_idx];
+
+        for (pattern = 0; 0 == status && pattern < NUM_PATTERNS; pattern++)
+        {
+            FillPattern(source, size, pattern);
+            CopyArray(source, expected, size);
+            qsort(expected, size, sizeof(int), Cmp);
+
+            CopyArray(source, arr, size);
+            if (0 != MergeSort(arr, size))
+            {
+                status = 2;
+            }
+
+            for (i = 0; 0 == status && i < size; i++)
+            {
+                if (arr[i] != expected[i])
+                {
+                    status = 3;
+                }
+            }
+
+            /* malloc'd to size, so a sanitizer would catch an overrun */
+            scratch = (int *)malloc(size / 2 * sizeof(int));
+            if (0 == status && NULL == scratch && 0 != size / 2)
+            {
+                status = 1;
+            }
+
+            if (0 == status)
+            {
+                CopyArray(source, arr, size);
+                MergeSortScratch(arr, size, scratch);
+            }
+
+            for (i = 0; 0 == status && i < size; i++)
+            {
+                if (arr[i] != expected[i])
+                {
+                    status = 4;
+                }
+            }
+
+            free(scratch);
+
+            if (0 != status)
+            {
+                printf("Testing MergeSort\n");
+                printf("%s pattern of %lu: result is unsorted.\n", 
+                       g_pattern_names[pattern], (unsigned long)size);
+            }
+        }
+    }
+
+    free(source);
+    free(arr);
+    free(expected);
+
+    return status;
+}
+
+void BenchMergeSort()
+{
+    int *arr = (int *)malloc(PATTERN_SIZE * sizeof(int));
+    clock_t start;
+    double time_taken_merge = 0;
+    double time_taken_my_qsort = 0;
+    int pattern = 0;
+
+    if (NULL == arr)
+    {
+        return;
+    }
+
+    printf("\nMergeSort vs Qsort, %d ints:\n", PATTERN_SIZE);
+    printf("%-12s %12s %10s\n", "pattern", "MergeSort ms", "Qsort ms");
+
+    for (pattern = 0; pattern < NUM_PATTERNS; pattern++)
+    {
+        FillPattern(arr, PATTERN_SIZE, pattern);
+        start = clock();
+        MergeSort(arr, PATTERN_SIZE);
+        time_taken_merge = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+
+        FillPattern(arr, PATTERN_SIZE, pattern);
+        start = clock();
+        Qsort(arr, PATTERN_SIZE, sizeof(int), Cmp);
+        time_taken_my_qsort = (double)(clock() - start) * 1000 / 
+                              CLOCKS_PER_SEC;
+
+        printf("%-12s %12.1f %10.1f\n", g_pattern_names[pattern],
+               time_taken_merge, time_taken_my_qsort);
+    }
+
+    free(arr);
+}
+
+
+int TestFlowRadixNegatives()
+{
+    int arr[5000] = {0};
+    int expected[5000] = {0};
+    size_t i = 0;
+
+    for (i = 0; i < 5000; i++)
+    {
+        arr[i] = rand() - RAND_MAX / 2;
+    }
+    arr[0] = INT_MIN;
+    arr[1] = INT_MAX;
+    arr[2] = 0;
+    arr[3] = -1;
+    CopyArray(arr, expected, 5000);
+
+    RadixSort(arr, 5000);
+    qsort(expected, 5000, sizeof(int), CmpCounted);
+
+    for (i = 0; i < 5000; i++)
+    {
+        if (arr[i] != expected[i])
+        {
+            printf("Testing Radix Sort\n");
+            printf("negative numbers case: result is unsorted.\n");
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
 /******************** MAIN ********************/
 int main()
 {
@@ -466,6 +753,42 @@ int main()
         printf("Binary Search & Advanced Sorts| %s AT %d \n", FAIL, test_status);
     }
 
+    test_status = TestFlowRadixNegatives();
+    
+    if(test_status == 0)
+    {
+        printf("Radix Sort Negatives| ALL TESTS: %s\n", PASS);
+    }
+    else
+    {
+        printf("Radix Sort Negatives| %s AT %d \n", FAIL, test_status);
+    }
+
+    test_status = TestFlowQsortPatterns();
+    
+    if(test_status == 0)
+    {
+        printf("Qsort Patterns| ALL TESTS: %s\n", PASS);
+    }
+    else
+    {
+        printf("Qsort Patterns| %s AT %d \n", FAIL, test_status);
+    }
+
+    test_status = TestFlowMergeSortPatterns();
+    
+    if(test_status == 0)
+    {
+        printf("MergeSort Patterns| ALL TESTS: %s\n", PASS);
+    }
+    else
+    {
+        printf("MergeSort Patterns| %s AT %d \n", FAIL, test_status);
+    }
+
+    BenchQsort();
+    BenchMergeSort();
+
     return 0;
 }
 /******************** HELPER FUNCS ********************/
@@ -508,4 +831,14 @@ static void CopyArray(int *arr1, int *arr2, size_t size)
     {
         arr2[i] = arr1[i];
     }
-}
\ No newline at end of file
+}
+
+static int CmpCounted(const void *a, const void *b)
+{
+    int lhs = *(const int *)a;
+    int rhs = *(const int *)b;
+
+    ++g_compares;
+
+    return ((lhs > rhs) - (lhs < rhs));
+}
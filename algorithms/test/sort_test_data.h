@@ -0,0 +1,82 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Sort Test Data
+
+Description:
+The inputs that sort_test and sort_mt_test both sort: the int patterns of
+FillPattern, and two element types whose sizes make the generic sorts swap
+a long at a time (record_t) and a byte at a time (packed_t), with their
+compare functions.
+*/
+
+#ifndef SORT_TEST_DATA_H
+#define SORT_TEST_DATA_H
+
+#include <stdlib.h> /* rand */
+#include <string.h> /* memcmp */
+
+#define NUM_PATTERNS 6
+
+/******************** TYPEDEFS ********************/
+typedef struct record
+{
+    long key;
+    long payload[2];
+} record_t; /* swapped a long at a time */
+
+typedef struct packed
+{
+    char key[3];
+    char payload[4];
+} packed_t; /* swapped a byte at a time */
+
+/******************** FUNCTIONS ********************/
+/* 0 random, 1 sorted, 2 reversed, 3 few unique, 4 organ pipe, */
+/* 5 sorted with 1% of the elements random. keys fit in 24 bits */
+static void FillPattern(int *arr, size_t size, int pattern)
+{
+    size_t i = 0;
+
+    for (i = 0; i < size; i++)
+    {
+        switch (pattern)
+        {
+            case 0:
+                arr[i] = rand() % (1 << 24);
+                break;
+            case 1:
+                arr[i] = (int)i;
+                break;
+            case 2:
+                arr[i] = (int)(size - i);
+                break;
+            case 3:
+                arr[i] = rand() % 8;
+                break;
+            case 4:
+                arr[i] = (int)(i < size / 2 ? i : size - i);
+                break;
+            default:
+                arr[i] = (0 == rand() % 100) ? rand() % (1 << 24) : (int)i;
+                break;
+        }
+    }
+}
+
+static int CmpRecord(const void *a, const void *b)
+{
+    long lhs = ((const record_t *)a)->key;
+    long rhs = ((const record_t *)b)->key;
+
+    return ((lhs > rhs) - (lhs < rhs));
+}
+
+static int CmpPacked(const void *a, const void *b)
+{
+    return (memcmp(((const packed_t *)a)->key, ((const packed_t *)b)->key,
+                                            sizeof(((const packed_t *)a)->key)));
+}
+
+#endif /* SORT_TEST_DATA_H */
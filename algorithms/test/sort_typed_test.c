@@ -0,0 +1,582 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Build: make TARGET=sort && make TARGET=sort_typed AF=-lsort
+       (DEBUG=0 on both for benchmark numbers - the inlining is the point)
+Run:   ./sort_typed.out
+
+The benchmark compares with the generic Qsort, linked from libsort.so.
+*/
+
+#define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
+#define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
+
+#define BENCH_SIZE 10000000 /* elements per benchmark run */
+#define NUM_PATTERNS 4
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* qsort */
+#include <string.h> /* memcpy */
+#include <time.h> /* clock */
+
+#include "sort.h" /* Qsort */
+#include "sort_typed.h" /* SortInt32 */
+
+/******************** FORWARD DECLARATIONS ********************/
+static void BenchTyped(void);
+static void BenchRadix(void);
+static uint64_t FillValue(size_t i, size_t size, int pattern);
+static uint64_t NextRand(void);
+static int CmpInt32(const void *a, const void *b);
+static int CmpInt64(const void *a, const void *b);
+static int CmpUint64(const void *a, const void *b);
+static int CmpDouble(const void *a, const void *b);
+static int CmpKeyValue(const void *a, const void *b);
+
+static uint64_t g_seed = 88172645463325252UL;
+
+/******************** TESTS ********************/
+/* each typed sort against glibc qsort, on every pattern and a range of sizes */
+int TestFlowTypedSorts()
+{
+    size_t sizes[] = {0, 1, 2, 23, 24, 25, 129, 1000, 100000};
+    size_t max_size = 100000;
+    int32_t *i32 = (int32_t *)malloc(max_size * sizeof(int32_t));
+    int32_t *i32_expected = (int32_t *)malloc(max_size * sizeof(int32_t));
+    int64_t *i64 = (int64_t *)malloc(max_size * sizeof(int64_t));
+    int64_t *i64_expected = (int64_t *)malloc(max_size * sizeof(int64_t));
+    uint64_t *u64 = (uint64_t *)malloc(max_size * sizeof(uint64_t));
+    uint64_t *u64_expected = (uint64_t *)malloc(max_size * sizeof(uint64_t));
+    double *f64 = (double *)malloc(max_size * sizeof(double));
+    double *f64_expected = (double *)malloc(max_size * sizeof(double));
+    sort_kv_t *kv = (sort_kv_t *)malloc(max_size * sizeof(sort_kv_t));
+    size_t size_idx = 0;
+    size_t size = 0;
+    size_t i = 0;
+    uint64_t value = 0;
+    int pattern = 0;
+    int status = 0;
+
+    if (NULL == i32 || NULL == i32_expected || NULL == i64 ||
+        NULL == i64_expected || NULL == u64 || NULL == u64_expected ||
+        NULL == f64 || NULL == f64_expected || NULL == kv)
+    {
+        status = 1;
+    }
+
+    for (size_idx = 0; 0 == status && size_idx < sizeof(sizes) / sizeof(*sizes);
+         size_idx++)
+    {
+        size = sizes[size_idx];
+
+        for (pattern = 0; 0 == status && pattern < NUM_PATTERNS; pattern++)
+        {
+            /* signed and unsigned views of the same bits, so negatives */
+            /* and the top half of uint64 are both exercised           */
+            for (i = 0; i < size; i++)
+            {
+                value = FillValue(i, size, pattern);
+                i32[i] = (int32_t)value;
+                i64[i] = (int64_t)value;
+                u64[i] = value;
+                f64[i] = (double)(int64_t)value / 3;
+                kv[i].key = value;
+                kv[i].value = ~value;
+            }
+            memcpy(i32_expected, i32, size * sizeof(int32_t));
+            memcpy(i64_expected, i64, size * sizeof(int64_t));
+            memcpy(u64_expected, u64, size * sizeof(uint64_t));
+            memcpy(f64_expected, f64, size * sizeof(double));
+
+            qsort(i32_expected, size, sizeof(int32_t), CmpInt32);
+            qsort(i64_expected, size, sizeof(int64_t), CmpInt64);
+            qsort(u64_expected, size, sizeof(uint64_t), CmpUint64);
+            qsort(f64_expected, size, sizeof(double), CmpDouble);
+
+            SortInt32(i32, size);
+            SortInt64(i64, size);
+            SortUint64(u64, size);
+            SortDouble(f64, size);
+            SortKeyValue(kv, size);
+
+            if (0 != memcmp(i32, i32_expected, size * sizeof(int32_t)))
+            {
+                status = 2;
+            }
+            else if (0 != memcmp(i64, i64_expected, size * sizeof(int64_t)))
+            {
+                status = 3;
+            }
+            else if (0 != memcmp(u64, u64_expected, size * sizeof(uint64_t)))
+            {
+                status = 4;
+            }
+            else if (0 != memcmp(f64, f64_expected, size * sizeof(double)))
+            {
+                status = 5;
+            }
+
+            /* the keys match the uint64 sort and each value its own key */
+            for (i = 0; 0 == status && i < size; i++)
+            {
+                if (kv[i].key != u64_expected[i] || kv[i].value != ~kv[i].key)
+                {
+                    status = 6;
+                }
+            }
+
+            if (0 != status)
+            {
+                printf("Testing Typed Sorts\n");
+                printf("pattern %d of %lu: result is unsorted.\n",
+                       pattern, (unsigned long)size);
+            }
+        }
+    }
+
+    free(i32);
+    free(i32_expected);
+    free(i64);
+    free(i64_expected);
+    free(u64);
+    free(u64_expected);
+    free(f64);
+    free(f64_expected);
+    free(kv);
+
+    return status;
+}
+
+/* NaNs go last, and do not break the sort around them */
+int TestFlowFloatNaN()
+{
+    float arr[200];
+    float nan = 0;
+    size_t i = 0;
+
+    nan = nan / nan;
+
+    for (i = 0; i < 200; i++)
+    {
+        arr[i] = (0 == i % 7) ? nan : (float)(int)(NextRand() % 1000) - 500;
+    }
+
+    SortFloat(arr, 200);
+
+    for (i = 0; i < 200 - 29; i++)
+    {
+        if (arr[i] != arr[i] || (i > 0 && arr[i - 1] > arr[i]))
+        {
+            return 1;
+        }
+    }
+    for (; i < 200; i++)
+    {
+        if (arr[i] == arr[i])
+        {
+            return 2;
+        }
+    }
+
+    return 0;
+}
+
+
+/* radix sorts against the typed sorts, which are checked above */
+int TestFlowRadixSorts()
+{
+    size_t sizes[] = {0, 1, 2, 255, 256, 257, 100000};
+    size_t max_size = 100000;
+    uint32_t *u32 = (uint32_t *)malloc(max_size * sizeof(uint32_t));
+    int32_t *i32 = (int32_t *)malloc(max_size * sizeof(int32_t));
+    int32_t *i32_expected = (int32_t *)malloc(max_size * sizeof(int32_t));
+    uint64_t *u64 = (uint64_t *)malloc(max_size * sizeof(uint64_t));
+    int64_t *i64 = (int64_t *)malloc(max_size * sizeof(int64_t));
+    int64_t *i64_expected = (int64_t *)malloc(max_size * sizeof(int64_t));
+    float *f32 = (float *)malloc(max_size * sizeof(float));
+    float *f32_expected = (float *)malloc(max_size * sizeof(float));
+    double *f64 = (double *)malloc(max_size * sizeof(double));
+    double *f64_expected = (double *)malloc(max_size * sizeof(double));
+    sort_kv_t *kv = (sort_kv_t *)malloc(max_size * sizeof(sort_kv_t));
+    size_t size_idx = 0;
+    size_t size = 0;
+    size_t i = 0;
+    uint64_t value = 0;
+    int pattern = 0;
+    int status = 0;
+
+    if (NULL == u32 || NULL == i32 || NULL == i32_expected || NULL == u64 ||
+        NULL == i64 || NULL == i64_expected || NULL == f32 ||
+        NULL == f32_expected || NULL == f64 || NULL == f64_expected ||
+        NULL == kv)
+    {
+        status = 1;
+    }
+
+    for (size_idx = 0; 0 == status && size_idx < sizeof(sizes) / sizeof(*sizes);
+         size_idx++)
+    {
+        size = sizes[size_idx];
+
+        for (pattern = 0; 0 == status && pattern < NUM_PATTERNS; pattern++)
+        {
+            for (i = 0; i < size; i++)
+            {
+                value = FillValue(i, size, pattern);
+                u32[i] = (uint32_t)value;
+                i32[i] = (int32_t)value;
+                u64[i] = value;
+                i64[i] = (int64_t)value;
+                f32[i] = (float)(int32_t)value / 7;
+                f64[i] = (double)(int64_t)value / 3;
+                /* few keys, so the indices show if equal keys stay in order */
+                kv[i].key = value % 16;
+                kv[i].value = i;
+            }
+            memcpy(i32_expected, i32, size * sizeof(int32_t));
+            memcpy(i64_expected, i64, size * sizeof(int64_t));
+            memcpy(f32_expected, f32, size * sizeof(float));
+            memcpy(f64_expected, f64, size * sizeof(double));
+            SortInt32(i32_expected, size);
+            SortInt64(i64_expected, size);
+            SortFloat(f32_expected, size);
+            SortDouble(f64_expected, size);
+
+            if (0 != RadixSortUint32(u32, size) ||
+                0 != RadixSortInt32(i32, size) ||
+                0 != RadixSortUint64(u64, size) ||
+                0 != RadixSortInt64(i64, size) ||
+                0 != RadixSortFloat(f32, size) ||
+                0 != RadixSortDouble(f64, size) ||
+                0 != RadixSortKeyValue(kv, size))
+            {
+                status = 2;
+            }
+            else if (0 != memcmp(i32, i32_expected, size * sizeof(int32_t)) ||
+                     0 != memcmp(i64, i64_expected, size * sizeof(int64_t)))
+            {
+                status = 3;
+            }
+            else if (0 != memcmp(f32, f32_expected, size * sizeof(float)) ||
+                     0 != memcmp(f64, f64_expected, size * sizeof(double)))
+            {
+                status = 4;
+            }
+
+            for (i = 1; 0 == status && i < size; i++)
+            {
+                if (u32[i - 1] > u32[i] || u64[i - 1] > u64[i])
+                {
+                    status = 5;
+                }
+                else if (kv[i - 1].key > kv[i].key ||
+                         (kv[i - 1].key == kv[i].key &&
+                          kv[i - 1].value > kv[i].value))
+                {
+                    status = 6;
+                }
+            }
+
+            if (0 != status)
+            {
+                printf("Testing Radix Sorts\n");
+                printf("pattern %d of %lu: result is unsorted.\n",
+                       pattern, (unsigned long)size);
+            }
+        }
+    }
+
+    free(u32);
+    free(i32);
+    free(i32_expected);
+    free(u64);
+    free(i64);
+    free(i64_expected);
+    free(f32);
+    free(f32_expected);
+    free(f64);
+    free(f64_expected);
+    free(kv);
+
+    return status;
+}
+
+
+/******************** MAIN ********************/
+int main()
+{
+    int tests_fails = 0;
+    int test_status = TestFlowTypedSorts();
+
+    if(test_status == 0)
+    {
+        printf("Typed Sorts| ALL TESTS: %s\n", PASS);
+    }
+    else
+    {
+        printf("Typed Sorts| %s AT %d \n", FAIL, test_status);
+        ++tests_fails;
+    }
+
+    test_status = TestFlowFloatNaN();
+
+    if(test_status == 0)
+    {
+        printf("Typed Sorts NaN| ALL TESTS: %s\n", PASS);
+    }
+    else
+    {
+        printf("Typed Sorts NaN| %s AT %d \n", FAIL, test_status);
+        ++tests_fails;
+    }
+
+    test_status = TestFlowRadixSorts();
+
+    if(test_status == 0)
+    {
+        printf("Radix Sorts| ALL TESTS: %s\n", PASS);
+    }
+    else
+    {
+        printf("Radix Sorts| %s AT %d \n", FAIL, test_status);
+        ++tests_fails;
+    }
+
+    if (0 != tests_fails)
+    {
+        return (tests_fails);
+    }
+
+    BenchRadix();
+    BenchTyped();
+
+    return 0;
+}
+
+/******************** BENCHMARK ********************/
+static void BenchTyped(void)
+{
+    static const char *pattern_names[NUM_PATTERNS] =
+    {
+        "random", "sorted", "reversed", "few unique"
+    };
+    int32_t *i32 = (int32_t *)malloc(BENCH_SIZE * sizeof(int32_t));
+    double *f64 = (double *)malloc(BENCH_SIZE * sizeof(double));
+    sort_kv_t *kv = (sort_kv_t *)malloc(BENCH_SIZE * sizeof(sort_kv_t));
+    double qsort_ms[3];
+    double typed_ms[3];
+    clock_t start;
+    size_t i = 0;
+    int pattern = 0;
+
+    if (NULL == i32 || NULL == f64 || NULL == kv)
+    {
+        free(i32);
+        free(f64);
+        free(kv);
+
+        return;
+    }
+
+    printf("\nQsort vs typed sort, %d elements, ms:\n", BENCH_SIZE);
+    printf("%-12s %10s %10s %10s %10s %10s %10s\n", "pattern",
+           "int32 Q", "typed", "double Q", "typed", "kv Q", "typed");
+
+    for (pattern = 0; pattern < NUM_PATTERNS; pattern++)
+    {
+        for (i = 0; i < BENCH_SIZE; i++)
+        {
+            i32[i] = (int32_t)FillValue(i, BENCH_SIZE, pattern);
+            f64[i] = (double)i32[i];
+            kv[i].key = FillValue(i, BENCH_SIZE, pattern);
+            kv[i].value = i;
+        }
+
+        start = clock();
+        Qsort(i32, BENCH_SIZE, sizeof(int32_t), CmpInt32);
+        qsort_ms[0] = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+        start = clock();
+        Qsort(f64, BENCH_SIZE, sizeof(double), CmpDouble);
+        qsort_ms[1] = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+        start = clock();
+        Qsort(kv, BENCH_SIZE, sizeof(sort_kv_t), CmpKeyValue);
+        qsort_ms[2] = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+
+        for (i = 0; i < BENCH_SIZE; i++)
+        {
+            i32[i] = (int32_t)FillValue(i, BENCH_SIZE, pattern);
+            f64[i] = (double)i32[i];
+            kv[i].key = FillValue(i, BENCH_SIZE, pattern);
+            kv[i].value = i;
+        }
+
+        start = clock();
+        SortInt32(i32, BENCH_SIZE);
+        typed_ms[0] = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+        start = clock();
+        SortDouble(f64, BENCH_SIZE);
+        typed_ms[1] = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+        start = clock();
+        SortKeyValue(kv, BENCH_SIZE);
+        typed_ms[2] = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+
+        printf("%-12s %10.0f %10.0f %10.0f %10.0f %10.0f %10.0f\n",
+               pattern_names[pattern], qsort_ms[0], typed_ms[0],
+               qsort_ms[1], typed_ms[1], qsort_ms[2], typed_ms[2]);
+    }
+
+    free(i32);
+    free(f64);
+    free(kv);
+}
+
+/* random keys, where the quicksort has nothing to exploit */
+static void BenchRadix(void)
+{
+    int32_t *i32 = (int32_t *)malloc(BENCH_SIZE * sizeof(int32_t));
+    uint64_t *u64 = (uint64_t *)malloc(BENCH_SIZE * sizeof(uint64_t));
+    float *f32 = (float *)malloc(BENCH_SIZE * sizeof(float));
+    sort_kv_t *kv = (sort_kv_t *)malloc(BENCH_SIZE * sizeof(sort_kv_t));
+    double sort_ms[4];
+    double radix_ms[4];
+    clock_t start;
+    size_t round = 0;
+    size_t i = 0;
+
+    if (NULL == i32 || NULL == u64 || NULL == f32 || NULL == kv)
+    {
+        free(i32);
+        free(u64);
+        free(f32);
+        free(kv);
+
+        return;
+    }
+
+    printf("\ntyped sort vs radix sort, %d random elements, ms:\n",
+           BENCH_SIZE);
+
+    for (round = 0; round < 2; round++)
+    {
+        for (i = 0; i < BENCH_SIZE; i++)
+        {
+            u64[i] = NextRand();
+            i32[i] = (int32_t)u64[i];
+            f32[i] = (float)i32[i];
+            kv[i].key = u64[i] >> 32; /* a 32 bit column and its row index */
+            kv[i].value = i;
+        }
+
+        if (0 == round)
+        {
+            start = clock();
+            SortInt32(i32, BENCH_SIZE);
+            sort_ms[0] = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+            start = clock();
+            SortUint64(u64, BENCH_SIZE);
+            sort_ms[1] = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+            start = clock();
+            SortFloat(f32, BENCH_SIZE);
+            sort_ms[2] = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+            start = clock();
+            SortKeyValue(kv, BENCH_SIZE);
+            sort_ms[3] = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+        }
+        else
+        {
+            start = clock();
+            RadixSortInt32(i32, BENCH_SIZE);
+            radix_ms[0] = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+            start = clock();
+            RadixSortUint64(u64, BENCH_SIZE);
+            radix_ms[1] = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+            start = clock();
+            RadixSortFloat(f32, BENCH_SIZE);
+            radix_ms[2] = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+            start = clock();
+            RadixSortKeyValue(kv, BENCH_SIZE);
+            radix_ms[3] = (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+        }
+    }
+
+    printf("%-12s %10s %10s %10s %14s\n", "",
+           "int32", "uint64", "float", "32 bit + idx");
+    printf("%-12s %10.0f %10.0f %10.0f %14.0f\n", "typed sort",
+           sort_ms[0], sort_ms[1], sort_ms[2], sort_ms[3]);
+    printf("%-12s %10.0f %10.0f %10.0f %14.0f\n", "radix sort",
+           radix_ms[0], radix_ms[1], radix_ms[2], radix_ms[3]);
+
+    free(i32);
+    free(u64);
+    free(f32);
+    free(kv);
+}
+
+/******************** HELPER FUNCS ********************/
+/* 0 random, 1 sorted, 2 reversed, 3 few unique. the random pattern uses */
+/* all 64 bits, so casting it down gives negatives too                   */
+static uint64_t FillValue(size_t i, size_t size, int pattern)
+{
+    switch (pattern)
+    {
+        case 0:
+            return NextRand();
+        case 1:
+            return i;
+        case 2:
+            return size - i;
+        default:
+            return NextRand() % 8;
+    }
+}
+
+/* xorshift64 */
+static uint64_t NextRand(void)
+{
+    g_seed ^= g_seed << 13;
+    g_seed ^= g_seed >> 7;
+    g_seed ^= g_seed << 17;
+
+    return g_seed;
+}
+
+static int CmpInt32(const void *a, const void *b)
+{
+    int32_t lhs = *(const int32_t *)a;
+    int32_t rhs = *(const int32_t *)b;
+
+    return ((lhs > rhs) - (lhs < rhs));
+}
+
+static int CmpInt64(const void *a, const void *b)
+{
+    int64_t lhs = *(const int64_t *)a;
+    int64_t rhs = *(const int64_t *)b;
+
+    return ((lhs > rhs) - (lhs < rhs));
+}
+
+static int CmpUint64(const void *a, const void *b)
+{
+    uint64_t lhs = *(const uint64_t *)a;
+    uint64_t rhs = *(const uint64_t *)b;
+
+    return ((lhs > rhs) - (lhs < rhs));
+}
+
+static int CmpDouble(const void *a, const void *b)
+{
+    double lhs = *(const double *)a;
+    double rhs = *(const double *)b;
+
+    return ((lhs > rhs) - (lhs < rhs));
+}
+
+static int CmpKeyValue(const void *a, const void *b)
+{
+    uint64_t lhs = ((const sort_kv_t *)a)->key;
+    uint64_t rhs = ((const sort_kv_t *)b)->key;
+
+    return ((lhs > rhs) - (lhs < rhs));
+}
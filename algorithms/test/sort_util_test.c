@@ -0,0 +1,92 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
+#define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
+
+#include <stdio.h> /* printf */
+#include <string.h> /* memcmp */
+
+#include "sort_util.h" /* sort_elem_t */
+
+typedef struct odd_elem
+{
+    char bytes[3]; /* not a multiple of a short, swapped a byte at a time */
+} odd_elem_t;
+
+/******************** FORWARD DECLARATIONS ********************/
+static int TestFlow(void);
+static int CmpLong(const void *a, const void *b);
+
+/******************** TESTS ********************/
+static int TestFlow(void)
+{
+    long longs[2] = {7, -3};
+    int ints[2] = {5, -1};
+    odd_elem_t odds[2] = {{{'a', 'b', 'c'}}, {{'x', 'y', 'z'}}};
+    sort_elem_t elem;
+
+    SortElemInit(&elem, longs, sizeof(long), CmpLong);
+    if (sizeof(long) != elem.unit ||
+        !SORT_LESS((char *)&longs[1], (char *)&longs[0], &elem))
+    {
+        return (1);
+    }
+
+    SORT_SWAP_ELEM((char *)&longs[0], (char *)&longs[1], &elem);
+    if (-3 != longs[0] || 7 != longs[1])
+    {
+        return (2);
+    }
+
+    SortElemInit(&elem, ints, sizeof(int), CmpLong);
+    SORT_SWAP_ELEM((char *)&ints[0], (char *)&ints[1], &elem);
+    if (sizeof(int) != elem.unit || -1 != ints[0] || 5 != ints[1])
+    {
+        return (3);
+    }
+
+    SortElemInit(&elem, odds, sizeof(odd_elem_t), CmpLong);
+    SORT_SWAP_ELEM((char *)&odds[0], (char *)&odds[1], &elem);
+    if (1 != elem.unit || 0 != memcmp(odds[0].bytes, "xyz", 3) ||
+                           0 != memcmp(odds[1].bytes, "abc", 3))
+    {
+        return (4);
+    }
+
+    if (0 != SortLog2(0) || 0 != SortLog2(1) || 1 != SortLog2(3) ||
+        10 != SortLog2(1024) || 10 != SortLog2(2047))
+    {
+        return (5);
+    }
+
+    return (0);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static int CmpLong(const void *a, const void *b)
+{
+    long left = *(const long *)a;
+    long right = *(const long *)b;
+
+    return ((left > right) - (left < right));
+}
+
+/******************** MAIN ********************/
+int main()
+{
+    int test_status = TestFlow();
+
+    if(test_status == 0)
+    {
+        printf("Sort Helpers| ALL TESTS: %s\n", PASS);
+    }
+    else
+    {
+        printf("Sort Helpers| %s AT %d \n", FAIL, test_status);
+    }
+
+    return (test_status);
+}
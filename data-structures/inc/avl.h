@@ -35,7 +35,19 @@ typedef int (*action_func_t)(void *avl_data, void *params);
 /******************************************************************************/
 avl_t *AVLCreate(cmp_func_t cmp_func);
 
-/* Complexity: O(n)                                                          */
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates a new empty AVL Tree whose nodes are allocated from  */
+/*               a private pool (see pool.h)                                  */
+/* Arguments:    cmp_func - comparison function for sorting elements          */
+/*               nodes_per_slab - number of nodes allocated at once           */
+/* Return value: returns a pointer to the newly created AVL tree              */
+/* Note:         destroying the tree frees the pool's slabs without walking   */
+/*               the nodes                                                    */
+/******************************************************************************/
+avl_t *AVLCreateWithPool(cmp_func_t cmp_func, size_t nodes_per_slab);
+
+/* Complexity: O(n), O(number of slabs) for a pooled tree                   */
 /******************************************************************************/
 /* Description:  destroys the AVL tree and frees all associated memory        */
 /* Arguments:    avl - pointer to the AVL tree                                */
@@ -70,7 +82,7 @@ void AVLRemove(avl_t *avl, void *data);
 /******************************************************************************/
 void *AVLFind(const avl_t *avl, const void *data);
 
-/* Complexity: O(n)                                                          */
+/* Complexity: O(1)                                                          */
 /******************************************************************************/
 /* Description:  returns the number of elements in the AVL tree               */
 /* Arguments:    avl - pointer to the AVL tree                                */
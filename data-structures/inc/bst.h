@@ -33,7 +33,19 @@ typedef struct tree bst_t;
 /******************************************************************************/
 bst_t *BSTCreate(cmp_func_t cmp_func);
 
-/* Complexity: O(n)                                                          */
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates an empty Binary Search Tree whose nodes are          */
+/*               allocated from a private pool (see pool.h)                   */
+/* Arguments:    cmp_func - function to define how to sort the tree           */
+/*               nodes_per_slab - number of nodes allocated at once           */
+/* Return value: returns a pointer to the newly created tree                  */
+/* Note:         destroying the tree frees the pool's slabs without walking   */
+/*               the nodes                                                    */
+/******************************************************************************/
+bst_t *BSTCreateWithPool(cmp_func_t cmp_func, size_t nodes_per_slab);
+
+/* Complexity: O(n), O(number of slabs) for a pooled tree                   */
 /******************************************************************************/
 /* Description:  removes the tree from memory                                 */
 /* Arguments:    bst - pointer to the tree to be removed                      */
@@ -100,9 +112,9 @@ bst_iter_t BSTInsert(bst_t *bst, void *data);
 /******************************************************************************/
 void BSTRemove(bst_iter_t iter);
 
-/* Complexity: O(n)                                                          */
+/* Complexity: O(1)                                                          */
 /******************************************************************************/
-/* Description:  counts the number of nodes in the tree                       */
+/* Description:  returns the number of nodes in the tree, kept as a counter  */
 /* Arguments:    bst - pointer to the tree                                    */
 /* Return value: returns the number of nodes in the tree as size_t            */
 /******************************************************************************/
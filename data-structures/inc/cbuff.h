@@ -9,6 +9,16 @@ A circular buffer (also known as a ring buffer or cyclic buffer) is a data
 structure that uses a single, fixed-size buffer as if it were connected 
 end-to-end. This implementation is byte-oriented and efficient for buffering 
 data streams.
+
+The span functions hand out the free or the filled bytes in place, as up to
+two contiguous pieces - the second one is where the ring wraps around. They
+let a producer read(2) from a socket straight into the buffer and a parser
+look at the bytes without copying them out first.
+
+A mirrored buffer maps the same pages twice, back to back, so the bytes
+past its end are its first bytes again. Its spans never wrap - the second
+one is always empty - and CBuffReadv/CBuffWritev move its data to or from a
+file descriptor in a single piece. Linux only (memfd_create).
 */
 
 #ifndef CBUFF_H
@@ -19,6 +29,12 @@ data streams.
 
 typedef struct cbuff cbuff_t;
 
+typedef struct cbuff_span
+{
+	void *data;
+	size_t size; /* 0 for an unused span */
+} cbuff_span_t;
+
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
 /* Description:  creates an empty circular buffer                             */
@@ -27,6 +43,15 @@ typedef struct cbuff cbuff_t;
 /******************************************************************************/
 cbuff_t *CBuffCreate(size_t capacity);
 
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates an empty circular buffer mapped twice in a row       */
+/* Arguments:    capacity - minimum number of bytes the buffer can hold       */
+/* Return value: returns a pointer to the new buffer, or NULL on failure      */
+/* Note:         the capacity is rounded up to a multiple of the page size    */
+/******************************************************************************/
+cbuff_t *CBuffCreateMirrored(size_t capacity);
+
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
 /* Description:  removes the circular buffer from memory                      */
@@ -79,4 +104,70 @@ size_t CBuffSize(const cbuff_t *buffer);
 /******************************************************************************/
 size_t CBuffFreeSpace(const cbuff_t *buffer);
 
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  finds room for up to 'count' bytes, without writing any      */
+/* Arguments:    buffer - pointer to the circular buffer                      */
+/*               count - maximum number of bytes to reserve                   */
+/*               spans - receives the free bytes, in the order they are read  */
+/* Return value: returns the number of bytes reserved, 0 if it is full        */
+/* Note:         the bytes are not in the buffer until CBuffWriteCommit       */
+/******************************************************************************/
+size_t CBuffWriteReserve(cbuff_t *buffer, size_t count, cbuff_span_t spans[2]);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  adds the first 'count' reserved bytes to the buffer          */
+/* Arguments:    buffer - pointer to the circular buffer                      */
+/*               count - number of bytes filled, at most the number reserved  */
+/* Return value: does not return anything                                     */
+/******************************************************************************/
+void CBuffWriteCommit(cbuff_t *buffer, size_t count);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  finds up to 'count' of the oldest bytes, without reading any */
+/* Arguments:    buffer - pointer to the circular buffer                      */
+/*               count - maximum number of bytes to peek at                   */
+/*               spans - receives the bytes, oldest first                     */
+/* Return value: returns the number of bytes found, 0 if it is empty          */
+/* Note:         the bytes stay in the buffer until CBuffReadConsume          */
+/******************************************************************************/
+size_t CBuffReadPeek(cbuff_t *buffer, size_t count, cbuff_span_t spans[2]);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  removes the 'count' oldest bytes from the buffer             */
+/* Arguments:    buffer - pointer to the circular buffer                      */
+/*               count - number of bytes used, at most CBuffSize              */
+/* Return value: does not return anything                                     */
+/******************************************************************************/
+void CBuffReadConsume(cbuff_t *buffer, size_t count);
+
+/* Complexity: O(1) system call                                              */
+/******************************************************************************/
+/* Description:  reads up to 'count' bytes from 'fd' straight into the buffer */
+/* Arguments:    buffer - pointer to the circular buffer                      */
+/*               fd - file descriptor to read from                            */
+/*               count - maximum number of bytes to read                      */
+/* Return value: returns what readv(2) returns, or 0 without calling it if   */
+/*               the buffer is full or count is 0                             */
+/* Note:         -1 always comes from readv(2), with errno set. A 0 with free */
+/*               space in the buffer is the end of the file                   */
+/******************************************************************************/
+ssize_t CBuffReadv(cbuff_t *buffer, int fd, size_t count);
+
+/* Complexity: O(1) system call                                              */
+/******************************************************************************/
+/* Description:  writes up to 'count' of the oldest bytes straight to 'fd'    */
+/* Arguments:    buffer - pointer to the circular buffer                      */
+/*               fd - file descriptor to write to                             */
+/*               count - maximum number of bytes to write                     */
+/* Return value: returns what writev(2) returns, or 0 without calling it if  */
+/*               the buffer is empty or count is 0                            */
+/* Note:         only the bytes written are removed from the buffer. -1       */
+/*               always comes from writev(2), with errno set                  */
+/******************************************************************************/
+ssize_t CBuffWritev(cbuff_t *buffer, int fd, size_t count);
+
 #endif /* CBUFF_H */
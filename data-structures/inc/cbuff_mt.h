@@ -0,0 +1,149 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Circular Buffer (Lock Free Implementation)
+
+Description:
+Two thread safe circular buffers that take no lock.
+
+The SPSC buffer is the byte stream of cbuff.h for exactly one writer thread
+and one reader thread, e.g. an I/O thread feeding a parser. The writer only
+ever moves the tail and the reader only ever moves the head, each on its own
+cache line, so the two threads share nothing but the bytes in flight. Both
+indices run freely and are masked into the buffer, the capacity is rounded
+up to a power of two.
+
+The MPMC buffer is for any number of writers and readers. A byte stream
+cannot be shared that way - two partial writes would interleave - so it
+holds fixed size elements instead. Every slot carries a sequence number
+that tells a writer when the slot is free and a reader when it is full, so
+writers and readers claim slots with a single compare and swap.
+
+Link with -pthread (make TARGET=cbuff_mt AF=-pthread).
+*/
+
+#ifndef CBUFF_MT_H
+#define CBUFF_MT_H
+
+#include <stddef.h> /* size_t */
+#include <sys/types.h> /* ssize_t */
+
+typedef struct cbuff_spsc cbuff_spsc_t;
+typedef struct cbuff_mpmc cbuff_mpmc_t;
+
+/******************** SPSC ********************/
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates an empty single producer single consumer buffer      */
+/* Arguments:    capacity - minimum number of bytes the buffer can hold       */
+/* Return value: returns a pointer to the new buffer, or NULL on failure      */
+/* Note:         the capacity is rounded up to a power of two                 */
+/******************************************************************************/
+cbuff_spsc_t *CBuffSPSCCreate(size_t capacity);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  removes the buffer from memory                               */
+/* Arguments:    buffer - pointer to the buffer                               */
+/* Return value: does not return anything                                     */
+/* Note:         not thread safe - neither side may still use the buffer      */
+/******************************************************************************/
+void CBuffSPSCDestroy(cbuff_spsc_t *buffer);
+
+/* Complexity: O(n)                                                          */
+/******************************************************************************/
+/* Description:  writes up to 'count' bytes from 'src' into the buffer        */
+/* Arguments:    buffer - pointer to the buffer                               */
+/*               src - pointer to the source memory                           */
+/*               count - maximum number of bytes to write                     */
+/* Return value: returns the number of bytes written, or -1 if it is full     */
+/* Note:         call from the producer thread only                           */
+/******************************************************************************/
+ssize_t CBuffSPSCWrite(cbuff_spsc_t *buffer, const void *src, size_t count);
+
+/* Complexity: O(n)                                                          */
+/******************************************************************************/
+/* Description:  reads up to 'count' bytes from the buffer into 'dest'        */
+/* Arguments:    buffer - pointer to the buffer                               */
+/*               dest - pointer to the destination memory                     */
+/*               count - maximum number of bytes to read                      */
+/* Return value: returns the number of bytes read, or -1 if it is empty       */
+/* Note:         call from the consumer thread only                           */
+/******************************************************************************/
+ssize_t CBuffSPSCRead(cbuff_spsc_t *buffer, void *dest, size_t count);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  returns the number of bytes currently in the buffer          */
+/* Arguments:    buffer - pointer to the buffer                               */
+/* Return value: returns the number of bytes, a snapshot while in use         */
+/******************************************************************************/
+size_t CBuffSPSCSize(const cbuff_spsc_t *buffer);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  returns the capacity of the buffer                           */
+/* Arguments:    buffer - pointer to the buffer                               */
+/* Return value: returns the number of bytes the buffer can hold              */
+/******************************************************************************/
+size_t CBuffSPSCCapacity(const cbuff_spsc_t *buffer);
+
+/******************** MPMC ********************/
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates an empty multi producer multi consumer buffer        */
+/* Arguments:    capacity - minimum number of elements the buffer can hold    */
+/*               element_size - size of each element in bytes                 */
+/* Return value: returns a pointer to the new buffer, or NULL on failure      */
+/* Note:         the capacity is rounded up to a power of two, at least 2     */
+/******************************************************************************/
+cbuff_mpmc_t *CBuffMPMCCreate(size_t capacity, size_t element_size);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  removes the buffer from memory                               */
+/* Arguments:    buffer - pointer to the buffer                               */
+/* Return value: does not return anything                                     */
+/* Note:         not thread safe - no thread may still use the buffer         */
+/******************************************************************************/
+void CBuffMPMCDestroy(cbuff_mpmc_t *buffer);
+
+/* Complexity: O(1), retries while other writers win the slot                */
+/******************************************************************************/
+/* Description:  copies one element into the buffer                           */
+/* Arguments:    buffer - pointer to the buffer                               */
+/*               element - pointer to element_size bytes                      */
+/* Return value: returns 0 on success, or -1 if the buffer is full            */
+/* Note:         thread safe                                                  */
+/******************************************************************************/
+int CBuffMPMCPush(cbuff_mpmc_t *buffer, const void *element);
+
+/* Complexity: O(1), retries while other readers win the slot                */
+/******************************************************************************/
+/* Description:  copies the oldest element out of the buffer                  */
+/* Arguments:    buffer - pointer to the buffer                               */
+/*               dest - receives element_size bytes                           */
+/* Return value: returns 0 on success, or -1 if the buffer is empty           */
+/* Note:         thread safe. elements written by one thread are read in the  */
+/*               order they were written                                      */
+/******************************************************************************/
+int CBuffMPMCPop(cbuff_mpmc_t *buffer, void *dest);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  returns the number of elements currently in the buffer       */
+/* Arguments:    buffer - pointer to the buffer                               */
+/* Return value: returns the number of elements, a snapshot while in use      */
+/******************************************************************************/
+size_t CBuffMPMCSize(const cbuff_mpmc_t *buffer);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  returns the capacity of the buffer                           */
+/* Arguments:    buffer - pointer to the buffer                               */
+/* Return value: returns the number of elements the buffer can hold           */
+/******************************************************************************/
+size_t CBuffMPMCCapacity(const cbuff_mpmc_t *buffer);
+
+#endif /* CBUFF_MT_H */
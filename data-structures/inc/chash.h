@@ -0,0 +1,97 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Concurrent Hash Table
+
+Description:
+A thread safe chained hash table built on the same hash_func_t and
+hash_cmp_func_t callbacks as hash_t (see hash.h).
+
+Writers (insert and remove) lock only the stripe that guards their bucket,
+so writers on different stripes run in parallel. Finds take no lock at
+all: buckets are published with atomic release stores, and nodes that are
+removed are reclaimed with an epoch scheme - a removed node is freed only
+after every find that could still be looking at it has finished.
+
+The number of buckets is fixed at creation time. Link with -pthread
+(make TARGET=chash AF=-pthread).
+*/
+
+#ifndef CHASH_H
+#define CHASH_H
+
+#include <stddef.h> /* size_t */
+
+#include "hash.h" /* hash_func_t, hash_cmp_func_t, status_t */
+
+typedef struct chash chash_t;
+
+/* Complexity: O(table_size + num_locks)                                      */
+/******************************************************************************/
+/* Description:  Creates a new concurrent hash table.                         */
+/* Arguments:    hash_func - pointer to the hash function to be used.         */
+/* cmp_func - pointer to the comparison function to be used.    */
+/* table_size - The number of buckets.                          */
+/* num_locks - The number of lock stripes, every stripe guards  */
+/* table_size / num_locks buckets.                              */
+/* Return value: A pointer to the created hash table, or NULL on failure.     */
+/******************************************************************************/
+chash_t *CHashCreate(hash_func_t hash_func, hash_cmp_func_t cmp_func,
+                                        size_t table_size, size_t num_locks);
+
+/* Complexity: O(n + table_size)                                              */
+/******************************************************************************/
+/* Description:  Destroys the given hash table and frees all associated memory*/
+/* Arguments:    hash - A pointer to the hash table to be destroyed.          */
+/* Return value: None.                                                        */
+/* Note:         Not thread safe - no other thread may use the table.         */
+/******************************************************************************/
+void CHashDestroy(chash_t *hash);
+
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Inserts a new value into the hash table. Thread safe.        */
+/* Arguments:    hash - A pointer to the hash table.                          */
+/* value - A pointer to the value to be inserted.               */
+/* Return value: SUCCESS (0) or FAIL (1) indicating the result.               */
+/******************************************************************************/
+status_t CHashInsert(chash_t *hash, const void *value);
+
+/* Complexity: O(1) average, O(n) worst                                       */
+/******************************************************************************/
+/* Description:  Removes a value from the hash table. Thread safe.            */
+/* Arguments:    hash - A pointer to the hash table.                          */
+/* value - A pointer to the value to be removed.                */
+/* Return value: None.                                                        */
+/* Note:         Every few removes the caller waits for the finds that        */
+/* started before the removal to finish, then frees the nodes.  */
+/******************************************************************************/
+void CHashRemove(chash_t *hash, const void *value);
+
+/* Complexity: O(1) average, O(n) worst                                       */
+/******************************************************************************/
+/* Description:  Finds a value in the hash table. Thread safe and lock free.  */
+/* Arguments:    hash - A pointer to the hash table.                          */
+/* value - A pointer to the value to be found.                  */
+/* Return value: A pointer to the found value, or NULL if not present.        */
+/******************************************************************************/
+void *CHashFind(const chash_t *hash, const void *value);
+
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Returns the number of elements stored in the hash table.     */
+/* Arguments:    hash - A pointer to the hash table.                          */
+/* Return value: The number of elements, a snapshot if writers are running.   */
+/******************************************************************************/
+size_t CHashSize(const chash_t *hash);
+
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Checks if the hash table contains any elements.              */
+/* Arguments:    hash - A pointer to the hash table.                          */
+/* Return value: 1 if the hash table is empty, 0 otherwise.                   */
+/******************************************************************************/
+int CHashIsEmpty(const chash_t *hash);
+
+#endif /* CHASH_H */
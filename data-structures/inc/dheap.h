@@ -0,0 +1,102 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+D-ary Heap
+
+Description:
+A min-heap in which every node has d children instead of two. The tree is
+shallower (log_d n levels), so a push compares against fewer parents, and
+a pop walks down fewer levels - each level picks the smallest of d
+siblings that sit next to each other in memory.
+
+The elements are kept in a plain array of pointers, accessed directly. The
+array is cache line aligned and shifted so that the children of every node
+start on a group boundary: with 8 byte pointers, the 8 children of an
+8-ary node fill exactly one cache line, and the 4 children of a 4-ary node
+one half of a line.
+
+Same callbacks and status codes as heap.h.
+*/
+
+#ifndef DHEAP_H
+#define DHEAP_H
+
+#include <stddef.h> /* size_t */
+
+#include "heap.h" /* heap_cmp_func_t, heap_match_func_t, status_t */
+
+typedef struct dheap dheap_t;
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates a new empty d-ary heap                               */
+/* Arguments:    cmp_func - function to define the heap priority              */
+/*               arity - number of children per node, at least 2. 4 and 8     */
+/*               keep every group of siblings inside a single cache line      */
+/* Return value: returns a pointer to the newly created heap, or NULL         */
+/******************************************************************************/
+dheap_t *DHeapCreate(heap_cmp_func_t cmp_func, size_t arity);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  destroys the heap and frees all associated memory            */
+/* Arguments:    heap - pointer to the heap                                   */
+/* Return value: does not return anything                                     */
+/******************************************************************************/
+void DHeapDestroy(dheap_t *heap);
+
+/* Complexity: O(log n / log d) amortized                                    */
+/******************************************************************************/
+/* Description:  inserts a new element into the heap                          */
+/* Arguments:    heap - pointer to the heap                                   */
+/*               data - pointer to the data to be inserted                    */
+/* Return value: returns SUCCESS (0) if successful, FAILURE otherwise         */
+/******************************************************************************/
+status_t DHeapPush(dheap_t *heap, void *data);
+
+/* Complexity: O(d * log n / log d)                                          */
+/******************************************************************************/
+/* Description:  removes the top element from the heap                        */
+/* Arguments:    heap - pointer to the heap                                   */
+/* Return value: returns a pointer to the removed element                     */
+/* Note:         popping from an empty heap results in undefined behavior.    */
+/******************************************************************************/
+void *DHeapPop(dheap_t *heap);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  returns the top element of the heap without removing it      */
+/* Arguments:    heap - pointer to the heap                                   */
+/* Return value: returns a pointer to the top element, or NULL if empty       */
+/******************************************************************************/
+void *DHeapPeek(const dheap_t *heap);
+
+/* Complexity: O(n)                                                          */
+/******************************************************************************/
+/* Description:  removes the first element matching the condition             */
+/* Arguments:    heap - pointer to the heap                                   */
+/*               match_func - function to define matching condition           */
+/*               params - parameters for the match function                   */
+/* Return value: returns pointer to the removed data, or NULL if not found    */
+/******************************************************************************/
+void *DHeapRemove(dheap_t *heap, heap_match_func_t match_func,
+                                                        const void *params);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  checks if the heap is empty                                  */
+/* Arguments:    heap - pointer to the heap                                   */
+/* Return value: returns 1 if empty, 0 otherwise                              */
+/******************************************************************************/
+int DHeapIsEmpty(const dheap_t *heap);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  returns the number of elements in the heap                   */
+/* Arguments:    heap - pointer to the heap                                   */
+/* Return value: returns the number of elements                               */
+/******************************************************************************/
+size_t DHeapSize(const dheap_t *heap);
+
+#endif /* DHEAP_H */
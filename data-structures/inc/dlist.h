@@ -15,6 +15,8 @@ the next node of the linked list.
 
 #include <stddef.h>
 
+#include "pool.h" /* pool_t */
+
 typedef struct dlist dlist_t;
 typedef struct dlist_node *dlist_iter_t;
 
@@ -46,9 +48,31 @@ typedef int (*action_func_t)(void *data, void *param);
 /******************************************************************************/
 dlist_t *DListCreate();
 
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates a pool (see pool.h) sized for list nodes, to be      */
+/*               shared by any number of lists                                */
+/* Arguments:    nodes_per_slab - number of nodes allocated at once           */
+/* Return value: returns a pointer to the pool, NULL on failure               */
+/* Note:         the pool is freed with PoolDestroy, after every list that    */
+/*               uses it was destroyed                                        */
+/******************************************************************************/
+pool_t *DListCreatePool(size_t nodes_per_slab);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates an empty Doubly Linked List whose nodes are          */
+/*               allocated from a pool created with DListCreatePool           */
+/* Arguments:    pool - the pool, it is not owned by the list                 */
+/* Return value: returns a pointer to the newly created list                  */
+/* Note:         nodes can be spliced only between lists on the same pool.    */
+/******************************************************************************/
+dlist_t *DListCreateWithPool(pool_t *pool);
+
 /* Complexity: O(n)                                                          */
 /******************************************************************************/
-/* Description:  removes the list from memory                                 */
+/* Description:  removes the list from memory, a pooled list returns its     */
+/*               nodes to the pool                                            */
 /* Arguments:    list - pointer to the list to be removed                     */
 /* Return value: does not return anything                                     */
 /* Note:         removing from empty list will result in undefined behavior   */
@@ -99,22 +123,24 @@ int DListIsIterSame(dlist_iter_t iter1, dlist_iter_t iter2);
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
 /* Description:  inserts a new node to the list                               */
-/* Arguments:    where - location in the list where the new node is to be     */ 
+/* Arguments:    list - pointer to the list that holds where                  */
+/* where - location in the list where the new node is to be     */ 
 /* inserted.                                                    */
 /* data - pointer to the data to be inserted in the node        */
 /* Return value: returns a pointer to the newly inserted node                 */
 /******************************************************************************/
-dlist_iter_t DListInsert(dlist_iter_t where, void* data);
+dlist_iter_t DListInsert(dlist_t *list, dlist_iter_t where, void* data);
 
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
 /* Description:  removes a given node from the list                           */
-/* Arguments:    to_remove - a pointer to the node to be removed              */
+/* Arguments:    list - pointer to the list that holds to_remove              */
+/* to_remove - a pointer to the node to be removed              */
 /* Return value: returns a pointer to the next node                           */
 /* Note:         after removing a node, previous nodes held by user in        */
 /* iterators may be corrupted.                                  */
 /******************************************************************************/
-dlist_iter_t DListRemove(dlist_iter_t to_remove);
+dlist_iter_t DListRemove(dlist_t *list, dlist_iter_t to_remove);
 
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
@@ -133,9 +159,9 @@ void *DListGetData(dlist_iter_t iter);
 /******************************************************************************/
 void DListSetData(dlist_iter_t iter, void *data);
 
-/* Complexity: O(n)                                                          */
+/* Complexity: O(1)                                                          */
 /******************************************************************************/
-/* Description:  counts the number of nodes in the list                       */
+/* Description:  returns the number of nodes in the list, kept as a counter  */
 /* Arguments:    list - pointer to the list                                   */
 /* Return value: returns the number of nodes in the list as size_t            */
 /******************************************************************************/
@@ -184,22 +210,27 @@ int DListForEach(dlist_iter_t from,
                 action_func_t action,
                 void *param);
 
-/* Complexity: O(1)                                                          */
+/* Complexity: O(1) within a list, O(k) when moving k elements to another   */
 /******************************************************************************/
 /* Description:  moves a given range of elements in one list                  */
 /* into a different location in the same list,                  */
 /* or in a location in another list                             */
-/* Arguments:    from - the beginning of the range                            */
+/* Arguments:    src - pointer to the list that holds the range               */
+/* from - the beginning of the range                            */
 /* to - the end of the range that is excluded                   */
 /* from the move                                           */
+/* dest - pointer to the target list, may be src                */
 /* where - the position in the target list before               */
 /* which the elements will be inserted                  */
 /* Return value: None                                                         */
 /* Note:         inserting invalid from, to and where arguments               */
-/* will lead to undefined behavior                              */
+/* will lead to undefined behavior. Both lists must use the     */
+/* same allocator (malloc, or the same pool).                   */
 /******************************************************************************/
-void DListSplice(dlist_iter_t from, 
+void DListSplice(dlist_t *src,
+                dlist_iter_t from, 
                 dlist_iter_t to,
+                dlist_t *dest,
                 dlist_iter_t where);
 
 /* Complexity: O(n)                                                          */
@@ -9,6 +9,11 @@ A dynamic vector (also known as a dynamic array) is a random access,
 variable-size list data structure that allows elements to be added or removed. 
 It automatically grows or shrinks its capacity based on the number of elements 
 it contains to optimize memory usage and performance.
+
+A small vector (DVectorCreateSmall) keeps its first elements inline, in the 
+same allocation as the vector itself. It spills to a heap buffer only once it 
+outgrows them, and moves back in when it shrinks to fit again - a short 
+vector costs a single malloc. Every other function works the same on both.
 */
 
 #ifndef DVECTOR_H
@@ -19,18 +24,35 @@ it contains to optimize memory usage and performance.
 typedef struct dvector dvector_t;
 
 /* Growth/Shrink policy:                                                     */
-/* - If size >= 75% of capacity: Grow (capacity * 2)                         */
-/* - If size <= 25% of capacity: Shrink (capacity / 2)                       */
+/* - If a push finds the vector full: Grow (capacity * 2)                    */
+/* - If a pop leaves size <= 25% of capacity: Shrink (capacity / 2), never   */
+/*   below the capacity the vector was created with                          */
+/* Either way the vector is left half full, so pushing and popping around    */
+/* one size reallocates at most once per capacity / 4 operations.            */
 
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
 /* Description:  creates an empty Dynamic Vector                              */
 /* Arguments:    capacity - initial number of elements the vector can hold    */
 /*               element_size - size of each element in bytes                 */
-/* Return value: returns a pointer to the newly created vector                */
+/* Return value: returns a pointer to the newly created vector, or NULL on    */
+/*               failure                                                      */
+/* Note:         a capacity of 0 is taken as 1                                */
 /******************************************************************************/
 dvector_t *DVectorCreate(size_t capacity , size_t element_size);
 
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates an empty Dynamic Vector with an inline buffer        */
+/* Arguments:    inline_capacity - number of elements kept inline             */
+/*               element_size - size of each element in bytes                 */
+/* Return value: returns a pointer to the newly created vector, or NULL on    */
+/*               failure                                                      */
+/* Note:         a capacity of 0 is taken as 1. the capacity never drops      */
+/*               below inline_capacity                                        */
+/******************************************************************************/
+dvector_t *DVectorCreateSmall(size_t inline_capacity, size_t element_size);
+
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
 /* Description:  removes the vector from memory                               */
@@ -56,18 +78,53 @@ void *DvectorGetAccessToElement(const dvector_t *dvector, size_t idx);
 /* Arguments:    dvector - pointer to the vector                              */
 /*               data - pointer to the data to be added                       */
 /* Return value: returns 0 on success, or -1 on failure                       */
+/* Note:         on failure the vector is left unchanged                      */
 /******************************************************************************/
 int DvectorPushBack(dvector_t *dvector, const void *data);
 
+/* Complexity: O(n), at most one reallocation                                */
+/******************************************************************************/
+/* Description:  adds n elements to the end of the vector                     */
+/* Arguments:    dvector - pointer to the vector                              */
+/*               data - pointer to n consecutive elements                     */
+/*               n - number of elements to add                                */
+/* Return value: returns 0 on success, or -1 on failure                       */
+/* Note:         on failure the vector is left unchanged                      */
+/******************************************************************************/
+int DvectorPushBackMany(dvector_t *dvector, const void *data, size_t n);
+
+/* Complexity: O(size - idx + n), at most one reallocation                   */
+/******************************************************************************/
+/* Description:  inserts n elements before the element at idx                 */
+/* Arguments:    dvector - pointer to the vector                              */
+/*               idx - where the first new element goes, up to size           */
+/*               data - pointer to n consecutive elements                     */
+/*               n - number of elements to insert                             */
+/* Return value: returns 0 on success, or -1 on failure                       */
+/* Note:         on failure the vector is left unchanged. data must not point */
+/*               into the vector itself                                       */
+/******************************************************************************/
+int DvectorInsertRange(dvector_t *dvector, size_t idx, const void *data,
+					   size_t n);
+
+/* Complexity: O(n) when growing, O(1) otherwise                             */
+/******************************************************************************/
+/* Description:  sets the number of elements in the vector                    */
+/* Arguments:    dvector - pointer to the vector                              */
+/*               size - the new number of elements                            */
+/* Return value: returns 0 on success, or -1 on failure                       */
+/* Note:         new elements are zero filled. a smaller size keeps the       */
+/*               capacity, DvectorReserve or DvectorShrink release it         */
+/******************************************************************************/
+int DvectorResize(dvector_t *dvector, size_t size);
+
 /* Complexity: Amortized O(1)                                                */
 /******************************************************************************/
 /* Description:  removes the last element from the vector                     */
 /* Arguments:    dvector - pointer to the vector                              */
-/* Return value: does not return anything                                     */
-/* Note:         popping from an empty vector will result in undefined        */
-/*               behavior.                                                    */
+/* Return value: returns 0 on success, or -1 if the vector is empty           */
 /******************************************************************************/
-void DvectorPopBack(dvector_t *dvector);
+int DvectorPopBack(dvector_t *dvector);
 
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
@@ -91,6 +148,7 @@ size_t DvectorCapacity(const dvector_t *dvector);
 /* Arguments:    dvector - pointer to the vector                              */
 /*               capacity - the new desired capacity                          */
 /* Return value: returns 0 on success, or -1 on failure                       */
+/* Note:         a capacity below the size is taken as the size               */
 /******************************************************************************/
 int DvectorReserve(dvector_t *dvector, size_t capacity);
 
@@ -0,0 +1,113 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Flat Hash Table
+
+Description:
+A flat (open addressing) hash table stores its entries inline in one
+contiguous array instead of chaining them in per-bucket lists. Collisions
+are resolved with Robin Hood linear probing: an entry that is further from
+its home slot may displace an entry that is closer to its own, which keeps
+probe sequences short even at high load factors. The full hash of every
+entry is cached next to it, so most mismatching entries are rejected
+without calling the user comparison function.
+
+The table keeps the semantics of hash_t (see hash.h) and uses the same
+hash_func_t, hash_cmp_func_t and hash_action_func_t callbacks. The slot
+array grows automatically when the load factor crosses 15/16.
+*/
+
+#ifndef FHASH_H
+#define FHASH_H
+
+#include <stddef.h> /* size_t */
+
+#include "hash.h" /* hash_func_t, hash_cmp_func_t, status_t */
+
+typedef struct fhash fhash_t;
+
+/* Complexity: O(capacity)                                                    */
+/******************************************************************************/
+/* Description:  Creates a new flat hash table.                               */
+/* Arguments:    hash_func - pointer to the hash function to be used.         */
+/* cmp_func - pointer to the comparison function to be used.    */
+/* capacity - The initial number of slots, rounded up to the    */
+/* next power of two.                                           */
+/* Return value: A pointer to the created hash table, or NULL on failure.     */
+/******************************************************************************/
+fhash_t *FHashCreate(hash_func_t hash_func, hash_cmp_func_t cmp_func,
+                                                               size_t capacity);
+
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Destroys the given hash table and frees all associated memory*/
+/* Arguments:    hash - A pointer to the hash table to be destroyed.          */
+/* Return value: None.                                                        */
+/* Note:         The values themselves are not freed.                         */
+/******************************************************************************/
+void FHashDestroy(fhash_t *hash);
+
+/* Complexity: O(1) average, O(n) when the table grows                        */
+/******************************************************************************/
+/* Description:  Inserts a new value into the hash table.                     */
+/* Arguments:    hash - A pointer to the hash table.                          */
+/* value - A pointer to the value to be inserted (not NULL).    */
+/* Return value: SUCCESS (0) or FAIL (1) if the table failed to grow.         */
+/******************************************************************************/
+status_t FHashInsert(fhash_t *hash, const void *value);
+
+/* Complexity: O(1) average, O(n) worst                                       */
+/******************************************************************************/
+/* Description:  Removes a value from the hash table.                         */
+/* Arguments:    hash - A pointer to the hash table.                          */
+/* value - A pointer to the value to be removed.                */
+/* Return value: None.                                                        */
+/******************************************************************************/
+void FHashRemove(fhash_t *hash, const void *value);
+
+/* Complexity: O(1) average, O(n) worst                                       */
+/******************************************************************************/
+/* Description:  Finds a value in the hash table.                             */
+/* Arguments:    hash - A pointer to the hash table.                          */
+/* value - A pointer to the value to be found.                  */
+/* Return value: A pointer to the found value, or NULL if not present.        */
+/******************************************************************************/
+void *FHashFind(const fhash_t *hash, const void *value);
+
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Checks if the hash table contains any elements.              */
+/* Arguments:    hash - A pointer to the hash table.                          */
+/* Return value: 1 if the hash table is empty, 0 otherwise.                   */
+/******************************************************************************/
+int FHashIsEmpty(const fhash_t *hash);
+
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Returns the number of elements stored in the hash table.     */
+/* Arguments:    hash - A pointer to the hash table.                          */
+/* Return value: The number of elements in the hash table as size_t.          */
+/******************************************************************************/
+size_t FHashSize(const fhash_t *hash);
+
+/* Complexity: O(capacity)                                                    */
+/******************************************************************************/
+/* Description:  Applies a function to each element in the hash table.        */
+/* Arguments:    hash - A pointer to the hash table.                          */
+/* action - A function pointer to the action to be applied.     */
+/* params - pointer to additional parameters for the action.    */
+/* Return value: 0 if applied successfully to all elements, non-zero otherwise*/
+/* Note:         The action must not insert into or remove from the table.    */
+/******************************************************************************/
+int FHashForEach(fhash_t *hash, hash_action_func_t action, void *params);
+
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Computes the load factor of the hash table (elements/slots). */
+/* Arguments:    hash - A pointer to the hash table.                          */
+/* Return value: The load factor as a double.                                 */
+/******************************************************************************/
+double FHashLoadFactor(const fhash_t *hash);
+
+#endif /* FHASH_H */
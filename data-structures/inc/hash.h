@@ -9,6 +9,17 @@ A hash table is a data structure that implements an associative array abstract
 data type, a structure that can map keys to values. It uses a hash function 
 to compute an index into an array of buckets or slots, from which the desired 
 value can be found.
+
+The table grows when the load factor passes a maximum and shrinks (never
+below its initial size) when it drops under a minimum. Resizing is
+incremental: the new bucket array is allocated up front and a few old
+buckets are migrated on every insert, remove and find, so no single
+operation pays for a full rehash.
+
+Every entry is a single node in the chain of its bucket and caches the
+full hash of its value, so entries whose hashes differ are skipped without
+calling the comparison function, and a resize never calls the hash
+function again.
 */
 
 #ifndef HASH_H
@@ -64,6 +75,7 @@ typedef size_t (*hash_func_t)(const void *value);
 /* cmp_func - pointer to the comparison function to be used.    */
 /* table_size - The initial size of the hash table array.       */
 /* Return value: A pointer to the created hash table, or NULL on failure.     */
+/* Note:         The default load limits are 0.125 (min) and 1.0 (max).       */
 /******************************************************************************/
 hash_t *HashCreate(hash_func_t hash_func, hash_cmp_func_t cmp_func, size_t table_size);
 
@@ -75,6 +87,19 @@ hash_t *HashCreate(hash_func_t hash_func, hash_cmp_func_t cmp_func, size_t table
 /******************************************************************************/
 void HashDestroy(hash_t *hash);
 
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Sets the load factors that trigger growing and shrinking.    */
+/* Arguments:    hash - A pointer to the hash table.                          */
+/* min_load - The table halves below this load factor, 0 never  */
+/* shrinks.                                                     */
+/* max_load - The table doubles above this load factor.         */
+/* Return value: None.                                                        */
+/* Note:         min_load must be smaller than max_load / 2, otherwise a      */
+/* resize could immediately trigger the opposite resize.        */
+/******************************************************************************/
+void HashSetLoadLimits(hash_t *hash, double min_load, double max_load);
+
 /* Complexity: O(1) average, O(n) worst                                       */
 /******************************************************************************/
 /* Description:  Inserts a new value into the hash table.                     */
@@ -102,6 +127,21 @@ void HashRemove(hash_t *hash, const void *value);
 /******************************************************************************/
 void *HashFind(const hash_t *hash, const void *value);
 
+/* Complexity: O(n) average                                                   */
+/******************************************************************************/
+/* Description:  Finds a batch of values in the hash table. All the bucket    */
+/* indices of a batch are computed and prefetched before any of */
+/* them is probed, which hides memory latency on large tables.  */
+/* Arguments:    hash - A pointer to the hash table.                          */
+/* keys - An array of n pointers to the values to be found.     */
+/* n - The number of keys.                                      */
+/* out - An array of n pointers, out[i] receives the value that */
+/* matched keys[i], or NULL if it is not present.               */
+/* Return value: None.                                                        */
+/******************************************************************************/
+void HashFindMany(const hash_t *hash, const void *keys[], size_t n,
+                                                                void *out[]);
+
 /* Complexity: O(1)                                                           */
 /******************************************************************************/
 /* Description:  Checks if the hash table contains any elements.              */
@@ -110,7 +150,7 @@ void *HashFind(const hash_t *hash, const void *value);
 /******************************************************************************/
 int HashIsEmpty(const hash_t *hash);
 
-/* Complexity: O(1) or O(table_size) depending on implementation              */
+/* Complexity: O(1)                                                           */
 /******************************************************************************/
 /* Description:  Returns the number of elements stored in the hash table.     */
 /* Arguments:    hash - A pointer to the hash table.                          */
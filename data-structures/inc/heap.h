@@ -9,6 +9,15 @@ A heap is a specialized tree-based data structure that satisfies the heap
 property: in a min-heap, for any given node C, if P is a parent node of C, 
 then the key (the value) of P is less than or equal to the key of C. 
 This implementation provides a generic binary heap.
+
+An indexed heap (HeapCreateIndexed) also hands out a handle for every 
+element it holds. The heap keeps track of where each handle's element 
+sits, so an element can be removed, or re-positioned after its key 
+changed, in O(log n) without searching for it.
+
+A batch of elements is cheaper to build in one go: HeapCreateFrom and a 
+large HeapPushMany arrange the whole array bottom-up (Floyd's heapify) in 
+O(n) instead of sifting every element up on its own.
 */
 
 #ifndef OL_155_6_HEAP
@@ -17,6 +26,7 @@ This implementation provides a generic binary heap.
 #include <stddef.h> /* size_t */
 
 typedef struct heap heap_t;
+typedef struct heap_node *heap_handle_t;
 typedef int(*heap_cmp_func_t)(const void *data, const void *params);
 typedef int(*heap_match_func_t)(const void *data, const void *params);
 
@@ -34,6 +44,27 @@ typedef enum status
 /******************************************************************************/
 heap_t *HeapCreate(heap_cmp_func_t cmp_func);
 
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates a new empty indexed heap                             */
+/* Arguments:    cmp_func - function to define the heap priority              */
+/* Return value: returns a pointer to the newly created heap                  */
+/* Note:         all heap functions work on an indexed heap, the handle       */
+/*               functions work only on an indexed heap                       */
+/******************************************************************************/
+heap_t *HeapCreateIndexed(heap_cmp_func_t cmp_func);
+
+/* Complexity: O(n)                                                          */
+/******************************************************************************/
+/* Description:  creates a heap holding the given elements                    */
+/* Arguments:    array - the elements to insert, may be NULL if n is 0        */
+/*               n - number of elements in the array                          */
+/*               cmp_func - function to define the heap priority              */
+/* Return value: returns a pointer to the newly created heap, or NULL         */
+/* Note:         the pointers are copied, the array itself is not kept       */
+/******************************************************************************/
+heap_t *HeapCreateFrom(void **array, size_t n, heap_cmp_func_t cmp_func);
+
 /* Complexity: O(n)                                                          */
 /******************************************************************************/
 /* Description:  destroys the heap and frees all associated memory            */
@@ -51,6 +82,18 @@ void HeapDestroy(heap_t *heap);
 /******************************************************************************/
 status_t HeapPush(heap_t *heap, void *data);
 
+/* Complexity: O(n log size), O(size + n) for a batch larger than the heap   */
+/******************************************************************************/
+/* Description:  inserts a batch of elements into the heap                    */
+/* Arguments:    heap - pointer to the heap                                   */
+/*               array - the elements to insert                               */
+/*               n - number of elements in the array                          */
+/* Return value: returns SUCCESS (0) if successful, FAILURE otherwise         */
+/* Note:         on a plain heap a failure leaves the heap unchanged. an      */
+/*               indexed heap pushes one by one and does not return handles   */
+/******************************************************************************/
+status_t HeapPushMany(heap_t *heap, void **array, size_t n);
+
 /* Complexity: O(log n)                                                      */
 /******************************************************************************/
 /* Description:  removes the top element from the heap                        */
@@ -60,6 +103,17 @@ status_t HeapPush(heap_t *heap, void *data);
 /******************************************************************************/
 void HeapPop(heap_t *heap);
 
+/* Complexity: O(k log n)                                                    */
+/******************************************************************************/
+/* Description:  removes up to k top elements from the heap                   */
+/* Arguments:    heap - pointer to the heap                                   */
+/*               out - receives the removed elements in priority order        */
+/*               k - maximum number of elements to remove                     */
+/* Return value: returns the number of elements removed, less than k only     */
+/*               when the heap ran empty                                      */
+/******************************************************************************/
+size_t HeapPopMany(heap_t *heap, void **out, size_t k);
+
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
 /* Description:  returns the top element of the heap without removing it      */
@@ -78,6 +132,35 @@ void *HeapPeek(const heap_t *heap);
 /******************************************************************************/
 void *HeapRemove(heap_t *heap, heap_match_func_t match_func, const void *params);
 
+/* Complexity: O(log n)                                                      */
+/******************************************************************************/
+/* Description:  inserts a new element into an indexed heap                   */
+/* Arguments:    heap - pointer to an indexed heap                            */
+/*               data - pointer to the data to be inserted                    */
+/* Return value: returns the handle of the element, or NULL on failure        */
+/* Note:         the handle stays valid until the element leaves the heap     */
+/******************************************************************************/
+heap_handle_t HeapPushIndexed(heap_t *heap, void *data);
+
+/* Complexity: O(log n)                                                      */
+/******************************************************************************/
+/* Description:  removes the element of the given handle                      */
+/* Arguments:    heap - pointer to an indexed heap                            */
+/*               handle - handle of an element in the heap                    */
+/* Return value: returns pointer to the removed data                          */
+/******************************************************************************/
+void *HeapRemoveHandle(heap_t *heap, heap_handle_t handle);
+
+/* Complexity: O(log n)                                                      */
+/******************************************************************************/
+/* Description:  restores the heap order after the key of an element changed  */
+/* Arguments:    heap - pointer to an indexed heap                            */
+/*               handle - handle of the changed element                       */
+/* Return value: does not return anything                                     */
+/* Note:         works for both a decreased and an increased key              */
+/******************************************************************************/
+void HeapUpdateHandle(heap_t *heap, heap_handle_t handle);
+
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
 /* Description:  checks if the heap is empty                                  */
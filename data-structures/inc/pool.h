@@ -0,0 +1,73 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Pool Allocator
+
+Description:
+A fixed-size pool (slab) allocator. Elements of a single size are carved
+out of large slabs that are allocated on demand, so a container of N
+elements needs about N / elems_per_slab calls to malloc instead of N.
+Freed elements are kept on an intrusive free list and reused by the next
+allocation. Destroying the pool frees all of its slabs at once, without
+visiting the individual elements.
+
+The bst and avl containers can each be created on a private pool
+(BSTCreateWithPool and AVLCreateWithPool). The dlist and slist containers
+are created on a pool the caller owns and can share between lists
+(DListCreatePool and DListCreateWithPool, SListCreatePool and
+SListCreateWithPool), so nodes can move between lists on the same pool.
+*/
+
+#ifndef POOL_H
+#define POOL_H
+
+#include <stddef.h> /* size_t */
+
+typedef struct pool pool_t;
+
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Creates a new, empty pool. No slab is allocated yet.         */
+/* Arguments:    elem_size - The size of every element in bytes.              */
+/* elems_per_slab - The number of elements in every slab.       */
+/* Return value: A pointer to the created pool, or NULL on failure.           */
+/******************************************************************************/
+pool_t *PoolCreate(size_t elem_size, size_t elems_per_slab);
+
+/* Complexity: O(number of slabs)                                             */
+/******************************************************************************/
+/* Description:  Frees every slab of the pool and the pool itself.            */
+/* Arguments:    pool - A pointer to the pool.                                */
+/* Return value: None.                                                        */
+/* Note:         Every element allocated from the pool becomes invalid.       */
+/******************************************************************************/
+void PoolDestroy(pool_t *pool);
+
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Allocates one element from the pool.                         */
+/* Arguments:    pool - A pointer to the pool.                                */
+/* Return value: A pointer to the element, or NULL if a new slab was needed   */
+/* and could not be allocated.                                  */
+/******************************************************************************/
+void *PoolAlloc(pool_t *pool);
+
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Returns an element to the pool for reuse.                    */
+/* Arguments:    pool - A pointer to the pool.                                */
+/* elem - An element allocated from this pool.                  */
+/* Return value: None.                                                        */
+/******************************************************************************/
+void PoolFree(pool_t *pool, void *elem);
+
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Returns the number of elements currently allocated.          */
+/* Arguments:    pool - A pointer to the pool.                                */
+/* Return value: The number of elements allocated and not yet freed.          */
+/******************************************************************************/
+size_t PoolCount(const pool_t *pool);
+
+#endif /* POOL_H */
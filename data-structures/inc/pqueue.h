@@ -9,7 +9,9 @@ A priority queue is an abstract data type which is like a regular queue or
 stack data structure, but where additionally each element has a "priority" 
 associated with it. In a priority queue, an element with high priority is 
 served before an element with low priority. This implementation uses 
-a sorted linked list as the underlying container.
+a sorted list as the underlying container - the skip list one 
+(srtlist_skip.h), so enqueue takes O(log n) expected instead of a walk 
+from the head.
 */
 
 #ifndef P_Q
@@ -18,8 +20,8 @@ a sorted linked list as the underlying container.
 #include <stddef.h> /* size_t */
 
 typedef struct pq pq_t;
-typedef int (*cmp_func_t)(const void *data, const void *param);
-typedef int (*match_func_t)(const void *data, void *param);
+typedef int (*pq_cmp_func_t)(const void *data, const void *param);
+typedef int (*pq_match_func_t)(const void *data, void *param);
 
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
@@ -27,7 +29,7 @@ typedef int (*match_func_t)(const void *data, void *param);
 /* Arguments:    cmp_func - function to define the priority order             */
 /* Return value: returns a pointer to the newly created priority queue        */
 /******************************************************************************/
-pq_t *PQCreate(cmp_func_t cmp_func);
+pq_t *PQCreate(pq_cmp_func_t cmp_func);
 
 /* Complexity: O(n)                                                          */
 /******************************************************************************/
@@ -37,7 +39,7 @@ pq_t *PQCreate(cmp_func_t cmp_func);
 /******************************************************************************/
 void PQDestroy(pq_t *pq);
 
-/* Complexity: O(n)                                                          */
+/* Complexity: O(log n) expected                                             */
 /******************************************************************************/
 /* Description:  inserts data into the priority queue according to priority   */
 /* Arguments:    pq - pointer to the priority queue                           */
@@ -70,7 +72,7 @@ void *PQPeek(const pq_t *pq);
 /******************************************************************************/
 int PQIsEmpty(const pq_t *pq);
 
-/* Complexity: O(n)                                                          */
+/* Complexity: O(1)                                                          */
 /******************************************************************************/
 /* Description:  returns the number of elements in the priority queue         */
 /* Arguments:    pq - pointer to the priority queue                           */
@@ -87,7 +89,7 @@ size_t PQCount(const pq_t *pq);
 /* Return value: returns pointer to the removed element, or NULL if no match  */
 /* Note:         param can be NULL.                                           */
 /******************************************************************************/
-void *PQErase(pq_t *pq, match_func_t match_func, void *param);
+void *PQErase(pq_t *pq, pq_match_func_t match_func, void *param);
 
 /* Complexity: O(n)                                                          */
 /******************************************************************************/
@@ -10,6 +10,10 @@ stack data structure, but where additionally each element has a "priority"
 associated with it. In a priority queue, an element with high priority is 
 served before an element with low priority. This implementation uses 
 a binary heap as the underlying container.
+
+An indexed priority queue (PQCreateIndexed) returns a handle for every 
+element enqueued with PQEnqueueIndexed, which erases or re-prioritizes 
+that element in O(log n) instead of searching for it.
 */
 
 #ifndef P_Q
@@ -18,8 +22,9 @@ a binary heap as the underlying container.
 #include <stddef.h> /* size_t */
 
 typedef struct pq pq_t;
-typedef int (*cmp_func_t)(const void *data, const void *param);
-typedef int (*match_func_t)(const void *data, const void *param);
+typedef struct heap_node *pq_handle_t; /* the handle of the heap beneath */
+typedef int (*pq_cmp_func_t)(const void *data, const void *param);
+typedef int (*pq_match_func_t)(const void *data, void *param);
 
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
@@ -27,7 +32,15 @@ typedef int (*match_func_t)(const void *data, const void *param);
 /* Arguments:    cmp_func - function to define the priority order             */
 /* Return value: returns a pointer to the newly created priority queue        */
 /******************************************************************************/
-pq_t *PQCreate(cmp_func_t cmp_func);
+pq_t *PQCreate(pq_cmp_func_t cmp_func);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates a new empty indexed priority queue                  */
+/* Arguments:    cmp_func - function to define the priority order             */
+/* Return value: returns a pointer to the newly created priority queue        */
+/******************************************************************************/
+pq_t *PQCreateIndexed(pq_cmp_func_t cmp_func);
 
 /* Complexity: O(n)                                                          */
 /******************************************************************************/
@@ -46,6 +59,17 @@ void PQDestroy(pq_t *pq);
 /******************************************************************************/
 int PQEnqueue(pq_t *pq, void *data);
 
+/* Complexity: O(n log size), O(size + n) for a batch larger than the queue  */
+/******************************************************************************/
+/* Description:  inserts a batch of elements into the priority queue          */
+/* Arguments:    pq - pointer to the priority queue                           */
+/*               data - array of pointers to the data to be inserted          */
+/*               n - number of elements in the array                          */
+/* Return value: returns 0 on success, non-zero on failure                    */
+/* Note:         a failure leaves the queue unchanged, unless it is indexed   */
+/******************************************************************************/
+int PQEnqueueMany(pq_t *pq, void **data, size_t n);
+
 /* Complexity: O(log n)                                                      */
 /******************************************************************************/
 /* Description:  removes and returns the element with the highest priority     */
@@ -86,7 +110,35 @@ size_t PQCount(const pq_t *pq);
 /*               param - parameter for the match function                     */
 /* Return value: returns pointer to the removed element, or NULL if no match  */
 /******************************************************************************/
-void *PQErase(pq_t *pq, match_func_t match_func, void *param);
+void *PQErase(pq_t *pq, pq_match_func_t match_func, void *param);
+
+/* Complexity: O(log n)                                                      */
+/******************************************************************************/
+/* Description:  inserts data into an indexed priority queue                  */
+/* Arguments:    pq - pointer to an indexed priority queue                    */
+/*               data - pointer to the data to be inserted                    */
+/* Return value: returns the handle of the element, or NULL on failure        */
+/* Note:         the handle stays valid until the element leaves the queue    */
+/******************************************************************************/
+pq_handle_t PQEnqueueIndexed(pq_t *pq, void *data);
+
+/* Complexity: O(log n)                                                      */
+/******************************************************************************/
+/* Description:  removes the element of the given handle                      */
+/* Arguments:    pq - pointer to an indexed priority queue                    */
+/*               handle - handle of an element in the queue                   */
+/* Return value: returns pointer to the removed element                       */
+/******************************************************************************/
+void *PQEraseHandle(pq_t *pq, pq_handle_t handle);
+
+/* Complexity: O(log n)                                                      */
+/******************************************************************************/
+/* Description:  re-positions an element after its priority changed          */
+/* Arguments:    pq - pointer to an indexed priority queue                    */
+/*               handle - handle of the changed element                       */
+/* Return value: does not return anything                                     */
+/******************************************************************************/
+void PQUpdateHandle(pq_t *pq, pq_handle_t handle);
 
 /* Complexity: O(n log n)                                                    */
 /******************************************************************************/
@@ -0,0 +1,142 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Priority Queue (Pairing Heap Implementation)
+
+Description:
+The same priority queue as pqueue.h and pqueue_heap.h, backed by a pairing
+heap: a multiway tree whose root is the highest priority element. Enqueue
+links the new element with the root in O(1), dequeue pairs the children of
+the old root up in two passes, O(log n) amortized.
+
+Every element lives in its own node, so every element has a handle.
+Re-prioritizing an element that moved ahead of its parent only cuts its
+subtree off and links it with the root - O(1), which suits decrease-key
+heavy workloads such as Dijkstra's algorithm. PQCreateIndexed is the same
+as PQCreate and is kept so that code written for pqueue_heap.h builds
+against this header as is.
+*/
+
+#ifndef P_Q
+#define P_Q
+
+#include <stddef.h> /* size_t */
+
+typedef struct pq pq_t;
+typedef struct pq_node *pq_handle_t;
+typedef int (*pq_cmp_func_t)(const void *data, const void *param);
+typedef int (*pq_match_func_t)(const void *data, void *param);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates a new empty priority queue                          */
+/* Arguments:    cmp_func - function to define the priority order             */
+/* Return value: returns a pointer to the newly created priority queue        */
+/******************************************************************************/
+pq_t *PQCreate(pq_cmp_func_t cmp_func);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  same as PQCreate, every pairing queue hands out handles      */
+/* Arguments:    cmp_func - function to define the priority order             */
+/* Return value: returns a pointer to the newly created priority queue        */
+/******************************************************************************/
+pq_t *PQCreateIndexed(pq_cmp_func_t cmp_func);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  destroys the priority queue and frees all associated memory  */
+/* Arguments:    pq - pointer to the priority queue                           */
+/* Return value: does not return anything                                     */
+/******************************************************************************/
+void PQDestroy(pq_t *pq);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  inserts data into the priority queue according to priority   */
+/* Arguments:    pq - pointer to the priority queue                           */
+/*               data - pointer to the data to be inserted                    */
+/* Return value: returns 0 on success, non-zero on failure                    */
+/******************************************************************************/
+int PQEnqueue(pq_t *pq, void *data);
+
+/* Complexity: O(log n) amortized                                            */
+/******************************************************************************/
+/* Description:  removes and returns the element with the highest priority     */
+/* Arguments:    pq - pointer to the priority queue                           */
+/* Return value: returns pointer to the removed element, or NULL if empty     */
+/******************************************************************************/
+void *PQDequeue(pq_t *pq);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  returns the element with the highest priority without removal*/
+/* Arguments:    pq - pointer to the priority queue                           */
+/* Return value: returns pointer to the element, or NULL if empty             */
+/******************************************************************************/
+void *PQPeek(const pq_t *pq);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  checks if the priority queue is empty                        */
+/* Arguments:    pq - pointer to the priority queue                           */
+/* Return value: returns 1 if empty, 0 otherwise                              */
+/******************************************************************************/
+int PQIsEmpty(const pq_t *pq);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  returns the number of elements in the priority queue         */
+/* Arguments:    pq - pointer to the priority queue                           */
+/* Return value: returns the number of elements                               */
+/******************************************************************************/
+size_t PQCount(const pq_t *pq);
+
+/* Complexity: O(n)                                                          */
+/******************************************************************************/
+/* Description:  removes the first element matching the given criteria        */
+/* Arguments:    pq - pointer to the priority queue                           */
+/*               match_func - function to define matching criteria            */
+/*               param - parameter for the match function                     */
+/* Return value: returns pointer to the removed element, or NULL if no match  */
+/******************************************************************************/
+void *PQErase(pq_t *pq, pq_match_func_t match_func, void *param);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  inserts data and returns its handle                          */
+/* Arguments:    pq - pointer to the priority queue                           */
+/*               data - pointer to the data to be inserted                    */
+/* Return value: returns the handle of the element, or NULL on failure        */
+/* Note:         the handle stays valid until the element leaves the queue    */
+/******************************************************************************/
+pq_handle_t PQEnqueueIndexed(pq_t *pq, void *data);
+
+/* Complexity: O(log n) amortized                                            */
+/******************************************************************************/
+/* Description:  removes the element of the given handle                      */
+/* Arguments:    pq - pointer to the priority queue                           */
+/*               handle - handle of an element in the queue                   */
+/* Return value: returns pointer to the removed element                       */
+/******************************************************************************/
+void *PQEraseHandle(pq_t *pq, pq_handle_t handle);
+
+/* Complexity: O(1) if the priority rose, O(children + log n) otherwise       */
+/******************************************************************************/
+/* Description:  re-positions an element after its priority changed          */
+/* Arguments:    pq - pointer to the priority queue                           */
+/*               handle - handle of the changed element                       */
+/* Return value: does not return anything                                     */
+/******************************************************************************/
+void PQUpdateHandle(pq_t *pq, pq_handle_t handle);
+
+/* Complexity: O(n)                                                          */
+/******************************************************************************/
+/* Description:  removes all elements from the priority queue                 */
+/* Arguments:    pq - pointer to the priority queue                           */
+/* Return value: does not return anything                                     */
+/******************************************************************************/
+void PQClear(pq_t *pq);
+
+#endif /* P_Q */
@@ -0,0 +1,113 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Priority Queue (Radix Heap Implementation)
+
+Description:
+The same priority queue as pqueue.h and pqueue_heap.h, for monotone integer
+keys: the smaller key is served first, and no key enqueued may be smaller
+than the last key dequeued. Timers fit this - nothing is ever scheduled in
+the past.
+
+Elements sit in one bucket per bit of the key: bucket b holds the keys that
+first differ from the last dequeued key at bit b - 1, bucket 0 the keys
+equal to it. Dequeue takes from bucket 0; when it is empty, the lowest non
+empty bucket is spread over the buckets below it. An element only ever
+moves down, so enqueue is O(1) and dequeue O(log C) amortized, C being the
+largest key, with no comparisons between elements at all.
+
+The queue is created with a key function instead of a compare function,
+every other function is the same as in pqueue.h.
+*/
+
+#ifndef P_Q
+#define P_Q
+
+#include <stddef.h> /* size_t */
+
+typedef struct pq pq_t;
+typedef size_t (*pq_key_func_t)(const void *data);
+typedef int (*pq_match_func_t)(const void *data, void *param);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates a new empty priority queue                          */
+/* Arguments:    key_func - returns the key of an element, the smaller key    */
+/*               has the higher priority                                      */
+/* Return value: returns a pointer to the newly created priority queue        */
+/******************************************************************************/
+pq_t *PQCreate(pq_key_func_t key_func);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  destroys the priority queue and frees all associated memory  */
+/* Arguments:    pq - pointer to the priority queue                           */
+/* Return value: does not return anything                                     */
+/******************************************************************************/
+void PQDestroy(pq_t *pq);
+
+/* Complexity: O(1) amortized                                                */
+/******************************************************************************/
+/* Description:  inserts data into the priority queue according to its key    */
+/* Arguments:    pq - pointer to the priority queue                           */
+/*               data - pointer to the data to be inserted                    */
+/* Return value: returns 0 on success, non-zero on failure                    */
+/* Note:         the key must not be smaller than the last dequeued key. the  */
+/*               key of an element must not change while it is queued        */
+/******************************************************************************/
+int PQEnqueue(pq_t *pq, void *data);
+
+/* Complexity: O(log C) amortized                                            */
+/******************************************************************************/
+/* Description:  removes and returns the element with the smallest key        */
+/* Arguments:    pq - pointer to the priority queue                           */
+/* Return value: returns pointer to the removed element, or NULL if empty     */
+/******************************************************************************/
+void *PQDequeue(pq_t *pq);
+
+/* Complexity: O(1), O(n) at worst when bucket 0 is empty                    */
+/******************************************************************************/
+/* Description:  returns the element with the smallest key without removal    */
+/* Arguments:    pq - pointer to the priority queue                           */
+/* Return value: returns pointer to the element, or NULL if empty             */
+/* Note:         when bucket 0 is empty the lowest bucket is scanned          */
+/******************************************************************************/
+void *PQPeek(const pq_t *pq);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  checks if the priority queue is empty                        */
+/* Arguments:    pq - pointer to the priority queue                           */
+/* Return value: returns 1 if empty, 0 otherwise                              */
+/******************************************************************************/
+int PQIsEmpty(const pq_t *pq);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  returns the number of elements in the priority queue         */
+/* Arguments:    pq - pointer to the priority queue                           */
+/* Return value: returns the number of elements                               */
+/******************************************************************************/
+size_t PQCount(const pq_t *pq);
+
+/* Complexity: O(n)                                                          */
+/******************************************************************************/
+/* Description:  removes the first element matching the given criteria        */
+/* Arguments:    pq - pointer to the priority queue                           */
+/*               match_func - function to define matching criteria            */
+/*               param - parameter for the match function                     */
+/* Return value: returns pointer to the removed element, or NULL if no match  */
+/******************************************************************************/
+void *PQErase(pq_t *pq, pq_match_func_t match_func, void *param);
+
+/* Complexity: O(n)                                                          */
+/******************************************************************************/
+/* Description:  removes all elements from the priority queue                 */
+/* Arguments:    pq - pointer to the priority queue                           */
+/* Return value: does not return anything                                     */
+/* Note:         the queue starts over, any key may be enqueued again         */
+/******************************************************************************/
+void PQClear(pq_t *pq);
+
+#endif /* P_Q */
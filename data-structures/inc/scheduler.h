@@ -50,7 +50,7 @@ void SchedDestroy(scheduler_t *sched);
 /******************************************************************************/
 /* Description:  adds a new task to the scheduler                             */
 /* Arguments:    sched - pointer to the scheduler                             */
-/*               interval - interval for execution in seconds                 */
+/*               interval - interval for execution in nanoseconds             */
 /*               action - action function to execute                          */
 /*               action_param - parameters for the action function            */
 /*               cleanup_func - cleanup function after task removal           */
@@ -75,6 +75,8 @@ int SchedRemoveTask(scheduler_t *sched, ilrd_uid_t task_id);
 /* Description:  runs the scheduler, executing tasks at their scheduled time  */
 /* Arguments:    sched - pointer to the scheduler                             */
 /* Return value: returns SUCCESS (0) if stopped normally, or ERROR/STOP codes */
+/* Note:         sleeps on the monotonic clock until exactly the time the     */
+/*               next task is due                                             */
 /******************************************************************************/
 int SchedRun(scheduler_t *sched);
 
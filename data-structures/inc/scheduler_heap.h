@@ -7,7 +7,9 @@ Scheduler (Heap Implementation)
 Description:
 This library provides functionality for scheduling tasks to be executed 
 at specified intervals. It uses a priority queue (implemented with a heap) 
-to manage and execute tasks based on their scheduled time.
+to manage and execute tasks based on their scheduled time. The heap is 
+indexed, and the scheduler maps every task's uid to its heap handle, so 
+removing a task does not search the heap.
 */
 
 #ifndef SCHEDULER_HEAP_H
@@ -50,7 +52,7 @@ void SchedDestroy(scheduler_t *sched);
 /******************************************************************************/
 /* Description:  adds a new task to the scheduler                             */
 /* Arguments:    sched - pointer to the scheduler                             */
-/*               interval - interval for execution in seconds                 */
+/*               interval - interval for execution in nanoseconds             */
 /*               action - action function to execute                          */
 /*               action_param - parameters for the action function            */
 /*               cleanup_func - cleanup function after task removal           */
@@ -61,7 +63,7 @@ ilrd_uid_t SchedAddTask(scheduler_t *sched, size_t interval,
                         action_func_t action, void *action_param, 
                         cleanup_func_t cleanup_func, void *cleanup_param);
 
-/* Complexity: O(n)                                                          */
+/* Complexity: O(log n)                                                      */
 /******************************************************************************/
 /* Description:  removes a task from the scheduler                            */
 /* Arguments:    sched - pointer to the scheduler                             */
@@ -75,6 +77,8 @@ int SchedRemoveTask(scheduler_t *sched, ilrd_uid_t task_id);
 /* Description:  runs the scheduler, executing tasks at their scheduled time  */
 /* Arguments:    sched - pointer to the scheduler                             */
 /* Return value: returns SUCCESS (0) if stopped normally, or ERROR/STOP codes */
+/* Note:         sleeps on the monotonic clock until exactly the time the     */
+/*               next task is due                                             */
 /******************************************************************************/
 int SchedRun(scheduler_t *sched);
 
@@ -0,0 +1,143 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Scheduler (Worker Pool Implementation)
+
+Description:
+This library provides functionality for scheduling tasks to be executed
+at specified intervals, running the tasks on a pool of worker threads.
+SchedRun turns the calling thread into a dispatcher: it waits on the
+monotonic clock until the earliest task in the priority queue (a heap) is
+due, and hands it to a worker. Every worker has its own deque of due
+tasks, and a worker whose deque runs dry steals from the deques of the
+others, so one slow task delays only the tasks queued behind it on its
+own worker, and only until another worker steals them.
+
+A task that returns REPEAT goes back into the priority queue when it
+finishes. SchedAddTask, SchedRemoveTask, SchedStop, SchedClear and
+SchedSize are thread safe, and may be called by the tasks themselves.
+
+Same API as scheduler.h and scheduler_heap.h, plus SchedCreateWorkers.
+Link with -pthread (make TARGET=scheduler_mt AF=-pthread).
+*/
+
+#ifndef SCHEDULER_MT_H
+#define SCHEDULER_MT_H
+
+#include <stddef.h> /* size_t */
+
+#include "uid.h" /* ilrd_uid_t */
+
+typedef struct scheduler scheduler_t;
+
+typedef int (*action_func_t)(void* param);
+typedef void (*cleanup_func_t)(void* param);
+
+enum
+{
+    ERROR = -1,
+    SUCCESS,
+    STOP,
+    REPEAT
+};
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates a new scheduler with a worker per online CPU        */
+/* Arguments:    none                                                         */
+/* Return value: returns a pointer to the newly created scheduler, or NULL    */
+/******************************************************************************/
+scheduler_t *SchedCreate(void);
+
+/* Complexity: O(num_workers)                                                */
+/******************************************************************************/
+/* Description:  creates a new scheduler with the given number of workers     */
+/* Arguments:    num_workers - number of worker threads SchedRun starts       */
+/* Return value: returns a pointer to the newly created scheduler, or NULL    */
+/* Note:         with a single worker, tasks run one at a time in the order   */
+/*               they are due, like in scheduler.h                            */
+/******************************************************************************/
+scheduler_t *SchedCreateWorkers(size_t num_workers);
+
+/* Complexity: O(n)                                                          */
+/******************************************************************************/
+/* Description:  destroys a scheduler and frees all associated memory        */
+/* Arguments:    sched - pointer to the scheduler                             */
+/* Return value: does not return anything                                     */
+/* Note:         the scheduler must not be running                            */
+/******************************************************************************/
+void SchedDestroy(scheduler_t *sched);
+
+/* Complexity: O(log n)                                                      */
+/******************************************************************************/
+/* Description:  adds a new task to the scheduler. Thread safe                */
+/* Arguments:    sched - pointer to the scheduler                             */
+/*               interval - interval for execution in nanoseconds             */
+/*               action - action function to execute                          */
+/*               action_param - parameters for the action function            */
+/*               cleanup_func - cleanup function after task removal           */
+/*               cleanup_param - parameters for the cleanup function          */
+/* Return value: returns UID of the added task, or bad_uid on failure         */
+/******************************************************************************/
+ilrd_uid_t SchedAddTask(scheduler_t *sched, size_t interval,
+                        action_func_t action, void *action_param,
+                        cleanup_func_t cleanup_func, void *cleanup_param);
+
+/* Complexity: O(n)                                                          */
+/******************************************************************************/
+/* Description:  removes a task from the scheduler. Thread safe              */
+/* Arguments:    sched - pointer to the scheduler                             */
+/*               task_id - unique identifier of the task                      */
+/* Return value: returns SUCCESS (0) if successful, ERROR otherwise            */
+/* Note:         a task that is running right now finishes its run, and is   */
+/*               destroyed instead of being repeated                          */
+/******************************************************************************/
+int SchedRemoveTask(scheduler_t *sched, ilrd_uid_t task_id);
+
+/* Complexity: O(log n) per task fired                                       */
+/******************************************************************************/
+/* Description:  runs the scheduler, executing tasks at their scheduled time  */
+/* Arguments:    sched - pointer to the scheduler                             */
+/* Return value: returns SUCCESS (0) if stopped normally, or ERROR/STOP codes */
+/* Note:         starts the workers and dispatches from the calling thread.  */
+/*               Returns when no task is left, or once stopped and the tasks  */
+/*               that are running have finished - due tasks that did not      */
+/*               start yet go back to the scheduler                           */
+/******************************************************************************/
+int SchedRun(scheduler_t *sched);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  stops the scheduler, no new task starts. Thread safe         */
+/* Arguments:    sched - pointer to the scheduler                             */
+/* Return value: returns SUCCESS (0)                                          */
+/******************************************************************************/
+int SchedStop(scheduler_t *sched);
+
+/* Complexity: O(n)                                                          */
+/******************************************************************************/
+/* Description:  clears all tasks from the scheduler. Thread safe            */
+/* Arguments:    sched - pointer to the scheduler                             */
+/* Return value: does not return anything                                     */
+/* Note:         tasks that are running right now are not repeated           */
+/******************************************************************************/
+void SchedClear(scheduler_t *sched);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  returns the number of tasks waiting to run. Thread safe      */
+/* Arguments:    sched - pointer to the scheduler                             */
+/* Return value: returns the number of tasks, not counting running ones      */
+/******************************************************************************/
+size_t SchedSize(const scheduler_t *sched);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  checks if the scheduler is empty                              */
+/* Arguments:    sched - pointer to the scheduler                             */
+/* Return value: returns 1 if empty, 0 otherwise                              */
+/******************************************************************************/
+int SchedIsEmpty(const scheduler_t *sched);
+
+#endif /*SCHEDULER_MT_H*/
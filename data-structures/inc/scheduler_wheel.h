@@ -0,0 +1,125 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Scheduler (Timing Wheel Implementation)
+
+Description:
+This library provides functionality for scheduling tasks to be executed 
+at specified intervals. It keeps the tasks in a hierarchical timing wheel: 
+every level is a ring of slots, each slot covering 64 times the time span 
+of a slot one level below. A task is dropped into the slot of its 
+expiration time, so adding, removing and firing a task cost O(1) no matter 
+how many tasks are scheduled. Far tasks are moved down a level (cascaded) 
+as their time comes closer.
+
+The slots of the lowest level are 1 ms long. The run loop sleeps until the 
+next non empty slot, and then until the exact time of every task in it.
+
+Same API as scheduler.h and scheduler_heap.h.
+*/
+
+#ifndef SCHEDULER_WHEEL_H
+#define SCHEDULER_WHEEL_H
+
+#include <stddef.h> /* size_t */
+
+#include "uid.h" /* ilrd_uid_t */
+
+typedef struct scheduler scheduler_t;
+
+typedef int (*action_func_t)(void* param);
+typedef void (*cleanup_func_t)(void* param);
+
+enum
+{
+    ERROR = -1,
+    SUCCESS,
+    STOP,
+    REPEAT
+};
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates a new scheduler                                      */
+/* Arguments:    none                                                         */
+/* Return value: returns a pointer to the newly created scheduler, or NULL    */
+/******************************************************************************/
+scheduler_t *SchedCreate(void);
+
+/* Complexity: O(n)                                                          */
+/******************************************************************************/
+/* Description:  destroys a scheduler and frees all associated memory        */
+/* Arguments:    sched - pointer to the scheduler                             */
+/* Return value: does not return anything                                     */
+/******************************************************************************/
+void SchedDestroy(scheduler_t *sched);
+
+/* Complexity: O(1) amortized                                               */
+/******************************************************************************/
+/* Description:  adds a new task to the scheduler                             */
+/* Arguments:    sched - pointer to the scheduler                             */
+/*               interval - interval for execution in nanoseconds             */
+/*               action - action function to execute                          */
+/*               action_param - parameters for the action function            */
+/*               cleanup_func - cleanup function after task removal           */
+/*               cleanup_param - parameters for the cleanup function          */
+/* Return value: returns UID of the added task, or bad_uid on failure         */
+/******************************************************************************/
+ilrd_uid_t SchedAddTask(scheduler_t *sched, size_t interval, 
+                        action_func_t action, void *action_param, 
+                        cleanup_func_t cleanup_func, void *cleanup_param);
+
+/* Complexity: O(1) average                                                  */
+/******************************************************************************/
+/* Description:  removes a task from the scheduler                            */
+/* Arguments:    sched - pointer to the scheduler                             */
+/*               task_id - unique identifier of the task                      */
+/* Return value: returns SUCCESS (0) if successful, ERROR otherwise            */
+/******************************************************************************/
+int SchedRemoveTask(scheduler_t *sched, ilrd_uid_t task_id);
+
+/* Complexity: O(1) per task fired, O(number of slots) per wake up          */
+/******************************************************************************/
+/* Description:  runs the scheduler, executing tasks at their scheduled time  */
+/* Arguments:    sched - pointer to the scheduler                             */
+/* Return value: returns SUCCESS (0) if stopped normally, or ERROR/STOP codes */
+/* Note:         sleeps on the monotonic clock until exactly the time the     */
+/*               next task is due. Tasks that are due in the same 1 ms tick   */
+/*               run in the order they were added                             */
+/******************************************************************************/
+int SchedRun(scheduler_t *sched);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  stops the scheduler after the current task finishes          */
+/* Arguments:    sched - pointer to the scheduler                             */
+/* Return value: returns SUCCESS (0)                                          */
+/******************************************************************************/
+int SchedStop(scheduler_t *sched);
+
+/* Complexity: O(n + number of slots)                                       */
+/******************************************************************************/
+/* Description:  clears all tasks from the scheduler                          */
+/* Arguments:    sched - pointer to the scheduler                             */
+/* Return value: does not return anything                                     */
+/******************************************************************************/
+void SchedClear(scheduler_t *sched);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  returns the number of tasks currently in the scheduler       */
+/* Arguments:    sched - pointer to the scheduler                             */
+/* Return value: returns the number of tasks                                  */
+/******************************************************************************/
+size_t SchedSize(const scheduler_t *sched);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  checks if the scheduler is empty                              */
+/* Arguments:    sched - pointer to the scheduler                             */
+/* Return value: returns 1 if empty, 0 otherwise                              */
+/******************************************************************************/
+int SchedIsEmpty(const scheduler_t *sched);  
+
+#endif /*SCHEDULER_WHEEL_H*/
@@ -15,6 +15,8 @@ the data and a reference to the next node.
 
 #include <stddef.h> /* size_t */
 
+#include "pool.h" /* pool_t */
+
 typedef struct slist slist_t;
 typedef struct node * slist_iter_t;
 
@@ -29,9 +31,31 @@ typedef int (*action_func_t)(void *data, void *param);
 /******************************************************************************/
 slist_t *SListCreate();
 
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates a pool (see pool.h) sized for list nodes, to be      */
+/*               shared by any number of lists                                */
+/* Arguments:    nodes_per_slab - number of nodes allocated at once           */
+/* Return value: returns a pointer to the pool, NULL on failure               */
+/* Note:         the pool is freed with PoolDestroy, after every list that    */
+/*               uses it was destroyed                                        */
+/******************************************************************************/
+pool_t *SListCreatePool(size_t nodes_per_slab);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates an empty singly linked list whose nodes are          */
+/*               allocated from a pool created with SListCreatePool           */
+/* Arguments:    pool - the pool, it is not owned by the list                 */
+/* Return value: returns a pointer to the newly created list                  */
+/* Note:         lists can be appended only to lists on the same pool.        */
+/******************************************************************************/
+slist_t *SListCreateWithPool(pool_t *pool);
+
 /* Complexity: O(n)                                                          */
 /******************************************************************************/
-/* Description:  removes the list from memory                                 */
+/* Description:  removes the list from memory, a pooled list returns its     */
+/*               nodes to the pool                                            */
 /* Arguments:    list - pointer to the list to be removed                     */
 /* Return value: does not return anything                                     */
 /* Note:         removing from empty list will result in undefined behavior   */
@@ -74,22 +98,24 @@ int SListIsIterSame(slist_iter_t iter1, slist_iter_t iter2);
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
 /* Description:  inserts a new node to the list                               */
-/* Arguments:    where - location in the list where the new node is to be     */ 
+/* Arguments:    list - pointer to the list that holds where                  */
+/*               where - location in the list where the new node is to be     */ 
 /*                       inserted                                             */
 /*               data - pointer to the data to be inserted in the node        */
 /* Return value: returns a pointer to the newly inserted node                 */
 /******************************************************************************/
-slist_iter_t SListInsert(slist_iter_t where, void* data);
+slist_iter_t SListInsert(slist_t *list, slist_iter_t where, void* data);
 
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
 /* Description:  removes a given node from the list                           */
-/* Arguments:    to_remove - a pointer to the node to be removed              */
+/* Arguments:    list - pointer to the list that holds to_remove              */
+/*               to_remove - a pointer to the node to be removed              */
 /* Return value: returns a pointer to the next node                           */
 /* Note:         after removing a node, previous nodes held by user in        */
 /*               iterators may be corrupted.                                  */
 /******************************************************************************/
-slist_iter_t SListRemove(slist_iter_t to_remove);
+slist_iter_t SListRemove(slist_t *list, slist_iter_t to_remove);
 
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
@@ -108,9 +134,9 @@ void *SListGetData(slist_iter_t iter);
 /******************************************************************************/
 void SListSetData(slist_iter_t iter, void *data);
 
-/* Complexity: O(n)                                                          */
+/* Complexity: O(1)                                                          */
 /******************************************************************************/
-/* Description:  counts the number of nodes in the list                       */
+/* Description:  returns the number of nodes in the list, kept as a counter  */
 /* Arguments:    list - pointer to the list                                   */
 /* Return value: returns the number of nodes in the list as size_t            */
 /******************************************************************************/
@@ -151,13 +177,14 @@ slist_iter_t SListFind(slist_iter_t from, slist_iter_t to, match_func_t is_match
 /******************************************************************************/
 int SListForEach(slist_iter_t from, slist_iter_t to, action_func_t action, void *param);
 
-/* Complexity: O(1)                                                          */
+/* Complexity: O(m), m is the number of elements in src                     */
 /******************************************************************************/
 /* Description:  appends the source list to the end of the destination list   */
 /* Arguments:    dest - pointer to the destination list                       */
 /*               src - pointer to the source list                             */
 /* Return value: does not return anything                                     */
-/* Note:         the source list becomes empty after this operation           */
+/* Note:         the source list becomes empty after this operation.          */
+/*               Both lists must be malloc based, or on the same pool.        */
 /******************************************************************************/
 void SListAppend(slist_t *dest, slist_t *src);
 
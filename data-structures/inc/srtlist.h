@@ -9,6 +9,11 @@ A sorted linked list is a collection of items where each item holds
 a relative position that is based upon some underlying characteristic of 
 the item. This implementation uses a doubly linked list as the underlying 
 container and maintains the sorted order during insertion.
+
+Merging splices whole runs of nodes from one list into the other, so every
+list is walked once and no node is allocated. SrtListMergeMany keeps the
+first elements of the source lists in a small heap to merge k of them in
+one pass.
 */
 
 #ifndef SRTLIST_H
@@ -22,10 +27,7 @@ typedef struct srtlist srtlist_t;
 typedef struct srtlist_iter
 {
     dlist_iter_t iter;
-    
-    #ifndef NDEBUG 
     const srtlist_t *list;
-    #endif 
 } srtlist_iter_t;
 
 typedef int (*cmp_func_t)(const void *data, const void *param);
@@ -192,14 +194,28 @@ void *SrtListPopBack(srtlist_t *list);
 /******************************************************************************/
 void *SrtListPopFront(srtlist_t *list);
 
-/* Complexity: O(n)                                                          */
+/* Complexity: O(n + m), m being the size of src                             */
 /******************************************************************************/
 /* Description:  merges two sorted lists into the destination list            */
 /* Arguments:    dest - pointer to the destination list                       */
 /*               src - pointer to the source list                             */
 /* Return value: does not return anything                                     */
-/* Note:         undefined behavior if compare functions differ or src empty  */
+/* Note:         undefined behavior if compare functions differ. src is left  */
+/*               empty, equal elements of dest stay before those of src       */
+/******************************************************************************/
+void SrtListMerge(srtlist_t *dest, srtlist_t *src);
+
+/* Complexity: O(n + m log k), m being the total size of srcs                */
+/******************************************************************************/
+/* Description:  merges k sorted lists into the destination list at once      */
+/* Arguments:    dest - pointer to the destination list                       */
+/*               srcs - array of pointers to the source lists                 */
+/*               k - number of source lists                                   */
+/* Return value: does not return anything                                     */
+/* Note:         undefined behavior if compare functions differ. every src is */
+/*               left empty, equal elements keep the order dest, srcs[0],     */
+/*               srcs[1] and so on                                            */
 /******************************************************************************/
-void SrtListMerge(srtlist_t *dest, srtlist_t *src);        
+void SrtListMergeMany(srtlist_t *dest, srtlist_t **srcs, size_t k);
 
 #endif /* SRTLIST_H */
@@ -8,6 +8,11 @@ Description:
 A stack is a linear data structure that follows the Last In, First Out (LIFO) 
 principle. This implementation provides a fixed-capacity stack that stores 
 elements of a uniform size.
+
+The elements are stored inline, in the same allocation as the stack. A small 
+stack (StackCreateSmall) starts out the same way, but instead of refusing a 
+push once full it spills to a heap buffer twice the size - the common short 
+stack never allocates more than once.
 */
 
 #ifndef STACK_H
@@ -26,6 +31,16 @@ typedef struct stack stack_t;
 /******************************************************************************/
 stack_t *StackCreate(size_t capacity, size_t element_size);
 
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  creates a new stack that grows past its inline capacity      */
+/* Arguments:    inline_capacity - number of elements stored inline           */
+/*               element_size - size of each element in bytes                 */
+/* Return value: returns a pointer to the newly created stack                 */
+/* Note:         a capacity of 0 is taken as 1                                */
+/******************************************************************************/
+stack_t *StackCreateSmall(size_t inline_capacity, size_t element_size);
+
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
 /* Description:  removes the stack from memory                                */
@@ -34,14 +49,15 @@ stack_t *StackCreate(size_t capacity, size_t element_size);
 /******************************************************************************/
 void StackDestroy(stack_t *stack);
 
-/* Complexity: O(1)                                                          */
+/* Complexity: O(1), amortized O(1) on a small stack                         */
 /******************************************************************************/
 /* Description:  adds a new element to the top of the stack                   */
 /* Arguments:    stack - pointer to the stack                                 */
 /*               element - pointer to the data to be added                    */
 /* Return value: does not return anything                                     */
 /* Note:         pushing to a full stack will result in an error message      */
-/*               and the operation will be ignored.                           */
+/*               and the operation will be ignored. a small stack is only     */
+/*               full when it fails to spill                                  */
 /******************************************************************************/
 void StackPush(stack_t *stack, void *element);
 
@@ -72,7 +88,7 @@ int StackIsEmpty(const stack_t *stack);
 
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
-/* Description:  returns the maximum capacity of the stack                    */
+/* Description:  returns the current capacity of the stack                    */
 /* Arguments:    stack - pointer to the stack                                 */
 /* Return value: returns the capacity                                         */
 /******************************************************************************/
@@ -8,13 +8,15 @@ Description:
 This library provides a task structure used by the scheduler. A task 
 represents an action to be executed at a specific time or interval, 
 with associated cleanup functionality.
+
+Times and intervals are in nanoseconds. Times are read from the monotonic 
+clock (CLOCK_MONOTONIC), which is not affected by changes to the wall clock.
 */
 
 #ifndef TASK_H
 #define TASK_H
 
 #include <stddef.h> /* size_t */
-#include <time.h>   /* time_t */
 
 #include "uid.h" /* ilrd_uid_t */
 
@@ -25,7 +27,7 @@ typedef void (*task_clean_func_t)(void* param);
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
 /* Description:  creates a new task                                           */
-/* Arguments:    interval - the interval at which the task should be executed */
+/* Arguments:    interval - nanoseconds between executions of the task        */
 /*               action - function to be executed                             */
 /*               action_params - parameters for the action function           */
 /*               cleanup - function to be executed upon task destruction      */
@@ -71,9 +73,10 @@ int TaskIsSame(const task_t *task1, const task_t *task2);
 /******************************************************************************/
 /* Description:  returns the scheduled execution time for the task            */
 /* Arguments:    task - pointer to the task                                   */
-/* Return value: returns the execution time as time_t                         */
+/* Return value: returns the execution time, in nanoseconds on the same       */
+/*               clock as TaskTimeNow                                         */
 /******************************************************************************/
-time_t TaskGetTimeToRun(const task_t *task);
+size_t TaskGetTimeToRun(const task_t *task);
 
 /* Complexity: O(1)                                                          */
 /******************************************************************************/
@@ -83,4 +86,22 @@ time_t TaskGetTimeToRun(const task_t *task);
 /******************************************************************************/
 void TaskUpdateTimeToRun(task_t *task);
 
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  returns the current time of the clock tasks are timed with   */
+/* Arguments:    none                                                         */
+/* Return value: returns the monotonic time in nanoseconds                    */
+/******************************************************************************/
+size_t TaskTimeNow(void);
+
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  sleeps until the clock tasks are timed with reaches when,    */
+/*               returns at once if it already did                            */
+/* Arguments:    when - the absolute time to wake up at, in nanoseconds on    */
+/*               the same clock as TaskTimeNow                                */
+/* Return value: does not return anything                                     */
+/******************************************************************************/
+void TaskSleepUntil(size_t when);
+
 #endif /*TASK_H*/
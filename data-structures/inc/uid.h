@@ -43,4 +43,12 @@ ilrd_uid_t UIDGenerate(void);
 /******************************************************************************/
 int UIDIsEqual(ilrd_uid_t one, ilrd_uid_t other);
 
+/* Complexity: O(1)                                                          */
+/******************************************************************************/
+/* Description:  hashes a UID, so UIDs can key a hash table                   */
+/* Arguments:    uid - the UID to be hashed                                   */
+/* Return value: returns the hash, equal UIDs hash the same                   */
+/******************************************************************************/
+size_t UIDHash(ilrd_uid_t uid);
+
 #endif /*ILRD_UID_H*/
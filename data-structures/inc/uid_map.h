@@ -0,0 +1,79 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+UID Map
+
+Description:
+A hash map from UIDs (see uid.h) to caller values. The map is chained, its
+nodes are carved out of a private pool (see pool.h) and its bucket array
+doubles whenever the map holds more values than buckets, so every operation
+is O(1) on average.
+
+Both schedulers (scheduler_heap.h and scheduler_wheel.h) use one to find
+a task by its UID without searching their queues.
+*/
+
+#ifndef UID_MAP_H
+#define UID_MAP_H
+
+#include <stddef.h> /* size_t */
+
+#include "uid.h" /* ilrd_uid_t */
+
+typedef struct uid_map uid_map_t;
+
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Creates a new, empty map.                                    */
+/* Arguments:    None.                                                        */
+/* Return value: A pointer to the created map, or NULL on failure.            */
+/******************************************************************************/
+uid_map_t *UIDMapCreate(void);
+
+/* Complexity: O(number of buckets)                                           */
+/******************************************************************************/
+/* Description:  Destroys the map and frees all associated memory.            */
+/* Arguments:    map - A pointer to the map to be destroyed.                  */
+/* Return value: None.                                                        */
+/* Note:         The values themselves are not freed.                         */
+/******************************************************************************/
+void UIDMapDestroy(uid_map_t *map);
+
+/* Complexity: O(1) average, O(n) when the map grows                          */
+/******************************************************************************/
+/* Description:  Maps a UID to a value.                                       */
+/* Arguments:    map - A pointer to the map.                                  */
+/* uid - The UID, must not be in the map yet.                   */
+/* value - The value to be mapped to the UID.                   */
+/* Return value: 0 on success, 1 if no memory could be allocated.             */
+/******************************************************************************/
+int UIDMapInsert(uid_map_t *map, ilrd_uid_t uid, void *value);
+
+/* Complexity: O(1) average, O(n) worst                                       */
+/******************************************************************************/
+/* Description:  Removes a UID from the map.                                  */
+/* Arguments:    map - A pointer to the map.                                  */
+/* uid - The UID to be removed.                                 */
+/* Return value: The value the UID was mapped to, or NULL if not present.     */
+/******************************************************************************/
+void *UIDMapRemove(uid_map_t *map, ilrd_uid_t uid);
+
+/* Complexity: O(1) average, O(n) worst                                       */
+/******************************************************************************/
+/* Description:  Finds the value a UID is mapped to.                          */
+/* Arguments:    map - A pointer to the map.                                  */
+/* uid - The UID to be found.                                   */
+/* Return value: The value the UID is mapped to, or NULL if not present.      */
+/******************************************************************************/
+void *UIDMapFind(const uid_map_t *map, ilrd_uid_t uid);
+
+/* Complexity: O(1)                                                           */
+/******************************************************************************/
+/* Description:  Returns the number of UIDs in the map.                       */
+/* Arguments:    map - A pointer to the map.                                  */
+/* Return value: The number of UIDs in the map.                               */
+/******************************************************************************/
+size_t UIDMapSize(const uid_map_t *map);
+
+#endif /* UID_MAP_H */
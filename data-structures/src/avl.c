@@ -7,6 +7,7 @@ Date: Mar 24, 2024
 #include <assert.h> /* assert */
 
 #include "avl.h"
+#include "pool.h" /* pool_t */
 
 #define MAX(a, b) (a > b ? a : b)
 #define MIN(a, b) (a < b ? a : b)
@@ -45,6 +46,8 @@ struct tree
 {
     avl_node_t *root;
     cmp_func_t cmp_func;
+    pool_t *pool; /* NULL when the nodes are allocated with malloc */
+    size_t count;
 };
 
 /******************** FORWARD DECLARATIONS ********************/
@@ -55,7 +58,6 @@ static int AVLForEachInOrder(avl_t *avl, action_func_t action_func,
                               void *params, avl_node_t *node);
 static int AVLForEachPostOrder(avl_t *avl, action_func_t action_func, 
                               void *params, avl_node_t *node);
-static int AddOne(void *data , void *count);
 static void AVLDestroyWithNode(avl_t *avl, avl_node_t *node);
 static int Height(avl_node_t *node);
 static avl_node_t *AVLInsertHelper(avl_t *avl, void *data, avl_node_t *node, avl_node_t *new_node);
@@ -67,6 +69,7 @@ static void UpdateHeight(avl_node_t *node);
 static avl_node_t *Rotate(avl_node_t *node, int side);
 static avl_node_t *Balance(avl_node_t *node);
 static int GetBalance(avl_node_t* node);
+static void FreeNode(avl_t *avl, avl_node_t *node);
 
 /******************** FUNCTIONS ********************/
 avl_t *AVLCreate(cmp_func_t cmp_func)
@@ -83,15 +86,46 @@ avl_t *AVLCreate(cmp_func_t cmp_func)
 
 	tree->cmp_func = cmp_func;
     tree->root = NULL;
+    tree->pool = NULL;
+    tree->count = 0;
 	
 	return (tree);
 }
 
+avl_t *AVLCreateWithPool(cmp_func_t cmp_func, size_t nodes_per_slab)
+{
+    avl_t *tree = NULL;
+    pool_t *pool = PoolCreate(sizeof(avl_node_t), nodes_per_slab);
+    if (NULL == pool)
+    {
+        return (NULL);
+    }
+
+    tree = AVLCreate(cmp_func);
+    if (NULL == tree)
+    {
+        PoolDestroy(pool);
+        return (NULL);
+    }
+
+    tree->pool = pool;
+
+    return (tree);
+}
+
 void AVLDestroy(avl_t *avl)
 {
     assert(avl);
 
-    AVLDestroyWithNode(avl, avl->root);
+    /* all the nodes live in the pool's slabs, no need to visit them */
+    if (NULL != avl->pool)
+    {
+        PoolDestroy(avl->pool);
+    }
+    else
+    {
+        AVLDestroyWithNode(avl, avl->root);
+    }
 
     free(avl);
 }
@@ -103,7 +137,15 @@ int AVLInsert(avl_t *avl, void *data)
     assert(avl);
     assert(data);
 
-    new_node = (avl_node_t *)malloc(sizeof(avl_node_t));
+    if (NULL != avl->pool)
+    {
+        new_node = (avl_node_t *)PoolAlloc(avl->pool);
+    }
+    else
+    {
+        new_node = (avl_node_t *)malloc(sizeof(avl_node_t));
+    }
+
     if (NULL == new_node)
     {
         return 1;
@@ -112,6 +154,7 @@ int AVLInsert(avl_t *avl, void *data)
     InitNode(new_node, NULL, NULL, data, 0);
 
     avl->root = AVLInsertHelper(avl, data, avl->root, new_node);
+    ++avl->count;
 
     return 0;
 }
@@ -136,13 +179,9 @@ void *AVLFind(const avl_t *avl, const void *data)
 
 size_t AVLSize(const avl_t *avl)
 {
-    size_t count = 0;
-
     assert(avl);
 
-    AVLForEach((avl_t *)avl, AddOne, &count, PRE_ORDER);
-
-    return count;
+    return (avl->count);
 }
 
 int AVLIsEmpty(const avl_t *avl)
@@ -205,21 +244,21 @@ static avl_node_t *AVLRemoveHelper(avl_t *avl, void *data, avl_node_t *node)
         /* if leaf*/
         if ((NULL == node->children[LEFT]) && (NULL == node->children[RIGHT]))
         {
-            free(node);
+            FreeNode(avl, node);
             return NULL;
         }
          /* if only left child */
         else if (NULL == node->children[RIGHT])
         {
             temp = node->children[LEFT];
-            free(node);
+            FreeNode(avl, node);
             return temp;
         }
         /* if only right child */
         else if (NULL == node->children[LEFT])
         {
             temp = node->children[RIGHT];
-            free(node);
+            FreeNode(avl, node);
             return temp;
         }
 
@@ -419,14 +458,6 @@ static int AVLForEachPostOrder(avl_t *avl, action_func_t action_func,
     return status;
 }
 
-static int AddOne(void *data , void *count)
-{	
-	(void)data;
-	
-	*(size_t *)count = *(size_t *)count + 1;
-	
-	return (0);
-}
 
 static void AVLDestroyWithNode(avl_t *avl, avl_node_t *node)
 {
@@ -541,3 +572,18 @@ static void UpdateHeight(avl_node_t *node)
         node->height = 1 + MAX(left_height, right_height);
     }
 }
+
+/* only called by AVLRemoveHelper, once per removed element */
+static void FreeNode(avl_t *avl, avl_node_t *node)
+{
+    --avl->count;
+
+    if (NULL != avl->pool)
+    {
+        PoolFree(avl->pool, node);
+    }
+    else
+    {
+        free(node);
+    }
+}
@@ -7,6 +7,7 @@ Date: Mar 12, 2024
 #include <stdlib.h>
 
 #include "bst.h" /* bst_iter_t */
+#include "pool.h" /* pool_t */
 
 /******************** ENUMS ********************/
 enum status 
@@ -35,8 +36,10 @@ struct node
 
 struct tree
 {
-    bst_node_t root;
+    bst_node_t root; /* must stay first, see NodeToTree */
     cmp_func_t cmp_func;
+    pool_t *pool; /* NULL when the nodes are allocated with malloc */
+    size_t count;
 };
 
 #define ACTUAL_ROOT ((bst->root.children[LEFT]))
@@ -45,7 +48,6 @@ struct tree
 /******************** FORWARD DECLARATIONS ********************/
 static bst_iter_t NodeToIter(const bst_node_t *node);
 static bst_node_t *IterToNode(bst_iter_t iter);
-static int AddOne(void *data , void *count);
 static int NodeLeftOrRight(bst_node_t *node);
 static int NodeChildLeftOrRight(bst_node_t *node);
 static bst_node_t *GoMostSide(bst_node_t *runner, int side);
@@ -53,6 +55,7 @@ static bst_iter_t InOrderTraversal(bst_iter_t iter, int side);
 static void InitNode(bst_node_t *node, bst_node_t *parent, bst_node_t *left_son,
                      bst_node_t *right_son, void *data);
 static void DestroyPostOrder(bst_node_t *node);
+static bst_t *NodeToTree(bst_node_t *node);
 
 /******************** FUNCTIONS ********************/
 bst_t *BSTCreate(cmp_func_t cmp_func)
@@ -68,17 +71,48 @@ bst_t *BSTCreate(cmp_func_t cmp_func)
 	}
 
 	tree->cmp_func = cmp_func;
+	tree->pool = NULL;
+	tree->count = 0;
 
 	InitNode(&tree->root, NULL, NULL, NULL, NULL);
 	
 	return (tree);
 }
 
+bst_t *BSTCreateWithPool(cmp_func_t cmp_func, size_t nodes_per_slab)
+{
+	bst_t *tree = NULL;
+	pool_t *pool = PoolCreate(sizeof(bst_node_t), nodes_per_slab);
+	if (NULL == pool)
+	{
+		return (NULL);
+	}
+
+	tree = BSTCreate(cmp_func);
+	if (NULL == tree)
+	{
+		PoolDestroy(pool);
+		return (NULL);
+	}
+
+	tree->pool = pool;
+
+	return (tree);
+}
+
 void BSTDestroy(bst_t *bst)
 {
 	assert(bst);
 
-	DestroyPostOrder(ACTUAL_ROOT);
+	/* all the nodes live in the pool's slabs, no need to visit them */
+	if (NULL != bst->pool)
+	{
+		PoolDestroy(bst->pool);
+	}
+	else
+	{
+		DestroyPostOrder(ACTUAL_ROOT);
+	}
 
 	free(bst);
 }
@@ -154,13 +188,22 @@ bst_iter_t BSTInsert(bst_t *bst, void *data)
 
 	assert(bst);
 
-	new_node = (bst_node_t *)malloc(sizeof(bst_node_t));
+	if (NULL != bst->pool)
+	{
+		new_node = (bst_node_t *)PoolAlloc(bst->pool);
+	}
+	else
+	{
+		new_node = (bst_node_t *)malloc(sizeof(bst_node_t));
+	}
+
 	if (NULL == new_node)
 	{
 		return NodeToIter(DUMMY);
 	}
 
 	InitNode(new_node, NULL, NULL, NULL, data);
+	++bst->count;
 
 	if (BSTIsEmpty(bst))
 	{
@@ -201,6 +244,7 @@ bst_iter_t BSTInsert(bst_t *bst, void *data)
 
 void BSTRemove(bst_iter_t iter)
 {
+	bst_t *bst = NULL;
 	bst_node_t *node = NULL;
 	bst_node_t *next_node = NULL;
 	int side_of_node = 0;
@@ -210,6 +254,7 @@ void BSTRemove(bst_iter_t iter)
 	assert(IterToNode(iter));
 
 	node = IterToNode(iter);
+	bst = NodeToTree(node);
 
 	/* If node is leaf */
 	if (NULL == node->children[LEFT] && NULL == node->children[RIGHT])
@@ -257,18 +302,23 @@ void BSTRemove(bst_iter_t iter)
 		}
 	}
 
-	free(node);
+	--bst->count;
+
+	if (NULL != bst->pool)
+	{
+		PoolFree(bst->pool, node);
+	}
+	else
+	{
+		free(node);
+	}
 }
 
 size_t BSTSize(const bst_t *bst)
 {
-	size_t count = 0;
-
 	assert (bst);
 
-	BSTForEach(BSTBegin(bst), BSTEnd(bst), AddOne, &count);
-
-	return count;
+	return (bst->count);
 }
 
 int BSTIsEmpty(const bst_t *bst)
@@ -331,15 +381,6 @@ static bst_node_t *IterToNode(bst_iter_t iter)
 	return ((bst_node_t *)iter);
 }
 
-static int AddOne(void *data , void *count)
-{	
-	(void)data;
-	
-	*(size_t *)count = *(size_t *)count + 1;
-	
-	return (SUCCESS);
-}
-
 static int NodeLeftOrRight(bst_node_t *node)
 {
 	if (node == node->parent->children[LEFT])
@@ -418,3 +459,14 @@ static void DestroyPostOrder(bst_node_t *node)
 	DestroyPostOrder(node->children[RIGHT]);
 	free(node);
 }
+
+/* the parentless dummy root is the first member of the tree struct */
+static bst_t *NodeToTree(bst_node_t *node)
+{
+	while (NULL != node->parent)
+	{
+		node = node->parent;
+	}
+
+	return ((bst_t *)node);
+}
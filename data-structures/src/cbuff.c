@@ -3,11 +3,16 @@ Owner: Uri Naor
 Date: Feb 19, 2024
 */
 
+#define _GNU_SOURCE /* memfd_create */
+
 #include <stddef.h> /* size_t */
 #include <sys/types.h> /* ssize_t */
 #include <stdlib.h> /* malloc */
 #include <string.h> /* memcpy */
 #include <assert.h> /* assert */
+#include <unistd.h> /* ftruncate */
+#include <sys/mman.h> /* mmap */
+#include <sys/uio.h> /* readv */
 
 #include "cbuff.h" /* freespace */
 
@@ -26,9 +31,18 @@ struct cbuff
 	size_t read;
 	size_t size;
 	size_t capacity;
+	char *ring; /* byte, or the first of two mappings of the same pages */
+	int is_mirrored;
 	char byte[1];
 };
 
+/******************** FORWARD DECLARATIONS ********************/
+static void FillSpans(cbuff_t *buffer, size_t idx, size_t count, 
+					  cbuff_span_t spans[2]);
+static char *MapTwice(size_t size);
+static int ToIovec(const cbuff_span_t spans[2], struct iovec iov[2]);
+
+/******************** FUNCTIONS ********************/
 cbuff_t *CBuffCreate(size_t capacity)
 {
 	cbuff_t *new_buff = malloc(offsetof(cbuff_t, byte) + capacity);
@@ -40,6 +54,40 @@ cbuff_t *CBuffCreate(size_t capacity)
 	new_buff->capacity = capacity;
 	new_buff->size = 0;
 	new_buff->read = 0;
+	new_buff->ring = new_buff->byte;
+	new_buff->is_mirrored = 0;
+	
+	return (new_buff);
+}
+
+cbuff_t *CBuffCreateMirrored(size_t capacity)
+{
+	cbuff_t *new_buff = NULL;
+	size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+	
+	assert(capacity);
+	
+	/* each mapping has to start on a page */
+	capacity = (capacity + page_size - 1) / page_size * page_size;
+	
+	new_buff = malloc(offsetof(cbuff_t, byte));
+	if (NULL == new_buff)
+	{
+		return NULL;
+	}
+	
+	new_buff->ring = MapTwice(capacity);
+	if (NULL == new_buff->ring)
+	{
+		free(new_buff);
+		
+		return NULL;
+	}
+	
+	new_buff->capacity = capacity;
+	new_buff->size = 0;
+	new_buff->read = 0;
+	new_buff->is_mirrored = 1;
 	
 	return (new_buff);
 }
@@ -47,15 +95,17 @@ cbuff_t *CBuffCreate(size_t capacity)
 void CBuffDestroy(cbuff_t *buffer)
 {
 	assert(buffer);
-
+	
+	if (buffer->is_mirrored)
+	{
+		munmap(buffer->ring, 2 * buffer->capacity);
+	}
 	free(buffer);
 }
 
 ssize_t CBuffRead(cbuff_t *buffer, void *dest, size_t count)
 {
-	size_t first_pass_count = buffer->capacity - READ_IDX;
-	size_t to_read = 0;
-	size_t available_to_read = CBuffSize(buffer);
+	cbuff_span_t spans[2];
 	
 	assert(buffer);
 	assert(dest);
@@ -65,54 +115,123 @@ ssize_t CBuffRead(cbuff_t *buffer, void *dest, size_t count)
 		return FAIL;
 	}
 	
-	count = MIN(count, available_to_read);
-	to_read = count;
-
-	first_pass_count = MIN(first_pass_count, count);
-
-	memcpy(dest, buffer->byte + READ_IDX, first_pass_count);
-		
-	to_read -= first_pass_count;
-		
-	memcpy((char*)dest + first_pass_count, 
-	buffer->byte, to_read);
+	count = CBuffReadPeek(buffer, count, spans);
 	
-	buffer->size -= count;
-	buffer->read = (buffer->read + count) % buffer->capacity; 
+	memcpy(dest, spans[0].data, spans[0].size);
+	memcpy((char *)dest + spans[0].size, spans[1].data, spans[1].size);
+	
+	CBuffReadConsume(buffer, count);
 	
 	return count;
 }
 
 ssize_t CBuffWrite(cbuff_t *buffer, const void *src, size_t count)
 {
-	size_t first_pass_count = buffer->capacity - WRITE_IDX;
-	size_t to_write = count;
-	size_t free_space = CBuffFreeSpace(buffer);
+	cbuff_span_t spans[2];
 	
 	assert(buffer);
 	assert(src);
 	
-	if (0 == free_space)
+	if (0 == CBuffFreeSpace(buffer))
 	{
 		return FAIL;
 	}
 	
-	count = MIN(count, free_space);
-	to_write = count;
+	count = CBuffWriteReserve(buffer, count, spans);
 	
-	first_pass_count = MIN(first_pass_count, count);
-		
-	memcpy(buffer->byte + WRITE_IDX, src, first_pass_count);
-		
-	to_write -= first_pass_count;
-		
-	memcpy(buffer->byte, ((char *)src) + first_pass_count, to_write);
+	memcpy(spans[0].data, src, spans[0].size);
+	memcpy(spans[1].data, (const char *)src + spans[0].size, spans[1].size);
+	
+	CBuffWriteCommit(buffer, count);
+	
+	return count;
+}
+
+size_t CBuffWriteReserve(cbuff_t *buffer, size_t count, cbuff_span_t spans[2])
+{
+	assert(buffer);
+	assert(spans);
+	
+	count = MIN(count, CBuffFreeSpace(buffer));
+	FillSpans(buffer, WRITE_IDX, count, spans);
+	
+	return count;
+}
+
+void CBuffWriteCommit(cbuff_t *buffer, size_t count)
+{
+	assert(buffer);
+	assert(count <= CBuffFreeSpace(buffer));
 	
 	buffer->size += count;
+}
+
+size_t CBuffReadPeek(cbuff_t *buffer, size_t count, cbuff_span_t spans[2])
+{
+	assert(buffer);
+	assert(spans);
+	
+	count = MIN(count, CBuffSize(buffer));
+	FillSpans(buffer, READ_IDX, count, spans);
 	
 	return count;
 }
 
+void CBuffReadConsume(cbuff_t *buffer, size_t count)
+{
+	assert(buffer);
+	assert(count <= CBuffSize(buffer));
+	
+	buffer->size -= count;
+	buffer->read = (buffer->read + count) % buffer->capacity;
+}
+
+ssize_t CBuffReadv(cbuff_t *buffer, int fd, size_t count)
+{
+	cbuff_span_t spans[2];
+	struct iovec iov[2];
+	ssize_t received = 0;
+	
+	assert(buffer);
+	
+	/* no room, no system call - -1 is left for readv's own errors */
+	if (0 == CBuffWriteReserve(buffer, count, spans))
+	{
+		return 0;
+	}
+	
+	received = readv(fd, iov, ToIovec(spans, iov));
+	if (0 < received)
+	{
+		CBuffWriteCommit(buffer, received);
+	}
+	
+	return received;
+}
+
+ssize_t CBuffWritev(cbuff_t *buffer, int fd, size_t count)
+{
+	cbuff_span_t spans[2];
+	struct iovec iov[2];
+	ssize_t sent = 0;
+	
+	assert(buffer);
+	
+	/* no data, no system call - -1 is left for writev's own errors */
+	if (0 == CBuffReadPeek(buffer, count, spans))
+	{
+		return 0;
+	}
+	
+	sent = writev(fd, iov, ToIovec(spans, iov));
+	if (0 < sent)
+	{
+		CBuffReadConsume(buffer, sent);
+	}
+	
+	return sent;
+}
+
 int CBuffIsEmpty(const cbuff_t *buffer)
 {
 	assert(buffer);
@@ -133,3 +252,72 @@ size_t CBuffFreeSpace(const cbuff_t *buffer)
 
 	return (buffer->capacity - buffer->size);
 }
+
+/******************** HELPER FUNCTIONS ********************/
+/* 'count' bytes from 'idx' on, split where the ring wraps around */
+static void FillSpans(cbuff_t *buffer, size_t idx, size_t count, 
+					  cbuff_span_t spans[2])
+{
+	/* a mirrored ring goes on past its end, into its own first bytes */
+	size_t first_pass_count = buffer->is_mirrored ? count : 
+							  MIN(count, buffer->capacity - idx);
+	
+	spans[0].data = buffer->ring + idx;
+	spans[0].size = first_pass_count;
+	spans[1].data = buffer->ring;
+	spans[1].size = count - first_pass_count;
+}
+
+/* reserves twice the size, then maps one memory file over both halves */
+static char *MapTwice(size_t size)
+{
+	char *ring = NULL;
+	int fd = memfd_create("cbuff", 0);
+	
+	if (-1 == fd)
+	{
+		return NULL;
+	}
+	
+	if (0 != ftruncate(fd, size))
+	{
+		close(fd);
+		
+		return NULL;
+	}
+	
+	ring = mmap(NULL, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (MAP_FAILED == ring)
+	{
+		close(fd);
+		
+		return NULL;
+	}
+	
+	if (MAP_FAILED == mmap(ring, size, PROT_READ | PROT_WRITE, 
+						   MAP_SHARED | MAP_FIXED, fd, 0) ||
+		MAP_FAILED == mmap(ring + size, size, PROT_READ | PROT_WRITE, 
+						   MAP_SHARED | MAP_FIXED, fd, 0))
+	{
+		munmap(ring, 2 * size);
+		close(fd);
+		
+		return NULL;
+	}
+	
+	/* the mappings keep the pages alive */
+	close(fd);
+	
+	return ring;
+}
+
+/* an empty second span is left out, so a mirrored ring is one piece */
+static int ToIovec(const cbuff_span_t spans[2], struct iovec iov[2])
+{
+	iov[0].iov_base = spans[0].data;
+	iov[0].iov_len = spans[0].size;
+	iov[1].iov_base = spans[1].data;
+	iov[1].iov_len = spans[1].size;
+	
+	return (0 == spans[1].size ? 1 : 2);
+}
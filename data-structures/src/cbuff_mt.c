@@ -0,0 +1,368 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#define _POSIX_C_SOURCE 200112L /* posix_memalign */
+
+#include <stddef.h> /* offsetof */
+#include <stdlib.h> /* posix_memalign */
+#include <string.h> /* memcpy */
+#include <assert.h> /* assert */
+
+#include "cbuff_mt.h" /* cbuff_spsc_t */
+
+#define CACHE_LINE (64)
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+
+#define LOAD(ptr) __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#define STORE(ptr, val) __atomic_store_n(ptr, val, __ATOMIC_RELEASE)
+#define LOAD_RELAXED(ptr) __atomic_load_n(ptr, __ATOMIC_RELAXED)
+
+enum STATUS
+{
+	FAIL = (-1),
+	SUCCESS
+};
+
+/******************** STRUCTS ********************/
+/* one side of the buffer on its own cache line: the index it moves, and */
+/* the last value it saw of the other side's index                      */
+typedef struct spsc_side
+{
+	size_t idx;
+	size_t cached; /* only refreshed when the stale value is not enough */
+	char pad[CACHE_LINE - 2 * sizeof(size_t)];
+} spsc_side_t;
+
+struct cbuff_spsc
+{
+	spsc_side_t producer; /* idx is the tail, cached the head */
+	spsc_side_t consumer; /* idx is the head, cached the tail */
+	size_t mask;
+	char pad[CACHE_LINE - sizeof(size_t)];
+	char byte[1];
+};
+
+typedef struct mpmc_index
+{
+	size_t pos;
+	char pad[CACHE_LINE - sizeof(size_t)];
+} mpmc_index_t;
+
+struct cbuff_mpmc
+{
+	mpmc_index_t write;
+	mpmc_index_t read;
+	size_t mask;
+	size_t element_size;
+	size_t slot_size; /* the sequence number, then the element */
+	char pad[CACHE_LINE - 3 * sizeof(size_t)];
+	char slots[1];
+};
+
+/******************** FORWARD DECLARATIONS ********************/
+static size_t RoundUpPow2(size_t n);
+static void *AlignedAlloc(size_t size);
+static size_t *SlotAt(const cbuff_mpmc_t *buffer, size_t pos);
+
+/******************** SPSC ********************/
+cbuff_spsc_t *CBuffSPSCCreate(size_t capacity)
+{
+	cbuff_spsc_t *new_buff = NULL;
+
+	assert(capacity);
+
+	capacity = RoundUpPow2(capacity);
+
+	new_buff = (cbuff_spsc_t *)AlignedAlloc(offsetof(cbuff_spsc_t, byte) +
+																capacity);
+	if (NULL == new_buff)
+	{
+		return (NULL);
+	}
+
+	new_buff->producer.idx = 0;
+	new_buff->producer.cached = 0;
+	new_buff->consumer.idx = 0;
+	new_buff->consumer.cached = 0;
+	new_buff->mask = capacity - 1;
+
+	return (new_buff);
+}
+
+void CBuffSPSCDestroy(cbuff_spsc_t *buffer)
+{
+	assert(buffer);
+
+	free(buffer);
+}
+
+ssize_t CBuffSPSCWrite(cbuff_spsc_t *buffer, const void *src, size_t count)
+{
+	size_t tail = 0;
+	size_t offset = 0;
+	size_t first_pass_count = 0;
+
+	assert(buffer);
+	assert(src);
+
+	/* the tail is ours, the head is read again only when it looks full */
+	tail = buffer->producer.idx;
+	if (buffer->mask + 1 - (tail - buffer->producer.cached) < count)
+	{
+		buffer->producer.cached = LOAD(&buffer->consumer.idx);
+	}
+
+	count = MIN(count, buffer->mask + 1 - (tail - buffer->producer.cached));
+	if (0 == count)
+	{
+		return (FAIL);
+	}
+
+	offset = tail & buffer->mask;
+	first_pass_count = MIN(count, buffer->mask + 1 - offset);
+
+	memcpy(buffer->byte + offset, src, first_pass_count);
+	memcpy(buffer->byte, (const char *)src + first_pass_count,
+										count - first_pass_count);
+
+	/* publishes the bytes together with the new tail */
+	STORE(&buffer->producer.idx, tail + count);
+
+	return (count);
+}
+
+ssize_t CBuffSPSCRead(cbuff_spsc_t *buffer, void *dest, size_t count)
+{
+	size_t head = 0;
+	size_t offset = 0;
+	size_t first_pass_count = 0;
+
+	assert(buffer);
+	assert(dest);
+
+	head = buffer->consumer.idx;
+	if (buffer->consumer.cached - head < count)
+	{
+		buffer->consumer.cached = LOAD(&buffer->producer.idx);
+	}
+
+	count = MIN(count, buffer->consumer.cached - head);
+	if (0 == count)
+	{
+		return (FAIL);
+	}
+
+	offset = head & buffer->mask;
+	first_pass_count = MIN(count, buffer->mask + 1 - offset);
+
+	memcpy(dest, buffer->byte + offset, first_pass_count);
+	memcpy((char *)dest + first_pass_count, buffer->byte,
+										count - first_pass_count);
+
+	/* hands the bytes back to the producer only after they were copied */
+	STORE(&buffer->consumer.idx, head + count);
+
+	return (count);
+}
+
+size_t CBuffSPSCSize(const cbuff_spsc_t *buffer)
+{
+	size_t head = 0;
+
+	assert(buffer);
+
+	/* the head first, so the tail read after it is never behind it */
+	head = LOAD(&buffer->consumer.idx);
+
+	return (MIN(LOAD(&buffer->producer.idx) - head, buffer->mask + 1));
+}
+
+size_t CBuffSPSCCapacity(const cbuff_spsc_t *buffer)
+{
+	assert(buffer);
+
+	return (buffer->mask + 1);
+}
+
+/******************** MPMC ********************/
+cbuff_mpmc_t *CBuffMPMCCreate(size_t capacity, size_t element_size)
+{
+	cbuff_mpmc_t *new_buff = NULL;
+	size_t slot_size = 0;
+	size_t i = 0;
+
+	assert(capacity);
+	assert(element_size);
+
+	/* with a single slot its free and full sequence numbers would meet */
+	capacity = RoundUpPow2(capacity < 2 ? 2 : capacity);
+	slot_size = (sizeof(size_t) + element_size + sizeof(size_t) - 1) /
+										sizeof(size_t) * sizeof(size_t);
+
+	new_buff = (cbuff_mpmc_t *)AlignedAlloc(offsetof(cbuff_mpmc_t, slots) +
+														capacity * slot_size);
+	if (NULL == new_buff)
+	{
+		return (NULL);
+	}
+
+	new_buff->write.pos = 0;
+	new_buff->read.pos = 0;
+	new_buff->mask = capacity - 1;
+	new_buff->element_size = element_size;
+	new_buff->slot_size = slot_size;
+
+	/* slot i is free for the write at position i */
+	for (i = 0; i < capacity; ++i)
+	{
+		*SlotAt(new_buff, i) = i;
+	}
+
+	return (new_buff);
+}
+
+void CBuffMPMCDestroy(cbuff_mpmc_t *buffer)
+{
+	assert(buffer);
+
+	free(buffer);
+}
+
+int CBuffMPMCPush(cbuff_mpmc_t *buffer, const void *element)
+{
+	size_t pos = 0;
+	size_t *seq = NULL;
+	long diff = 0;
+
+	assert(buffer);
+	assert(element);
+
+	pos = LOAD_RELAXED(&buffer->write.pos);
+	for (;;)
+	{
+		seq = SlotAt(buffer, pos);
+		diff = (long)(LOAD(seq) - pos);
+
+		/* free for this position - claim it, unless another writer did */
+		if (0 == diff)
+		{
+			if (__atomic_compare_exchange_n(&buffer->write.pos, &pos, pos + 1,
+								1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			{
+				break;
+			}
+		}
+		/* still holds the element from one lap ago */
+		else if (diff < 0)
+		{
+			return (FAIL);
+		}
+		else
+		{
+			pos = LOAD_RELAXED(&buffer->write.pos);
+		}
+	}
+
+	memcpy(seq + 1, element, buffer->element_size);
+	STORE(seq, pos + 1);
+
+	return (SUCCESS);
+}
+
+int CBuffMPMCPop(cbuff_mpmc_t *buffer, void *dest)
+{
+	size_t pos = 0;
+	size_t *seq = NULL;
+	long diff = 0;
+
+	assert(buffer);
+	assert(dest);
+
+	pos = LOAD_RELAXED(&buffer->read.pos);
+	for (;;)
+	{
+		seq = SlotAt(buffer, pos);
+		diff = (long)(LOAD(seq) - (pos + 1));
+
+		/* written for this position - claim it, unless another reader did */
+		if (0 == diff)
+		{
+			if (__atomic_compare_exchange_n(&buffer->read.pos, &pos, pos + 1,
+								1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			{
+				break;
+			}
+		}
+		/* not written yet */
+		else if (diff < 0)
+		{
+			return (FAIL);
+		}
+		else
+		{
+			pos = LOAD_RELAXED(&buffer->read.pos);
+		}
+	}
+
+	memcpy(dest, seq + 1, buffer->element_size);
+
+	/* free again, for the write one lap ahead */
+	STORE(seq, pos + buffer->mask + 1);
+
+	return (SUCCESS);
+}
+
+size_t CBuffMPMCSize(const cbuff_mpmc_t *buffer)
+{
+	size_t read = 0;
+	size_t write = 0;
+
+	assert(buffer);
+
+	/* the read position first, so the write read after it is not behind */
+	read = LOAD(&buffer->read.pos);
+	write = LOAD(&buffer->write.pos);
+
+	return (MIN(write - read, buffer->mask + 1));
+}
+
+size_t CBuffMPMCCapacity(const cbuff_mpmc_t *buffer)
+{
+	assert(buffer);
+
+	return (buffer->mask + 1);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static size_t RoundUpPow2(size_t n)
+{
+	size_t pow2 = 1;
+
+	while (pow2 < n)
+	{
+		pow2 <<= 1;
+	}
+
+	return (pow2);
+}
+
+/* the indices must start on a cache line for the padding to keep them apart */
+static void *AlignedAlloc(size_t size)
+{
+	void *block = NULL;
+
+	if (0 != posix_memalign(&block, CACHE_LINE, size))
+	{
+		return (NULL);
+	}
+
+	return (block);
+}
+
+static size_t *SlotAt(const cbuff_mpmc_t *buffer, size_t pos)
+{
+	return ((size_t *)(buffer->slots + (pos & buffer->mask) *
+														buffer->slot_size));
+}
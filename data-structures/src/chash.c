@@ -0,0 +1,357 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#define _POSIX_C_SOURCE 200112L /* posix_memalign, sched_yield */
+
+#include <stdlib.h> /* malloc */
+#include <string.h> /* memset */
+#include <assert.h> /* assert */
+#include <pthread.h> /* pthread_mutex_t */
+#include <sched.h> /* sched_yield */
+
+#include "chash.h" /* chash_t */
+
+#define CACHE_LINE (64)
+#define READER_SLOTS (64) /* finds spread their epoch counters over these */
+#define RECLAIM_THRESHOLD (128) /* removed nodes kept before a grace period */
+
+#define LOAD(ptr) __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#define STORE(ptr, val) __atomic_store_n(ptr, val, __ATOMIC_RELEASE)
+
+/******************** TYPEDEFS, ENUMS & STRUCTS ********************/
+typedef struct chash_node node_t;
+
+struct chash_node
+{
+    node_t *next;
+    size_t hash_code;
+    const void *value;
+    node_t *retired_next; /* readers may still follow next after removal */
+};
+
+/* one cache line per slot so finds on different threads do not collide */
+typedef struct reader_slot
+{
+    size_t active[2]; /* finds running in an even / odd epoch */
+    char pad[CACHE_LINE - 2 * sizeof(size_t)];
+} reader_slot_t;
+
+struct chash
+{
+    reader_slot_t readers[READER_SLOTS];
+    hash_func_t hash_func;
+    hash_cmp_func_t cmp_func;
+    size_t table_size;
+    node_t **table;
+    size_t num_locks;
+    pthread_mutex_t *locks;
+    size_t count;
+    size_t epoch;
+    pthread_mutex_t reclaim_lock;
+    node_t *retired;
+    size_t retired_count;
+};
+
+/******************** GLOBALS ********************/
+static size_t g_next_slot = 0;
+static __thread size_t t_slot = 0; /* reader slot + 1, 0 until first find */
+
+/******************** FORWARD DECLARATIONS ********************/
+static size_t ReaderSlot(void);
+static size_t EnterEpoch(chash_t *hash, size_t slot);
+static void ExitEpoch(chash_t *hash, size_t slot, size_t epoch);
+static void WaitForReaders(chash_t *hash);
+static void Retire(chash_t *hash, node_t *node);
+static void FreeNodes(node_t *node);
+
+/******************** FUNCTIONS ********************/
+chash_t *CHashCreate(hash_func_t hash_func, hash_cmp_func_t cmp_func,
+                                        size_t table_size, size_t num_locks)
+{
+    chash_t *new_hash = NULL;
+    size_t i = 0;
+
+    assert(hash_func);
+    assert(cmp_func);
+    assert(table_size);
+    assert(num_locks);
+
+    /* aligned so every reader slot really owns a single cache line */
+    if (0 != posix_memalign((void **)&new_hash, CACHE_LINE, sizeof(chash_t)))
+    {
+        return (NULL);
+    }
+    memset(new_hash, 0, sizeof(chash_t));
+
+    new_hash->table = (node_t **)calloc(table_size, sizeof(node_t *));
+    new_hash->locks = (pthread_mutex_t *)malloc(num_locks *
+                                                    sizeof(pthread_mutex_t));
+    if (NULL == new_hash->table || NULL == new_hash->locks)
+    {
+        free(new_hash->table);
+        free(new_hash->locks);
+        free(new_hash);
+        return (NULL);
+    }
+
+    for (i = 0; i < num_locks; ++i)
+    {
+        pthread_mutex_init(&new_hash->locks[i], NULL);
+    }
+    pthread_mutex_init(&new_hash->reclaim_lock, NULL);
+
+    new_hash->hash_func = hash_func;
+    new_hash->cmp_func = cmp_func;
+    new_hash->table_size = table_size;
+    new_hash->num_locks = num_locks;
+
+    return (new_hash);
+}
+
+void CHashDestroy(chash_t *hash)
+{
+    size_t i = 0;
+    node_t *next = NULL;
+
+    assert(hash);
+
+    for (i = 0; i < hash->table_size; ++i)
+    {
+        FreeNodes(hash->table[i]);
+    }
+
+    while (NULL != hash->retired)
+    {
+        next = hash->retired->retired_next;
+        free(hash->retired);
+        hash->retired = next;
+    }
+
+    for (i = 0; i < hash->num_locks; ++i)
+    {
+        pthread_mutex_destroy(&hash->locks[i]);
+    }
+    pthread_mutex_destroy(&hash->reclaim_lock);
+
+    free(hash->locks);
+    free(hash->table);
+    free(hash);
+}
+
+status_t CHashInsert(chash_t *hash, const void *value)
+{
+    size_t idx = 0;
+    node_t *node = NULL;
+    pthread_mutex_t *lock = NULL;
+
+    assert(hash);
+    assert(value);
+
+    node = (node_t *)malloc(sizeof(node_t));
+    if (NULL == node)
+    {
+        return (FAIL);
+    }
+
+    node->hash_code = hash->hash_func(value);
+    node->value = value;
+    node->retired_next = NULL;
+
+    idx = node->hash_code % hash->table_size;
+    lock = &hash->locks[idx % hash->num_locks];
+
+    pthread_mutex_lock(lock);
+    node->next = hash->table[idx];
+    /* the release store publishes the initialized node to the finds */
+    STORE(&hash->table[idx], node);
+    pthread_mutex_unlock(lock);
+
+    __atomic_fetch_add(&hash->count, 1, __ATOMIC_RELAXED);
+
+    return (SUCCESS);
+}
+
+void CHashRemove(chash_t *hash, const void *value)
+{
+    size_t hash_code = 0;
+    size_t idx = 0;
+    node_t **link = NULL;
+    node_t *found = NULL;
+    pthread_mutex_t *lock = NULL;
+
+    assert(hash);
+    assert(value);
+
+    hash_code = hash->hash_func(value);
+    idx = hash_code % hash->table_size;
+    lock = &hash->locks[idx % hash->num_locks];
+
+    pthread_mutex_lock(lock);
+    for (link = &hash->table[idx]; NULL != *link; link = &(*link)->next)
+    {
+        if ((*link)->hash_code == hash_code &&
+            0 == hash->cmp_func((*link)->value, value))
+        {
+            /* unlink only, a find may still be standing on the node */
+            found = *link;
+            STORE(link, found->next);
+            break;
+        }
+    }
+    pthread_mutex_unlock(lock);
+
+    if (NULL != found)
+    {
+        __atomic_fetch_sub(&hash->count, 1, __ATOMIC_RELAXED);
+        Retire(hash, found);
+    }
+}
+
+void *CHashFind(const chash_t *hash, const void *value)
+{
+    chash_t *mutable_hash = (chash_t *)hash;
+    size_t hash_code = 0;
+    size_t slot = 0;
+    size_t epoch = 0;
+    node_t *node = NULL;
+    void *found = NULL;
+
+    assert(hash);
+    assert(value);
+
+    hash_code = hash->hash_func(value);
+    slot = ReaderSlot();
+    epoch = EnterEpoch(mutable_hash, slot);
+
+    for (node = LOAD(&mutable_hash->table[hash_code % hash->table_size]);
+                                        NULL != node; node = LOAD(&node->next))
+    {
+        if (node->hash_code == hash_code &&
+            0 == hash->cmp_func(node->value, value))
+        {
+            found = (void *)node->value;
+            break;
+        }
+    }
+
+    ExitEpoch(mutable_hash, slot, epoch);
+
+    return (found);
+}
+
+size_t CHashSize(const chash_t *hash)
+{
+    assert(hash);
+
+    return (__atomic_load_n(&hash->count, __ATOMIC_RELAXED));
+}
+
+int CHashIsEmpty(const chash_t *hash)
+{
+    assert(hash);
+
+    return (0 == CHashSize(hash));
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static size_t ReaderSlot(void)
+{
+    if (0 == t_slot)
+    {
+        t_slot = __atomic_fetch_add(&g_next_slot, 1, __ATOMIC_RELAXED) %
+                                                            READER_SLOTS + 1;
+    }
+
+    return (t_slot - 1);
+}
+
+/* announces a find in the current epoch - if the epoch flipped between */
+/* reading it and announcing, the announcement may be missed, so retry  */
+static size_t EnterEpoch(chash_t *hash, size_t slot)
+{
+    size_t epoch = 0;
+    size_t *active = NULL;
+
+    for (;;)
+    {
+        epoch = __atomic_load_n(&hash->epoch, __ATOMIC_SEQ_CST);
+        active = &hash->readers[slot].active[epoch & 1];
+
+        __atomic_fetch_add(active, 1, __ATOMIC_SEQ_CST);
+        if (epoch == __atomic_load_n(&hash->epoch, __ATOMIC_SEQ_CST))
+        {
+            return (epoch);
+        }
+
+        __atomic_fetch_sub(active, 1, __ATOMIC_RELEASE);
+    }
+}
+
+static void ExitEpoch(chash_t *hash, size_t slot, size_t epoch)
+{
+    __atomic_fetch_sub(&hash->readers[slot].active[epoch & 1], 1,
+                                                            __ATOMIC_RELEASE);
+}
+
+/* a grace period - flips the epoch and waits until no find that started */
+/* in the old epoch is still running. Called with reclaim_lock held.      */
+static void WaitForReaders(chash_t *hash)
+{
+    size_t old_epoch = __atomic_load_n(&hash->epoch, __ATOMIC_SEQ_CST);
+    size_t i = 0;
+
+    __atomic_store_n(&hash->epoch, old_epoch + 1, __ATOMIC_SEQ_CST);
+
+    for (i = 0; i < READER_SLOTS; ++i)
+    {
+        while (0 != __atomic_load_n(&hash->readers[i].active[old_epoch & 1],
+                                                            __ATOMIC_SEQ_CST))
+        {
+            sched_yield();
+        }
+    }
+}
+
+static void Retire(chash_t *hash, node_t *node)
+{
+    node_t *to_free = NULL;
+
+    pthread_mutex_lock(&hash->reclaim_lock);
+
+    node->retired_next = hash->retired;
+    hash->retired = node;
+    ++hash->retired_count;
+
+    if (RECLAIM_THRESHOLD <= hash->retired_count)
+    {
+        /* everything on the list was unlinked before the epoch flips */
+        to_free = hash->retired;
+        hash->retired = NULL;
+        hash->retired_count = 0;
+
+        WaitForReaders(hash);
+    }
+
+    pthread_mutex_unlock(&hash->reclaim_lock);
+
+    while (NULL != to_free)
+    {
+        node = to_free->retired_next;
+        free(to_free);
+        to_free = node;
+    }
+}
+
+static void FreeNodes(node_t *node)
+{
+    node_t *next = NULL;
+
+    while (NULL != node)
+    {
+        next = node->next;
+        free(node);
+        node = next;
+    }
+}
@@ -0,0 +1,250 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#define _POSIX_C_SOURCE 200112L /* posix_memalign */
+
+#include <assert.h> /* assert */
+#include <stdlib.h> /* posix_memalign */
+#include <string.h> /* memcpy */
+
+#include "dheap.h" /* dheap_t */
+
+#define CACHE_LINE (64)
+#define MIN_CAPACITY (64)
+
+/******************** STRUCTS ********************/
+struct dheap
+{
+    heap_cmp_func_t cmp_func;
+    void **elems; /* elems[0] is the root */
+    void **base; /* the aligned allocation, arity - 1 slots before elems */
+    size_t size;
+    size_t capacity;
+    size_t arity;
+};
+
+/******************** FORWARD DECLARATIONS ********************/
+static void SiftUp(dheap_t *heap, size_t idx);
+static void SiftDown(dheap_t *heap, size_t idx);
+static status_t Grow(dheap_t *heap);
+
+/******************** FUNCTIONS ********************/
+dheap_t *DHeapCreate(heap_cmp_func_t cmp_func, size_t arity)
+{
+    dheap_t *new_heap = NULL;
+
+    assert(cmp_func);
+    assert(2 <= arity);
+
+    new_heap = (dheap_t *)malloc(sizeof(dheap_t));
+    if (NULL == new_heap)
+    {
+        return (NULL);
+    }
+
+    new_heap->cmp_func = cmp_func;
+    new_heap->arity = arity;
+    new_heap->size = 0;
+    new_heap->capacity = 0;
+    new_heap->base = NULL;
+    new_heap->elems = NULL;
+
+    if (SUCCESS != Grow(new_heap))
+    {
+        free(new_heap);
+        return (NULL);
+    }
+
+    return (new_heap);
+}
+
+void DHeapDestroy(dheap_t *heap)
+{
+    assert(heap);
+
+    free(heap->base);
+    free(heap);
+}
+
+status_t DHeapPush(dheap_t *heap, void *data)
+{
+    assert(heap);
+    assert(data);
+
+    if (heap->size == heap->capacity && SUCCESS != Grow(heap))
+    {
+        return (FAILURE);
+    }
+
+    heap->elems[heap->size] = data;
+    ++heap->size;
+
+    SiftUp(heap, heap->size - 1);
+
+    return (SUCCESS);
+}
+
+void *DHeapPop(dheap_t *heap)
+{
+    void *top = NULL;
+
+    assert(heap);
+    assert(!DHeapIsEmpty(heap));
+
+    top = heap->elems[0];
+
+    --heap->size;
+    if (0 != heap->size)
+    {
+        heap->elems[0] = heap->elems[heap->size];
+        SiftDown(heap, 0);
+    }
+
+    return (top);
+}
+
+void *DHeapPeek(const dheap_t *heap)
+{
+    assert(heap);
+
+    return (DHeapIsEmpty(heap) ? NULL : heap->elems[0]);
+}
+
+void *DHeapRemove(dheap_t *heap, heap_match_func_t match_func,
+                                                        const void *params)
+{
+    void *data = NULL;
+    size_t i = 0;
+
+    assert(heap);
+    assert(match_func);
+
+    for (i = 0; i < heap->size; ++i)
+    {
+        if (match_func(heap->elems[i], params))
+        {
+            data = heap->elems[i];
+
+            --heap->size;
+            if (i != heap->size)
+            {
+                heap->elems[i] = heap->elems[heap->size];
+                SiftUp(heap, i);
+                SiftDown(heap, i);
+            }
+
+            return (data);
+        }
+    }
+
+    return (NULL);
+}
+
+int DHeapIsEmpty(const dheap_t *heap)
+{
+    assert(heap);
+
+    return (0 == heap->size);
+}
+
+size_t DHeapSize(const dheap_t *heap)
+{
+    assert(heap);
+
+    return (heap->size);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+/* moves a hole up instead of swapping, the element is written once */
+static void SiftUp(dheap_t *heap, size_t idx)
+{
+    void **elems = heap->elems;
+    void *data = elems[idx];
+    size_t parent = 0;
+
+    while (0 < idx)
+    {
+        parent = (idx - 1) / heap->arity;
+        if (heap->cmp_func(data, elems[parent]) >= 0)
+        {
+            break;
+        }
+
+        elems[idx] = elems[parent];
+        idx = parent;
+    }
+
+    elems[idx] = data;
+}
+
+static void SiftDown(dheap_t *heap, size_t idx)
+{
+    void **elems = heap->elems;
+    void *data = elems[idx];
+    size_t arity = heap->arity;
+    size_t size = heap->size;
+    size_t first = 0;
+    size_t last = 0;
+    size_t best = 0;
+    size_t child = 0;
+
+    for (;;)
+    {
+        first = arity * idx + 1;
+        if (first >= size)
+        {
+            break;
+        }
+
+        /* the siblings share a cache line, scanning them is cheap */
+        last = (first + arity < size) ? first + arity : size;
+        best = first;
+        for (child = first + 1; child < last; ++child)
+        {
+            if (heap->cmp_func(elems[child], elems[best]) < 0)
+            {
+                best = child;
+            }
+        }
+
+        if (heap->cmp_func(elems[best], data) >= 0)
+        {
+            break;
+        }
+
+        elems[idx] = elems[best];
+        idx = best;
+    }
+
+    elems[idx] = data;
+}
+
+/* the children of i are arity * i + 1 .. arity * i + arity, so shifting */
+/* the root arity - 1 slots into an aligned block aligns every group     */
+static status_t Grow(dheap_t *heap)
+{
+    size_t capacity = (0 == heap->capacity) ? MIN_CAPACITY :
+                                                        2 * heap->capacity;
+    size_t pad = heap->arity - 1;
+    void **base = NULL;
+
+    if (0 != posix_memalign((void **)&base, CACHE_LINE,
+                                            (pad + capacity) * sizeof(void *)))
+    {
+        return (FAILURE);
+    }
+
+    if (0 != heap->size)
+    {
+        memcpy(base + pad, heap->elems, heap->size * sizeof(void *));
+    }
+
+    free(heap->base);
+    heap->base = base;
+    heap->elems = base + pad;
+    heap->capacity = capacity;
+
+    return (SUCCESS);
+}
@@ -6,6 +6,7 @@ Date: Feb 19, 2024
 #include <stdlib.h> /* malloc */
 #include <assert.h> /* assert */
 #include "dlist.h" /* dlist_t */
+#include "pool.h" /* pool_t */
 
 enum status 
 {
@@ -28,14 +29,16 @@ struct dlist
 {
     node_t head;
     node_t tail;
+    pool_t *pool; /* NULL when the nodes are allocated with malloc */
+    size_t count;
 };
 
 /******************** FORWARD DECLARATIONS ********************/
-static node_t *CreateNode(void *data, void *next, void *prev);
+static node_t *CreateNode(dlist_t *list, void *data, void *next, void *prev);
+static void FreeNode(dlist_t *list, node_t *node);
 static dlist_iter_t NodeToIter(const node_t *node);
 static node_t *IterToNode(dlist_iter_t iter);
 static node_t *GoToEnd(node_t *node);
-static int AddOne(void *data , void *count);
 static int IsWhereBetween(dlist_iter_t from, dlist_iter_t to, dlist_iter_t where);
 
 /******************** FUNCTIONS ********************/
@@ -54,10 +57,35 @@ dlist_t *DListCreate()
 	list->tail.prev = &list->head;
 	list->tail.data = list;
 	list->tail.next = NULL;
+
+	list->pool = NULL;
+	list->count = 0;
 	
 	return (list);
 }
 
+pool_t *DListCreatePool(size_t nodes_per_slab)
+{
+	return (PoolCreate(sizeof(node_t), nodes_per_slab));
+}
+
+dlist_t *DListCreateWithPool(pool_t *pool)
+{
+	dlist_t *list = NULL;
+	
+	assert(pool);
+
+	list = DListCreate();
+	if (NULL == list)
+	{
+		return (NULL);
+	}
+
+	list->pool = pool;
+
+	return (list);
+}
+
 void DListDestroy(dlist_t *list)
 {
 	dlist_iter_t curr;
@@ -71,7 +99,7 @@ void DListDestroy(dlist_t *list)
 	while (!DListIsIterSame(curr, DListEnd(list)))
 	{
 		next = DListNext(curr);
-		DListRemove(curr);
+		DListRemove(list, curr);
 		curr = next;
 	}
 
@@ -121,13 +149,16 @@ int DListIsIterSame(dlist_iter_t iter1, dlist_iter_t iter2)
 	return (iter1_node == iter2_node);
 }
 
-dlist_iter_t DListInsert(dlist_iter_t where, void* data)
+dlist_iter_t DListInsert(dlist_t *list, dlist_iter_t where, void* data)
 {
-	node_t *where_node = IterToNode(where);
-	node_t *new_node = CreateNode(data, where_node, where_node->prev);
+	node_t *where_node = NULL;
+	node_t *new_node = NULL;
 	
+	assert(list);
 	assert(where);
 	
+	where_node = IterToNode(where);
+	new_node = CreateNode(list, data, where_node, where_node->prev);
 	if (NULL == new_node)
 	{
 		
@@ -136,15 +167,17 @@ dlist_iter_t DListInsert(dlist_iter_t where, void* data)
 	
 	new_node->prev->next = new_node;
 	new_node->next->prev = new_node;
+	++list->count;
 	
 	return (NodeToIter(new_node));
 }
 
-dlist_iter_t DListRemove(dlist_iter_t to_remove)
+dlist_iter_t DListRemove(dlist_t *list, dlist_iter_t to_remove)
 {
 	node_t *remove_node = NULL;
 	node_t *to_return = NULL;
 	
+	assert(list);
 	assert(IterToNode(to_remove));
 	
 	remove_node = IterToNode(to_remove);
@@ -152,8 +185,9 @@ dlist_iter_t DListRemove(dlist_iter_t to_remove)
 	
 	(to_remove->next)->prev = to_remove->prev;
 	to_remove->prev->next = to_remove->next;
+	--list->count;
 	
-	free(remove_node);
+	FreeNode(list, remove_node);
 	
 	return (to_return);
 }
@@ -178,13 +212,9 @@ void DListSetData(dlist_iter_t iter, void *data)
 
 size_t DListCount(const dlist_t *list)
 {
-	size_t count = 0;
-	
 	assert(list);
-
-    DListForEach(DListBegin(list), DListEnd(list), AddOne, &count);
 		
-	return (count);
+	return (list->count);
 }
 
 int DListIsEmpty(const dlist_t *list)
@@ -228,13 +258,34 @@ int DListForEach(dlist_iter_t from, dlist_iter_t to, action_func_t action,
     return (status);
 }
 
-void DListSplice(dlist_iter_t from, dlist_iter_t to, dlist_iter_t where)
+void DListSplice(dlist_t *src, dlist_iter_t from, dlist_iter_t to, 
+				 dlist_t *dest, dlist_iter_t where)
 {
 	node_t *from_prev = IterToNode(from)->prev;
 	node_t *to_prev = IterToNode(to)->prev;
 	node_t *where_prev = IterToNode(where)->prev;
+	node_t *runner = NULL;
+	size_t moved = 0;
 	
+	assert(src);
+	assert(dest);
 	assert(!IsWhereBetween(from, to, where));
+
+	/* nodes that change lists are counted, and released, by dest from now */
+	/* on, so both lists must take their nodes from the same place         */
+	if (src != dest)
+	{
+		assert(src->pool == dest->pool);
+
+		for (runner = IterToNode(from); runner != IterToNode(to); 
+													runner = runner->next)
+		{
+			++moved;
+		}
+
+		src->count -= moved;
+		dest->count += moved;
+	}
 	
 	where->prev->next = from;
 	to->prev->next = where;
@@ -278,7 +329,7 @@ dlist_iter_t DListPushBack(dlist_t *list, void *data)
 {
 	assert(list);
 
-	return (DListInsert(DListEnd(list), data));
+	return (DListInsert(list, DListEnd(list), data));
 }
 
 void *DListPopBack(dlist_t *list)
@@ -287,14 +338,14 @@ void *DListPopBack(dlist_t *list)
 	
 	assert(list);
 	
-	DListRemove(DListPrev(DListEnd(list)));
+	DListRemove(list, DListPrev(DListEnd(list)));
 	
 	return (data);
 }
 
 dlist_iter_t DListPushFront(dlist_t *list, void *data)
 {
-	return (DListInsert(DListBegin(list), data));
+	return (DListInsert(list, DListBegin(list), data));
 }
 
 void *DListPopFront(dlist_t *list)
@@ -303,15 +354,25 @@ void *DListPopFront(dlist_t *list)
 	
 	assert(list);
 	
-	DListRemove(DListBegin(list));
+	DListRemove(list, DListBegin(list));
 	
 	return (data);
 }
 
 /******************** HELPER FUNCTIONS ********************/
-static node_t *CreateNode(void *data, void *next, void *prev)
+static node_t *CreateNode(dlist_t *list, void *data, void *next, void *prev)
 {
-	node_t *new_node = (node_t *)(malloc)(sizeof(node_t));
+	node_t *new_node = NULL;
+
+	if (NULL != list->pool)
+	{
+		new_node = (node_t *)PoolAlloc(list->pool);
+	}
+	else
+	{
+		new_node = (node_t *)(malloc)(sizeof(node_t));
+	}
+
 	if (NULL == new_node)
 	{
 		return (NULL);
@@ -324,6 +385,18 @@ static node_t *CreateNode(void *data, void *next, void *prev)
 	return (new_node);
 }
 
+static void FreeNode(dlist_t *list, node_t *node)
+{
+	if (NULL != list->pool)
+	{
+		PoolFree(list->pool, node);
+	}
+	else
+	{
+		free(node);
+	}
+}
+
 static dlist_iter_t NodeToIter(const node_t *node)
 {
 	return ((dlist_iter_t)node);
@@ -344,15 +417,6 @@ static node_t *GoToEnd(node_t *node)
 	return (node);
 }
 
-static int AddOne(void *data , void *count)
-{	
-	(void)data;
-	
-	*(size_t *)count = *(size_t *)count + 1;
-	
-	return (SUCCESS);
-}
-
 static int IsWhereBetween(dlist_iter_t from, dlist_iter_t to, dlist_iter_t where)
 {
 	while (!DListIsIterSame(from, to))
@@ -3,36 +3,51 @@ Owner: Uri Naor
 Date: Feb 13, 2024
 */
 
-#include <stdio.h> /* printf */
 #include <stddef.h> /* size_t */
 #include <assert.h> /* assert */
-#include <stdlib.h> /* calloc */
+#include <stdlib.h> /* realloc */
 #include <string.h> /* memcpy */
 
 #include "dvector.h"
 
-#define GROWTH_REQUIRED_PERCENT 0.75
-#define SHRINK_REQUIRED_PERCENT 0.25
-#define GROWTH_FACTOR 2
-#define SHRINK_FACTOR 0.5
+#define GROWTH_FACTOR (2)
+#define SHRINK_FACTOR (2)
+#define SHRINK_RATIO (4) /* shrinks once size is down to capacity / 4 */
 #define SUCCESS 0
 #define FAIL -1
 
 struct dvector
 {
 	size_t capacity;
+	size_t min_capacity; /* the capacity it was created with */
+	size_t inline_capacity; /* elements that fit past the struct, 0 if none */
 	size_t element_size;
 	size_t size;
 	void *elements;
 };
 
+/******************** FORWARD DECLARATIONS ********************/
+static int GrowTo(dvector_t *dvector, size_t size);
+static void *ElementAt(const dvector_t *dvector, size_t idx);
+static void *InlineBuffer(const dvector_t *dvector);
+static int IsInline(const dvector_t *dvector);
+
 /******************** FUNCTIONS ********************/
 dvector_t *DVectorCreate(size_t capacity , size_t element_size)
 {
-	dvector_t *new_vector = (dvector_t *)malloc(sizeof(dvector_t));
+	dvector_t *new_vector = NULL;
+	
+	assert(element_size);
+	
+	/* an empty buffer could not double */
+	if (0 == capacity)
+	{
+		capacity = 1;
+	}
+	
+	new_vector = (dvector_t *)malloc(sizeof(dvector_t));
 	if(NULL == new_vector)
 	{
-		printf("Allocation creating a vector has failed.\n");
 		return NULL;
 	}
 	
@@ -40,14 +55,44 @@ dvector_t *DVectorCreate(size_t capacity , size_t element_size)
 	if(NULL == new_vector->elements)
 	{
 		free(new_vector);
-		printf("Allocation for elements has failed.\n");
-		
-		return NULL; 
+	
+		return NULL;
 	}
 	
 	new_vector->capacity = capacity;
+	new_vector->min_capacity = capacity;
+	new_vector->inline_capacity = 0;
+	new_vector->element_size = element_size;
+	new_vector->size = 0;
+	
+	return new_vector;
+}
+
+dvector_t *DVectorCreateSmall(size_t inline_capacity, size_t element_size)
+{
+	dvector_t *new_vector = NULL;
+	
+	assert(element_size);
+	
+	if (0 == inline_capacity)
+	{
+		inline_capacity = 1;
+	}
+	
+	/* one block, the first elements right after the struct */
+	new_vector = (dvector_t *)malloc(sizeof(dvector_t) + 
+									 inline_capacity * element_size);
+	if(NULL == new_vector)
+	{
+		return NULL;
+	}
+	
+	new_vector->capacity = inline_capacity;
+	new_vector->min_capacity = inline_capacity;
+	new_vector->inline_capacity = inline_capacity;
 	new_vector->element_size = element_size;
 	new_vector->size = 0;
+	new_vector->elements = InlineBuffer(new_vector);
 	
 	return new_vector;
 }
@@ -56,7 +101,10 @@ void DvectorDestroy(dvector_t *dvector)
 {
 	assert(dvector);
 	
-	free(dvector->elements);
+	if (!IsInline(dvector))
+	{
+		free(dvector->elements);
+	}
 	free(dvector);
 }
 
@@ -68,22 +116,54 @@ int DvectorReserve(dvector_t *dvector, size_t capacity)
 	assert(dvector);
 	assert(capacity);
 	
+	/* never drops an element */
 	if (capacity < dvector->size)
 	{
-		printf("Capacity smaller than size, "
-		"changing capacity to current size.\n");
 		capacity = dvector->size;
 	}
 	
-	temp_address_holder = realloc(dvector->elements, 
-	capacity * dvector->element_size);
-	if(NULL == temp_address_holder)
+	/* the buffer size in bytes would not fit a size_t */
+	if (capacity > (size_t)-1 / dvector->element_size)
 	{
-		printf("Reallocation during reserve has failed.\n");
-		
 		return FAIL;
 	}
 	
+	/* small mode: fits the inline buffer - moves back in, or stays */
+	if (capacity <= dvector->inline_capacity)
+	{
+		if (!IsInline(dvector))
+		{
+			memcpy(InlineBuffer(dvector), dvector->elements, 
+				   dvector->size * dvector->element_size);
+			free(dvector->elements);
+			dvector->elements = InlineBuffer(dvector);
+		}
+		dvector->capacity = dvector->inline_capacity;
+		
+		return SUCCESS;
+	}
+	
+	/* spills out of the inline buffer, which realloc must not touch */
+	if (IsInline(dvector))
+	{
+		temp_address_holder = malloc(capacity * dvector->element_size);
+		if(NULL == temp_address_holder)
+		{
+			return FAIL;
+		}
+		memcpy(temp_address_holder, dvector->elements, 
+			   dvector->size * dvector->element_size);
+	}
+	else
+	{
+		temp_address_holder = realloc(dvector->elements,
+		capacity * dvector->element_size);
+		if(NULL == temp_address_holder)
+		{
+			return FAIL;
+		}
+	}
+	
 	dvector->elements = temp_address_holder;
 	
 	dvector->capacity = capacity;
@@ -93,22 +173,79 @@ int DvectorReserve(dvector_t *dvector, size_t capacity)
 
 int DvectorPushBack(dvector_t *dvector, const void *data)
 {
-	void *target;
-	
-	assert(dvector);	
-	assert(data);	
+	assert(dvector);
+	assert(data);
 	
-	target = (char *)(dvector->elements) + 
-	(dvector->size * dvector->element_size);
-	memcpy(target, data, dvector->element_size);
+	/* room first, a failed push leaves the vector as it was */
+	if (dvector->size == dvector->capacity &&
+		SUCCESS != GrowTo(dvector, dvector->size + 1))
+	{
+		return FAIL;
+	}
 	
+	memcpy(ElementAt(dvector, dvector->size), data, dvector->element_size);
 	++dvector->size;
 	
-	if(dvector->size >= (size_t)(dvector->capacity * GROWTH_REQUIRED_PERCENT))
+	return SUCCESS;
+}
+
+int DvectorPushBackMany(dvector_t *dvector, const void *data, size_t n)
+{
+	assert(dvector);
+	assert(data || 0 == n);
+	
+	/* the new size would not fit a size_t */
+	if (n > (size_t)-1 - dvector->size ||
+		SUCCESS != GrowTo(dvector, dvector->size + n))
+	{
+		return FAIL;
+	}
+	
+	memcpy(ElementAt(dvector, dvector->size), data, n * dvector->element_size);
+	dvector->size += n;
+	
+	return SUCCESS;
+}
+
+int DvectorInsertRange(dvector_t *dvector, size_t idx, const void *data,
+					   size_t n)
+{
+	assert(dvector);
+	assert(data || 0 == n);
+	assert(idx <= dvector->size);
+	
+	/* the new size would not fit a size_t */
+	if (n > (size_t)-1 - dvector->size ||
+		SUCCESS != GrowTo(dvector, dvector->size + n))
+	{
+		return FAIL;
+	}
+	
+	memmove(ElementAt(dvector, idx + n), ElementAt(dvector, idx),
+			(dvector->size - idx) * dvector->element_size);
+	memcpy(ElementAt(dvector, idx), data, n * dvector->element_size);
+	dvector->size += n;
+	
+	return SUCCESS;
+}
+
+int DvectorResize(dvector_t *dvector, size_t size)
+{
+	assert(dvector);
+	
+	if (SUCCESS != GrowTo(dvector, size))
 	{
-		return DvectorReserve(dvector, (size_t)(dvector->capacity * GROWTH_FACTOR));
+		return FAIL;
+	}
+	
+	if (size > dvector->size)
+	{
+		memset(ElementAt(dvector, dvector->size), 0,
+			   (size - dvector->size) * dvector->element_size);
 	}
 	
+	dvector->size = size;
+	
 	return SUCCESS;
 }
 
@@ -126,23 +263,26 @@ size_t DvectorSize(const dvector_t *dvector)
 	return dvector->size;
 }
 
-void DvectorPopBack(dvector_t *dvector)
+int DvectorPopBack(dvector_t *dvector)
 {
 	assert(dvector);
 	
 	if (0 == dvector->size)
 	{
-		printf("Can't pop, vector is already empty.\n");
-		
-		return;
+		return FAIL;
 	}
 	
 	--dvector->size;
 	
-	if(dvector->size <= (size_t)(dvector->capacity * SHRINK_REQUIRED_PERCENT))
+	/* halving leaves the vector half full, as far from the next shrink */
+	/* as from the next growth. a failed shrink keeps the larger buffer */
+	if (dvector->size <= dvector->capacity / SHRINK_RATIO &&
+		dvector->capacity / SHRINK_FACTOR >= dvector->min_capacity)
 	{
-		DvectorReserve(dvector, (size_t)(dvector->capacity * SHRINK_FACTOR));
+		DvectorReserve(dvector, dvector->capacity / SHRINK_FACTOR);
 	}
+	
+	return SUCCESS;
 }
 
 void *DvectorGetAccessToElement(const dvector_t *dvector, size_t idx)
@@ -150,25 +290,60 @@ void *DvectorGetAccessToElement(const dvector_t *dvector, size_t idx)
 	assert(dvector);
 	assert(idx < dvector->size);
 	
-	return ((char *)(dvector->elements) + (idx * dvector->element_size));
+	return (ElementAt(dvector, idx));
 }
 
 int DvectorShrink(dvector_t *dvector)
 {
-	size_t shrink_capacity = 0;
-	
 	assert(dvector);
 	
-	if ((size_t)(dvector->capacity * SHRINK_REQUIRED_PERCENT) < dvector->size ||
-	    (size_t)(dvector->capacity * SHRINK_FACTOR) == 0)
+	if (dvector->capacity / SHRINK_RATIO < dvector->size ||
+	    dvector->capacity / SHRINK_FACTOR == 0)
 	{
-		printf("Can't shrink, "
-		"size is bigger than 25%% of the capacity,"
-		" or capacity at minimum already.\n");
 		return FAIL;
 	}
 	
-	shrink_capacity = (size_t)(dvector->capacity * SHRINK_FACTOR);
+	return DvectorReserve(dvector, dvector->capacity / SHRINK_FACTOR);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+/* doubles until size fits, one realloc for a whole batch */
+static int GrowTo(dvector_t *dvector, size_t size)
+{
+	size_t capacity = dvector->capacity;
+	
+	if (size <= capacity)
+	{
+		return SUCCESS;
+	}
 	
-	return DvectorReserve(dvector, shrink_capacity);
+	while (capacity < size)
+	{
+		/* doubling would wrap around, take just what is asked for */
+		if (capacity > (size_t)-1 / GROWTH_FACTOR)
+		{
+			capacity = size;
+			break;
+		}
+		
+		capacity *= GROWTH_FACTOR;
+	}
+	
+	return DvectorReserve(dvector, capacity);
+}
+
+static void *ElementAt(const dvector_t *dvector, size_t idx)
+{
+	return ((char *)(dvector->elements) + (idx * dvector->element_size));
+}
+
+static void *InlineBuffer(const dvector_t *dvector)
+{
+	return ((char *)dvector + sizeof(dvector_t));
+}
+
+static int IsInline(const dvector_t *dvector)
+{
+	return (0 != dvector->inline_capacity && 
+			dvector->elements == InlineBuffer(dvector));
 }
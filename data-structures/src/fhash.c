@@ -0,0 +1,306 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#include <stdlib.h> /* malloc */
+#include <assert.h> /* assert */
+
+#include "fhash.h" /* fhash_t */
+
+#define MIN_CAPACITY (8)
+/* the table grows once it is more than MAX_LOAD_NUM / MAX_LOAD_DEN full */
+#define MAX_LOAD_NUM (15)
+#define MAX_LOAD_DEN (16)
+
+/******************** TYPEDEFS, ENUMS & STRUCTS ********************/
+
+typedef struct slot
+{
+    size_t hash;
+    const void *value; /* NULL marks an empty slot */
+} slot_t;
+
+struct fhash
+{
+    hash_func_t hash_func;
+    hash_cmp_func_t cmp_func;
+    size_t size;
+    size_t mask; /* capacity - 1, capacity is a power of two */
+    slot_t *slots;
+};
+
+/******************** FORWARD DECLARATIONS ********************/
+static size_t RoundUpPow2(size_t num);
+static size_t MixHash(size_t hash);
+static size_t ProbeDistance(const slot_t *slots, size_t mask, size_t idx);
+static void PlaceSlot(slot_t *slots, size_t mask, size_t hash,
+                                                            const void *value);
+static size_t FindSlot(const fhash_t *hash, size_t hash_code,
+                                                            const void *value);
+static status_t Grow(fhash_t *hash);
+
+/******************** FUNCTIONS ********************/
+fhash_t *FHashCreate(hash_func_t hash_func, hash_cmp_func_t cmp_func,
+                                                                size_t capacity)
+{
+    fhash_t *new_hash = NULL;
+
+    assert(hash_func);
+    assert(cmp_func);
+
+    new_hash = (fhash_t *)malloc(sizeof(fhash_t));
+    if (NULL == new_hash)
+    {
+        return (NULL);
+    }
+
+    capacity = RoundUpPow2(capacity < MIN_CAPACITY ? MIN_CAPACITY : capacity);
+
+    new_hash->slots = (slot_t *)calloc(capacity, sizeof(slot_t));
+    if (NULL == new_hash->slots)
+    {
+        free(new_hash);
+        return (NULL);
+    }
+
+    new_hash->hash_func = hash_func;
+    new_hash->cmp_func = cmp_func;
+    new_hash->size = 0;
+    new_hash->mask = capacity - 1;
+
+    return (new_hash);
+}
+
+void FHashDestroy(fhash_t *hash)
+{
+    assert(hash);
+
+    free(hash->slots);
+    hash->slots = NULL;
+
+    free(hash);
+}
+
+status_t FHashInsert(fhash_t *hash, const void *value)
+{
+    assert(hash);
+    assert(value);
+
+    if ((hash->size + 1) * MAX_LOAD_DEN > (hash->mask + 1) * MAX_LOAD_NUM)
+    {
+        if (SUCCESS != Grow(hash))
+        {
+            return (FAIL);
+        }
+    }
+
+    PlaceSlot(hash->slots, hash->mask, MixHash(hash->hash_func(value)), value);
+    ++hash->size;
+
+    return (SUCCESS);
+}
+
+void FHashRemove(fhash_t *hash, const void *value)
+{
+    size_t idx = 0;
+    size_t next = 0;
+    slot_t *slots = NULL;
+
+    assert(hash);
+    assert(value);
+
+    idx = FindSlot(hash, MixHash(hash->hash_func(value)), value);
+    if (idx > hash->mask)
+    {
+        return;
+    }
+
+    /* backward shift deletion - no tombstones are left behind */
+    slots = hash->slots;
+    next = (idx + 1) & hash->mask;
+    while (NULL != slots[next].value &&
+           0 != ProbeDistance(slots, hash->mask, next))
+    {
+        slots[idx] = slots[next];
+        idx = next;
+        next = (next + 1) & hash->mask;
+    }
+
+    slots[idx].value = NULL;
+    --hash->size;
+}
+
+void *FHashFind(const fhash_t *hash, const void *value)
+{
+    size_t idx = 0;
+
+    assert(hash);
+    assert(value);
+
+    idx = FindSlot(hash, MixHash(hash->hash_func(value)), value);
+    if (idx > hash->mask)
+    {
+        return (NULL);
+    }
+
+    return ((void *)hash->slots[idx].value);
+}
+
+int FHashIsEmpty(const fhash_t *hash)
+{
+    assert(hash);
+
+    return (0 == hash->size);
+}
+
+size_t FHashSize(const fhash_t *hash)
+{
+    assert(hash);
+
+    return (hash->size);
+}
+
+int FHashForEach(fhash_t *hash, hash_action_func_t action, void *params)
+{
+    size_t i = 0;
+    int status = SUCCESS;
+
+    assert(hash);
+    assert(action);
+
+    for (i = 0; i <= hash->mask && SUCCESS == status; ++i)
+    {
+        if (NULL != hash->slots[i].value)
+        {
+            status = action((void *)hash->slots[i].value, params);
+        }
+    }
+
+    return (status);
+}
+
+double FHashLoadFactor(const fhash_t *hash)
+{
+    assert(hash);
+
+    return ((double)hash->size / (hash->mask + 1));
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static size_t RoundUpPow2(size_t num)
+{
+    size_t pow2 = 1;
+
+    while (pow2 < num)
+    {
+        pow2 <<= 1;
+    }
+
+    return (pow2);
+}
+
+/* spreads weak user hashes so the low bits used for indexing are mixed */
+static size_t MixHash(size_t hash)
+{
+    hash ^= hash >> 16;
+    hash *= 0x45D9F3BUL;
+    hash ^= hash >> 16;
+
+    return (hash);
+}
+
+static size_t ProbeDistance(const slot_t *slots, size_t mask, size_t idx)
+{
+    return ((idx - (slots[idx].hash & mask)) & mask);
+}
+
+static void PlaceSlot(slot_t *slots, size_t mask, size_t hash,
+                                                            const void *value)
+{
+    size_t idx = hash & mask;
+    size_t dist = 0;
+    size_t curr_dist = 0;
+    slot_t carry;
+    slot_t temp;
+
+    carry.hash = hash;
+    carry.value = value;
+
+    while (NULL != slots[idx].value)
+    {
+        curr_dist = ProbeDistance(slots, mask, idx);
+
+        /* Robin Hood - take the slot from an entry closer to its home */
+        if (curr_dist < dist)
+        {
+            temp = slots[idx];
+            slots[idx] = carry;
+            carry = temp;
+            dist = curr_dist;
+        }
+
+        idx = (idx + 1) & mask;
+        ++dist;
+    }
+
+    slots[idx] = carry;
+}
+
+/* returns the slot index of the value, or (mask + 1) if it is not present */
+static size_t FindSlot(const fhash_t *hash, size_t hash_code,
+                                                            const void *value)
+{
+    size_t mask = hash->mask;
+    size_t idx = hash_code & mask;
+    size_t dist = 0;
+    const slot_t *slots = hash->slots;
+
+    while (NULL != slots[idx].value)
+    {
+        /* every entry we could still meet is closer to its home than we are */
+        if (ProbeDistance(slots, mask, idx) < dist)
+        {
+            break;
+        }
+
+        if (slots[idx].hash == hash_code &&
+            0 == hash->cmp_func(slots[idx].value, value))
+        {
+            return (idx);
+        }
+
+        idx = (idx + 1) & mask;
+        ++dist;
+    }
+
+    return (mask + 1);
+}
+
+static status_t Grow(fhash_t *hash)
+{
+    size_t i = 0;
+    size_t new_mask = (hash->mask << 1) | 1;
+    slot_t *new_slots = NULL;
+
+    new_slots = (slot_t *)calloc(new_mask + 1, sizeof(slot_t));
+    if (NULL == new_slots)
+    {
+        return (FAIL);
+    }
+
+    for (i = 0; i <= hash->mask; ++i)
+    {
+        if (NULL != hash->slots[i].value)
+        {
+            PlaceSlot(new_slots, new_mask, hash->slots[i].hash,
+                                                        hash->slots[i].value);
+        }
+    }
+
+    free(hash->slots);
+    hash->slots = new_slots;
+    hash->mask = new_mask;
+
+    return (SUCCESS);
+}
@@ -7,43 +7,65 @@ Date: Mar 26, 2024
 #include <assert.h> /* assert */
 
 #include "hash.h" /* Added missing include to verify prototypes against definitions */
-#include "dlist.h" /* dlist_t */
+
+#define DEFAULT_MIN_LOAD (0.125)
+#define DEFAULT_MAX_LOAD (1.0)
+#define MIGRATE_STEP (4) /* old buckets moved by every insert, remove and find */
+#define EMPTY_VISITS (10) /* empty buckets skipped per bucket of MIGRATE_STEP */
+#define FIND_BATCH (16) /* keys whose buckets are prefetched together */
+
+#ifdef __GNUC__
+#define PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define PREFETCH(addr) ((void)(addr))
+#endif
 
 /******************** TYPEDEFS, ENUMS & STRUCTS ********************/
 
-struct hash
+/* a bucket is a chain of nodes, each a single allocation that caches the */
+/* hash of its value, so a hash mismatch skips cmp_func entirely          */
+typedef struct hash_node node_t;
+
+struct hash_node
 {
-    hash_func_t hash_func;
-    hash_cmp_func_t cmp_func;
-    size_t table_size;
-    dlist_t **table;
+    node_t *next;
+    size_t hash_code;
+    const void *value;
 };
 
-typedef struct params
+struct hash
 {
+    hash_func_t hash_func;
     hash_cmp_func_t cmp_func;
-    void *data;
-}param_t;
-
-enum bool
-{
-    FALSE = 0,
-    TRUE
+    size_t table_size;
+    node_t **table; /* the first node of every bucket, NULL if it is empty */
+    size_t old_size;
+    node_t **old_table; /* not NULL while a rehash is in progress */
+    size_t migrate_idx; /* next bucket of old_table to be moved */
+    size_t count;
+    size_t min_size;
+    double min_load;
+    double max_load;
 };
 
 /******************** FORWARD DECLARATIONS ********************/
 int HashForEach(hash_t *hash, hash_action_func_t action, void *params);
-static void DestroyTable(hash_t *hash, size_t table_size);
-static int IsMatch(const void *data, void *params);
-static int AddOne(void *data , void *count);
+static void DestroyTable(node_t **table, size_t table_size);
 static void InitTable(hash_t *hash, size_t table_size, hash_func_t hash_func, 
                                                       hash_cmp_func_t cmp_func);
+static node_t **FindInBucket(const hash_t *hash, node_t **bucket,
+                                        size_t hash_code, const void *value);
+static node_t **FindNode(const hash_t *hash, size_t hash_code,
+                                                            const void *value);
+static void CheckLoad(hash_t *hash);
+static void MigrateStep(hash_t *hash);
+static int ForEachInTable(node_t **table, size_t table_size,
+                                    hash_action_func_t action, void *params);
 
 /******************** FUNCTIONS ********************/
 hash_t *HashCreate(hash_func_t hash_func, hash_cmp_func_t cmp_func, size_t table_size)
 {
     hash_t *new_hash = NULL;
-    size_t i = 0;
     
     assert(hash_func);
     assert(cmp_func);
@@ -55,24 +77,13 @@ hash_t *HashCreate(hash_func_t hash_func, hash_cmp_func_t cmp_func, size_t table
         return (NULL);
     }
 
-    new_hash->table = malloc(sizeof(dlist_t *) * table_size);
+    new_hash->table = (node_t **)calloc(table_size, sizeof(node_t *));
     if (NULL == new_hash->table)
     {
         free(new_hash);
         return (NULL);
     }
 
-    for (i = 0; i < table_size; i++)
-    {
-        new_hash->table[i] = DListCreate();
-        if (NULL == new_hash->table[i])
-        {
-            DestroyTable(new_hash, i);
-            free(new_hash);
-            return (NULL);
-        }
-    }
-
     InitTable(new_hash, table_size, hash_func, cmp_func);
 
     return (new_hash);
@@ -82,126 +93,189 @@ void HashDestroy(hash_t *hash)
 {
     assert(hash);
 
-    DestroyTable(hash, hash->table_size);
+    DestroyTable(hash->table, hash->table_size);
+    if (NULL != hash->old_table)
+    {
+        DestroyTable(hash->old_table, hash->old_size);
+    }
 
     free(hash);
 }
 
+void HashSetLoadLimits(hash_t *hash, double min_load, double max_load)
+{
+    assert(hash);
+    assert(0 <= min_load);
+    assert(0 < max_load);
+    assert(min_load < max_load / 2);
+
+    hash->min_load = min_load;
+    hash->max_load = max_load;
+}
+
 status_t HashInsert(hash_t *hash, const void *value)
 {
-    size_t idx = 0;
-    dlist_iter_t iter = {0};
+    node_t *node = NULL;
+    node_t **bucket = NULL;
 
     assert(hash);
     assert(value);
 
-    idx = hash->hash_func(value) % hash->table_size;
+    MigrateStep(hash);
 
-    iter = DListPushFront(hash->table[idx], (void *)value);
-    if (DListIsIterSame(iter, DListEnd(hash->table[idx])))
+    node = (node_t *)malloc(sizeof(node_t));
+    if (NULL == node)
     {
         return (FAIL);
     }
 
+    node->hash_code = hash->hash_func(value);
+    node->value = value;
+
+    bucket = &hash->table[node->hash_code % hash->table_size];
+    node->next = *bucket;
+    *bucket = node;
+
+    ++hash->count;
+    CheckLoad(hash);
+
     return (SUCCESS);
 }
 
 void HashRemove(hash_t *hash, const void *value)
 {
-    size_t idx = 0;
-    dlist_iter_t iter = {0};
-    param_t params;
+    node_t **link = NULL;
+    node_t *node = NULL;
 
     assert(hash);
     assert(value);
 
-    params.data = (void *)value;
-    params.cmp_func = hash->cmp_func;
-
-    idx = hash->hash_func(value) % hash->table_size;
-
-    iter = DListFind(DListBegin(hash->table[idx]), DListEnd(hash->table[idx]), IsMatch, &params);
+    MigrateStep(hash);
 
-    if (!DListIsIterSame(iter, DListEnd(hash->table[idx]))) 
+    link = FindNode(hash, hash->hash_func(value), value);
+    if (NULL == link)
     {
-        DListRemove(iter);
+        return;
     }
+
+    node = *link;
+    *link = node->next;
+    free(node);
+
+    --hash->count;
+    CheckLoad(hash);
 }
 
 void *HashFind(const hash_t *hash, const void *value)
 {
-    size_t idx = 0;
-    dlist_iter_t iter = {0};
-    param_t params;
+    node_t **link = NULL;
 
     assert(hash);
     assert(value);
 
-    params.data = (void *)value;
-    params.cmp_func = hash->cmp_func;
+    /* a find is logically const, but still helps a pending rehash along */
+    MigrateStep((hash_t *)hash);
 
-    idx = hash->hash_func(value) % hash->table_size;
-
-    iter = DListFind(DListBegin(hash->table[idx]), DListEnd(hash->table[idx]), IsMatch, &params);
-    if (DListIsIterSame(DListEnd(hash->table[idx]), iter))
+    link = FindNode(hash, hash->hash_func(value), value);
+    if (NULL == link)
     {
-        return NULL;
+        return (NULL);
     }
 
-    return (DListGetData(iter));
+    return ((void *)(*link)->value);
 }
 
-int HashIsEmpty(const hash_t *hash)
+void HashFindMany(const hash_t *hash, const void *keys[], size_t n,
+                                                                void *out[])
 {
+    size_t hash_codes[FIND_BATCH];
+    size_t batch = 0;
     size_t i = 0;
-    int status = TRUE;
+    size_t j = 0;
+    node_t **link = NULL;
+    node_t **old_bucket = NULL;
 
     assert(hash);
+    assert(keys || 0 == n);
+    assert(out || 0 == n);
+
+    MigrateStep((hash_t *)hash);
 
-    for (i = 0; i < hash->table_size; i++)
+    for (i = 0; i < n; i += batch)
     {
-        status = DListIsEmpty(hash->table[i]);
-        if (FALSE == status)
+        batch = (n - i < FIND_BATCH) ? n - i : FIND_BATCH;
+
+        /* pass 1 - hash every key and prefetch its slots in the tables */
+        for (j = 0; j < batch; ++j)
         {
-            return (FALSE);
+            hash_codes[j] = hash->hash_func(keys[i + j]);
+            PREFETCH(&hash->table[hash_codes[j] % hash->table_size]);
+            if (NULL != hash->old_table)
+            {
+                PREFETCH(&hash->old_table[hash_codes[j] % hash->old_size]);
+            }
+        }
+
+        /* pass 2 - load the slots and prefetch the first node of each */
+        for (j = 0; j < batch; ++j)
+        {
+            if (NULL != hash->table[hash_codes[j] % hash->table_size])
+            {
+                PREFETCH(hash->table[hash_codes[j] % hash->table_size]);
+            }
+            if (NULL != hash->old_table &&
+                NULL != hash->old_table[hash_codes[j] % hash->old_size])
+            {
+                PREFETCH(hash->old_table[hash_codes[j] % hash->old_size]);
+            }
+        }
+
+        /* pass 3 - probe, by now the memory is hopefully in cache */
+        for (j = 0; j < batch; ++j)
+        {
+            link = FindInBucket(hash,
+                            &hash->table[hash_codes[j] % hash->table_size],
+                                                hash_codes[j], keys[i + j]);
+            if (NULL == link && NULL != hash->old_table)
+            {
+                old_bucket = &hash->old_table[hash_codes[j] % hash->old_size];
+                link = FindInBucket(hash, old_bucket, hash_codes[j],
+                                                                keys[i + j]);
+            }
+
+            out[i + j] = (NULL == link) ? NULL : (void *)(*link)->value;
         }
     }
+}
+
+int HashIsEmpty(const hash_t *hash)
+{
+    assert(hash);
 
-    return (TRUE);
+    return (0 == hash->count);
 }
 
 size_t HashSize(const hash_t *hash)
 {
-    size_t count = 0;
-
     assert(hash);
 
-    HashForEach((hash_t *)hash, AddOne, &count);
-
-    return (count);
+    return (hash->count);
 }
 
 int HashForEach(hash_t *hash, hash_action_func_t action, void *params)
 {
-    size_t i = 0;
     int status = SUCCESS;
-    dlist_iter_t begin = {0};
-    dlist_iter_t end = {0};
 
     assert(hash);
     assert(action);
 
-    for (i = 0; i < hash->table_size; i++)
-    {
-        begin = DListBegin(hash->table[i]);
-        end = DListEnd(hash->table[i]);
+    status = ForEachInTable(hash->table, hash->table_size, action, params);
 
-        status = DListForEach(begin, end, action, params);
-        
-        if (SUCCESS != status) 
-        {
-            return (status);
-        }
+    if (SUCCESS == status && NULL != hash->old_table)
+    {
+        status = ForEachInTable(hash->old_table + hash->migrate_idx,
+                                    hash->old_size - hash->migrate_idx,
+                                                            action, params);
     }
 
     return (status);
@@ -209,7 +283,9 @@ int HashForEach(hash_t *hash, hash_action_func_t action, void *params)
 
 double HashLoadFactor(const hash_t *hash)
 {
-    return ((double)HashSize(hash) / hash->table_size);
+    assert(hash);
+
+    return ((double)hash->count / hash->table_size);
 }
 
 /******************** HELPER FUNCTIONS ********************/
@@ -224,36 +300,167 @@ static void InitTable(hash_t *hash, size_t table_size, hash_func_t hash_func,
     hash->table_size = table_size;
     hash->hash_func = hash_func;
     hash->cmp_func = cmp_func;
+    hash->old_size = 0;
+    hash->old_table = NULL;
+    hash->migrate_idx = 0;
+    hash->count = 0;
+    hash->min_size = table_size;
+    hash->min_load = DEFAULT_MIN_LOAD;
+    hash->max_load = DEFAULT_MAX_LOAD;
 }
 
-static void DestroyTable(hash_t *hash, size_t table_size)
+static void DestroyTable(node_t **table, size_t table_size)
 {
     size_t i = 0;
+    node_t *node = NULL;
+    node_t *next = NULL;
 
-    assert(hash);
-    assert(table_size);
+    assert(table);
 
     for (i = 0; i < table_size; i++)
     {
-        DListDestroy(hash->table[i]);
+        for (node = table[i]; NULL != node; node = next)
+        {
+            next = node->next;
+            free(node);
+        }
+    }
+
+    free(table);
+}
+
+/* returns the link that points to the matching node, so it can be unlinked */
+static node_t **FindInBucket(const hash_t *hash, node_t **bucket,
+                                        size_t hash_code, const void *value)
+{
+    node_t **link = NULL;
+
+    for (link = bucket; NULL != *link; link = &(*link)->next)
+    {
+        if ((*link)->hash_code == hash_code &&
+            0 == hash->cmp_func((*link)->value, value))
+        {
+            return (link);
+        }
+    }
+
+    return (NULL);
+}
+
+/* a node lives in the new table, or in the old one until it is migrated */
+static node_t **FindNode(const hash_t *hash, size_t hash_code,
+                                                            const void *value)
+{
+    node_t **link = FindInBucket(hash,
+                    &hash->table[hash_code % hash->table_size], hash_code, value);
+
+    if (NULL == link && NULL != hash->old_table)
+    {
+        link = FindInBucket(hash, &hash->old_table[hash_code % hash->old_size],
+                                                            hash_code, value);
+    }
+
+    return (link);
+}
+
+/* starts a resize if the load factor left the limits, only the new bucket */
+/* array is allocated here - the nodes themselves move in MigrateStep       */
+static void CheckLoad(hash_t *hash)
+{
+    size_t new_size = hash->table_size;
+    node_t **new_table = NULL;
+
+    if (NULL != hash->old_table)
+    {
+        return;
+    }
+
+    if (hash->count > hash->max_load * hash->table_size)
+    {
+        new_size = hash->table_size * 2;
+    }
+    else if (hash->count < hash->min_load * hash->table_size &&
+             hash->table_size / 2 >= hash->min_size)
+    {
+        new_size = hash->table_size / 2;
+    }
+    else
+    {
+        return;
+    }
+
+    new_table = (node_t **)calloc(new_size, sizeof(node_t *));
+    if (NULL == new_table)
+    {
+        return; /* keep working with the current table */
     }
 
-    free(hash->table);
+    hash->old_table = hash->table;
+    hash->old_size = hash->table_size;
+    hash->migrate_idx = 0;
+    hash->table = new_table;
+    hash->table_size = new_size;
 }
 
-static int IsMatch(const void *data, void *params)
+static void MigrateStep(hash_t *hash)
 {
-    assert(data);
-    assert(params);
+    size_t step = 0;
+    node_t *node = NULL;
+    node_t **new_bucket = NULL;
+
+    if (NULL == hash->old_table)
+    {
+        return;
+    }
+
+    for (step = 0; step < MIGRATE_STEP * EMPTY_VISITS &&
+                   hash->migrate_idx < hash->old_size; ++hash->migrate_idx)
+    {
+        if (NULL == hash->old_table[hash->migrate_idx])
+        {
+            ++step;
+            continue;
+        }
+
+        step += EMPTY_VISITS;
+
+        /* relink the nodes themselves, nothing is allocated on the way */
+        while (NULL != hash->old_table[hash->migrate_idx])
+        {
+            node = hash->old_table[hash->migrate_idx];
+            hash->old_table[hash->migrate_idx] = node->next;
+
+            new_bucket = &hash->table[node->hash_code % hash->table_size];
+            node->next = *new_bucket;
+            *new_bucket = node;
+        }
+    }
+
+    if (hash->migrate_idx == hash->old_size)
+    {
+        free(hash->old_table);
+        hash->old_table = NULL;
+        hash->old_size = 0;
 
-    return (!((param_t *)params)->cmp_func(data, ((param_t *)params)->data));
+        CheckLoad(hash);
+    }
 }
 
-static int AddOne(void *data , void *count)
-{	
-	(void)data;
-	
-	*(size_t *)count = *(size_t *)count + 1;
-	
-	return (SUCCESS);
+static int ForEachInTable(node_t **table, size_t table_size,
+                                    hash_action_func_t action, void *params)
+{
+    size_t i = 0;
+    node_t *node = NULL;
+    int status = SUCCESS;
+
+    for (i = 0; i < table_size && SUCCESS == status; i++)
+    {
+        for (node = table[i]; NULL != node && SUCCESS == status;
+                                                            node = node->next)
+        {
+            status = action((void *)node->value, params);
+        }
+    }
+
+    return (status);
 }
@@ -8,22 +8,44 @@ Date: Mar 30, 2024
 
 #include "dvector.h"
 #include "heap.h"
+#include "pool.h"
 
 #define LEFT_CHILD(i) (2*(i) + 1)
 #define RIGHT_CHILD(i) (2*(i) + 2)
 #define PARENT(i) (((i) - 1) / 2)
 #define GET_VALUE(p) ((void *)*(size_t *)(p))
+#define NODES_PER_SLAB (256)
 
 /******************** STRUCTS ********************/
 struct heap
 {
     heap_cmp_func_t cmp_func;
-    dvector_t *heap_container; 
+    dvector_t *heap_container;
+    pool_t *nodes; /* NULL unless indexed, the container then holds slots */
 };
 
+/* what a handle points to, it only tracks where its element is */
+struct heap_node
+{
+    size_t idx; /* kept up to date on every swap */
+};
+
+/* an element of an indexed heap - the data comes first, as in a plain */
+/* heap, so comparing does not have to go through the node              */
+typedef struct heap_slot
+{
+    void *data;
+    struct heap_node *node;
+} heap_slot_t;
+
 /******************** FORWARD DECLARATIONS ********************/
 static void HeapifyUp(heap_t *heap, size_t idx);
 static void HeapifyDown(heap_t *heap, size_t idx);
+static void Heapify(heap_t *heap);
+static status_t AppendAll(heap_t *heap, void **array, size_t n);
+static void *RemoveAt(heap_t *heap, size_t idx);
+static void *DataAt(const heap_t *heap, size_t idx);
+static void SwapAt(heap_t *heap, size_t a, size_t b);
 static void Swap(size_t *a, size_t *b);
 
 /******************** FUNCTIONS ********************/
@@ -40,6 +62,7 @@ heap_t *HeapCreate(heap_cmp_func_t cmp_func)
     }
 
     new_heap->cmp_func = cmp_func;
+    new_heap->nodes = NULL;
     new_heap->heap_container = DVectorCreate(100, sizeof(size_t));
     if (NULL == new_heap->heap_container)
     {
@@ -50,10 +73,71 @@ heap_t *HeapCreate(heap_cmp_func_t cmp_func)
     return (new_heap);
 }
 
+heap_t *HeapCreateIndexed(heap_cmp_func_t cmp_func)
+{
+    heap_t *new_heap = NULL;
+
+    assert(cmp_func);
+
+    new_heap = (heap_t *)malloc(sizeof(heap_t));
+    if (NULL == new_heap)
+    {
+        return (NULL);
+    }
+
+    new_heap->cmp_func = cmp_func;
+    new_heap->heap_container = DVectorCreate(100, sizeof(heap_slot_t));
+    new_heap->nodes = PoolCreate(sizeof(struct heap_node), NODES_PER_SLAB);
+    if (NULL == new_heap->heap_container || NULL == new_heap->nodes)
+    {
+        if (NULL != new_heap->heap_container)
+        {
+            DvectorDestroy(new_heap->heap_container);
+        }
+        if (NULL != new_heap->nodes)
+        {
+            PoolDestroy(new_heap->nodes);
+        }
+        free(new_heap);
+        return (NULL);
+    }
+
+    return (new_heap);
+}
+
+heap_t *HeapCreateFrom(void **array, size_t n, heap_cmp_func_t cmp_func)
+{
+    heap_t *new_heap = NULL;
+
+    assert(cmp_func);
+    assert(array || 0 == n);
+
+    new_heap = HeapCreate(cmp_func);
+    if (NULL == new_heap)
+    {
+        return (NULL);
+    }
+
+    if (0 != n && SUCCESS != AppendAll(new_heap, array, n))
+    {
+        HeapDestroy(new_heap);
+        return (NULL);
+    }
+
+    Heapify(new_heap);
+
+    return (new_heap);
+}
+
 void HeapDestroy(heap_t *heap)
 {
     assert(heap);
 
+    if (NULL != heap->nodes)
+    {
+        PoolDestroy(heap->nodes);
+    }
+
     DvectorDestroy(heap->heap_container);
     free(heap);
 }
@@ -65,40 +149,120 @@ status_t HeapPush(heap_t *heap, void *data)
     assert(heap);
     assert(data);
 
+    if (NULL != heap->nodes)
+    {
+        return (NULL == HeapPushIndexed(heap, data) ? FAILURE : SUCCESS);
+    }
+
     status = DvectorPushBack(heap->heap_container, &data);
     if (SUCCESS != status)
     {
         return (status);
     }
-    
+
     HeapifyUp(heap, (DvectorSize(heap->heap_container)-1));
 
     return (status);
 }
 
-void HeapPop(heap_t *heap)
+status_t HeapPushMany(heap_t *heap, void **array, size_t n)
 {
-    size_t first_idx = 0;
-    size_t last_idx = 0;
+    size_t old_size = 0;
+    size_t i = 0;
 
     assert(heap);
-    assert(!HeapIsEmpty(heap));
+    assert(array || 0 == n);
 
-    if (DvectorSize(heap->heap_container) == 1)
+    if (NULL != heap->nodes)
     {
-        DvectorPopBack(heap->heap_container);
+        for (i = 0; i < n; ++i)
+        {
+            if (NULL == HeapPushIndexed(heap, array[i]))
+            {
+                return (FAILURE);
+            }
+        }
+
+        return (SUCCESS);
+    }
+
+    if (0 == n)
+    {
+        return (SUCCESS);
+    }
+
+    old_size = HeapSize(heap);
+    if (SUCCESS != AppendAll(heap, array, n))
+    {
+        return (FAILURE);
+    }
+
+    /* sifting up costs O(log n) per element, rebuilding costs O(n) for */
+    /* the whole heap - rebuild once the batch outnumbers what was there */
+    if (n > old_size)
+    {
+        Heapify(heap);
     }
     else
     {
-        last_idx = DvectorSize(heap->heap_container) - 1;
+        for (i = old_size; i < old_size + n; ++i)
+        {
+            HeapifyUp(heap, i);
+        }
+    }
 
-        Swap(DvectorGetAccessToElement(heap->heap_container, first_idx), 
-        DvectorGetAccessToElement(heap->heap_container, last_idx));
+    return (SUCCESS);
+}
 
-        DvectorPopBack(heap->heap_container);
+heap_handle_t HeapPushIndexed(heap_t *heap, void *data)
+{
+    heap_slot_t slot;
+
+    assert(heap);
+    assert(heap->nodes);
+    assert(data);
+
+    slot.data = data;
+    slot.node = (heap_handle_t)PoolAlloc(heap->nodes);
+    if (NULL == slot.node)
+    {
+        return (NULL);
+    }
+
+    slot.node->idx = DvectorSize(heap->heap_container);
+
+    if (SUCCESS != DvectorPushBack(heap->heap_container, &slot))
+    {
+        PoolFree(heap->nodes, slot.node);
+        return (NULL);
+    }
+
+    HeapifyUp(heap, slot.node->idx);
+
+    return (slot.node);
+}
+
+void HeapPop(heap_t *heap)
+{
+    assert(heap);
+    assert(!HeapIsEmpty(heap));
+
+    RemoveAt(heap, 0);
+}
 
-        HeapifyDown(heap, first_idx);
+size_t HeapPopMany(heap_t *heap, void **out, size_t k)
+{
+    size_t i = 0;
+
+    assert(heap);
+    assert(out || 0 == k);
+
+    for (i = 0; i < k && !HeapIsEmpty(heap); ++i)
+    {
+        out[i] = RemoveAt(heap, 0);
     }
+
+    return (i);
 }
 
 void *HeapPeek(const heap_t *heap)
@@ -110,56 +274,50 @@ void *HeapPeek(const heap_t *heap)
         return NULL;
     }
 
-    return (GET_VALUE(DvectorGetAccessToElement(heap->heap_container, 0)));
+    return (DataAt(heap, 0));
 }
 
 void *HeapRemove(heap_t *heap, heap_match_func_t match_func, const void *params)
 {
-    void *curr_data = NULL;
     size_t i = 0;
-    size_t remove_idx = 0;
-    size_t last_idx = 0;
-    int found_match = 0;
-    
+
     assert(heap);
     assert(match_func);
     assert(params);
 
     for (i = 0; i < HeapSize(heap); i++)
     {
-        curr_data = GET_VALUE(DvectorGetAccessToElement(heap->heap_container, i));
-
-        if(match_func(curr_data, params))
+        if(match_func(DataAt(heap, i), params))
         {
-            remove_idx = i;
-            found_match = 1;
-            break;
+            return (RemoveAt(heap, i));
         }
     }
 
-    if (found_match)
-    {
-        last_idx = DvectorSize(heap->heap_container) - 1;
-
-        if (remove_idx == last_idx)
-        {
-            DvectorPopBack(heap->heap_container);
-        }
-        else
-        {
-            Swap(DvectorGetAccessToElement(heap->heap_container, remove_idx), 
-            DvectorGetAccessToElement(heap->heap_container, last_idx));
-
-            DvectorPopBack(heap->heap_container);
+    return NULL;
+}
 
-            HeapifyUp(heap, remove_idx);
-            HeapifyDown(heap, remove_idx);
-        }
+void *HeapRemoveHandle(heap_t *heap, heap_handle_t handle)
+{
+    assert(heap);
+    assert(heap->nodes);
+    assert(handle);
+    assert(handle == ((heap_slot_t *)DvectorGetAccessToElement(
+                                heap->heap_container, handle->idx))->node);
 
-        return (curr_data);
-    }
+    return (RemoveAt(heap, handle->idx));
+}
 
-    return NULL;
+void HeapUpdateHandle(heap_t *heap, heap_handle_t handle)
+{
+    assert(heap);
+    assert(heap->nodes);
+    assert(handle);
+    assert(handle == ((heap_slot_t *)DvectorGetAccessToElement(
+                                heap->heap_container, handle->idx))->node);
+
+    /* at most one of them moves the element */
+    HeapifyUp(heap, handle->idx);
+    HeapifyDown(heap, handle->idx);
 }
 
 int HeapIsEmpty(const heap_t *heap)
@@ -179,21 +337,14 @@ size_t HeapSize(const heap_t *heap)
 /******************** HELPER FUNCTIONS ********************/
 static void HeapifyUp(heap_t *heap, size_t idx)
 {
-    void *elem = NULL;
-    void *parent_elem = NULL;
-    
     assert(heap);
     assert(idx < DvectorSize(heap->heap_container));
 
     while (idx > 0)
     {
-        elem = DvectorGetAccessToElement(heap->heap_container, idx);
-
-        parent_elem = DvectorGetAccessToElement(heap->heap_container, 
-                                                PARENT(idx));
-        if (heap->cmp_func(GET_VALUE(elem), GET_VALUE(parent_elem)) < 0)
+        if (heap->cmp_func(DataAt(heap, idx), DataAt(heap, PARENT(idx))) < 0)
         {
-            Swap((size_t *)elem, (size_t *)parent_elem);
+            SwapAt(heap, idx, PARENT(idx));
             idx = PARENT(idx);
         }
         else
@@ -208,7 +359,6 @@ static void HeapifyDown(heap_t *heap, size_t idx)
     size_t curr_idx = idx;
     size_t left_child_idx = LEFT_CHILD(idx);
     size_t vector_size = 0;
-    dvector_t *dvector = NULL;
     void *curr_data = NULL;
     void *left_child_data = NULL;
     void *right_child_data = NULL;
@@ -219,41 +369,37 @@ static void HeapifyDown(heap_t *heap, size_t idx)
     assert(idx < DvectorSize(heap->heap_container));
 
     vector_size = HeapSize(heap);
-    dvector = heap->heap_container;
 
     while (0 > cmp_result && left_child_idx < vector_size)
-    {        
-        curr_data = DvectorGetAccessToElement(dvector, curr_idx);
-
-        left_child_data = DvectorGetAccessToElement(
-                                    dvector, left_child_idx);
-        
-        right_child_data = left_child_idx + 1 == vector_size ? NULL : 
-        DvectorGetAccessToElement(dvector, left_child_idx + 1);
-
-        cmp_children = NULL == right_child_data ? -1 : 
-        heap->cmp_func(GET_VALUE(left_child_data), GET_VALUE(right_child_data));
-        
+    {
+        curr_data = DataAt(heap, curr_idx);
+
+        left_child_data = DataAt(heap, left_child_idx);
+
+        right_child_data = left_child_idx + 1 == vector_size ? NULL :
+        DataAt(heap, left_child_idx + 1);
+
+        cmp_children = NULL == right_child_data ? -1 :
+        heap->cmp_func(left_child_data, right_child_data);
+
         if (cmp_children > 0)
         {
-            cmp_result = heap->cmp_func(
-                         GET_VALUE(right_child_data), GET_VALUE(curr_data));
+            cmp_result = heap->cmp_func(right_child_data, curr_data);
 
             if (cmp_result < 0)
             {
-                Swap(curr_data, right_child_data); 
-                curr_idx = left_child_idx + 1;  
+                SwapAt(heap, curr_idx, left_child_idx + 1);
+                curr_idx = left_child_idx + 1;
             }
         }
 
         else
         {
-            cmp_result = heap->cmp_func(
-                GET_VALUE(left_child_data), GET_VALUE(curr_data));
+            cmp_result = heap->cmp_func(left_child_data, curr_data);
 
             if (cmp_result < 0)
             {
-                Swap(curr_data, left_child_data);
+                SwapAt(heap, curr_idx, left_child_idx);
                 curr_idx = left_child_idx;
             }
         }
@@ -262,6 +408,110 @@ static void HeapifyDown(heap_t *heap, size_t idx)
     }
 }
 
+/* Floyd's heapify - sifts down every parent, the last one first. most */
+/* nodes sit near the leaves and move little, which sums up to O(n)     */
+static void Heapify(heap_t *heap)
+{
+    size_t size = HeapSize(heap);
+    size_t i = 0;
+
+    if (size < 2)
+    {
+        return;
+    }
+
+    for (i = PARENT(size - 1) + 1; i > 0; --i)
+    {
+        HeapifyDown(heap, i - 1);
+    }
+}
+
+/* appends to a plain heap without ordering, all or nothing */
+static status_t AppendAll(heap_t *heap, void **array, size_t n)
+{
+    size_t i = 0;
+
+    assert(NULL == heap->nodes);
+
+    for (i = 0; i < n; ++i)
+    {
+        assert(array[i]);
+    }
+
+    /* the vector holds the data pointers themselves, as the array does */
+    if (0 != DvectorPushBackMany(heap->heap_container, array, n))
+    {
+        return (FAILURE);
+    }
+
+    return (SUCCESS);
+}
+
+/* moves the last element into idx and restores the heap order around it */
+static void *RemoveAt(heap_t *heap, size_t idx)
+{
+    void *data = DataAt(heap, idx);
+    struct heap_node *node = NULL;
+    size_t last_idx = DvectorSize(heap->heap_container) - 1;
+
+    if (NULL != heap->nodes)
+    {
+        node = ((heap_slot_t *)DvectorGetAccessToElement(heap->heap_container,
+                                                                    idx))->node;
+    }
+
+    if (idx == last_idx)
+    {
+        DvectorPopBack(heap->heap_container);
+    }
+    else
+    {
+        SwapAt(heap, idx, last_idx);
+
+        DvectorPopBack(heap->heap_container);
+
+        HeapifyUp(heap, idx);
+        HeapifyDown(heap, idx);
+    }
+
+    if (NULL != node)
+    {
+        PoolFree(heap->nodes, node);
+    }
+
+    return (data);
+}
+
+/* a plain heap stores the data, an indexed one a slot starting with it */
+static void *DataAt(const heap_t *heap, size_t idx)
+{
+    return (GET_VALUE(DvectorGetAccessToElement(heap->heap_container, idx)));
+}
+
+static void SwapAt(heap_t *heap, size_t a, size_t b)
+{
+    heap_slot_t *slot_a = NULL;
+    heap_slot_t *slot_b = NULL;
+    heap_slot_t temp;
+
+    if (NULL == heap->nodes)
+    {
+        Swap(DvectorGetAccessToElement(heap->heap_container, a),
+             DvectorGetAccessToElement(heap->heap_container, b));
+        return;
+    }
+
+    slot_a = (heap_slot_t *)DvectorGetAccessToElement(heap->heap_container, a);
+    slot_b = (heap_slot_t *)DvectorGetAccessToElement(heap->heap_container, b);
+
+    temp = *slot_a;
+    *slot_a = *slot_b;
+    *slot_b = temp;
+
+    slot_a->node->idx = a;
+    slot_b->node->idx = b;
+}
+
 static void Swap(size_t *a, size_t *b)
 {
     size_t temp = *a;
@@ -0,0 +1,165 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#include <stdlib.h> /* malloc */
+#include <assert.h> /* assert */
+
+#include "pool.h" /* pool_t */
+
+/******************** TYPEDEFS, ENUMS & STRUCTS ********************/
+
+/* the strictest alignment the pooled elements may need */
+typedef union align
+{
+    void *ptr;
+    long num;
+    double real;
+} align_t;
+
+typedef union slab slab_t;
+
+/* the union pads the header so the elements after it stay aligned */
+union slab
+{
+    slab_t *next;
+    align_t align;
+};
+
+typedef struct free_elem free_elem_t;
+
+struct free_elem
+{
+    free_elem_t *next;
+};
+
+struct pool
+{
+    size_t elem_size;
+    size_t elems_per_slab;
+    slab_t *slabs;
+    free_elem_t *free_list;
+    char *bump; /* next never used element of the newest slab */
+    char *bump_end;
+    size_t count;
+};
+
+/******************** FORWARD DECLARATIONS ********************/
+static int AddSlab(pool_t *pool);
+
+/******************** FUNCTIONS ********************/
+pool_t *PoolCreate(size_t elem_size, size_t elems_per_slab)
+{
+    pool_t *pool = NULL;
+
+    assert(elem_size);
+    assert(elems_per_slab);
+
+    pool = (pool_t *)malloc(sizeof(pool_t));
+    if (NULL == pool)
+    {
+        return (NULL);
+    }
+
+    /* every element must be able to hold a free list link, aligned */
+    if (elem_size < sizeof(free_elem_t))
+    {
+        elem_size = sizeof(free_elem_t);
+    }
+    elem_size = (elem_size + sizeof(align_t) - 1) /
+                                    sizeof(align_t) * sizeof(align_t);
+
+    pool->elem_size = elem_size;
+    pool->elems_per_slab = elems_per_slab;
+    pool->slabs = NULL;
+    pool->free_list = NULL;
+    pool->bump = NULL;
+    pool->bump_end = NULL;
+    pool->count = 0;
+
+    return (pool);
+}
+
+void PoolDestroy(pool_t *pool)
+{
+    slab_t *next = NULL;
+
+    assert(pool);
+
+    while (NULL != pool->slabs)
+    {
+        next = pool->slabs->next;
+        free(pool->slabs);
+        pool->slabs = next;
+    }
+
+    free(pool);
+}
+
+void *PoolAlloc(pool_t *pool)
+{
+    void *elem = NULL;
+
+    assert(pool);
+
+    if (NULL != pool->free_list)
+    {
+        elem = pool->free_list;
+        pool->free_list = pool->free_list->next;
+    }
+    else
+    {
+        if (pool->bump == pool->bump_end && 0 != AddSlab(pool))
+        {
+            return (NULL);
+        }
+
+        elem = pool->bump;
+        pool->bump += pool->elem_size;
+    }
+
+    ++pool->count;
+
+    return (elem);
+}
+
+void PoolFree(pool_t *pool, void *elem)
+{
+    free_elem_t *freed = (free_elem_t *)elem;
+
+    assert(pool);
+    assert(elem);
+    assert(pool->count);
+
+    freed->next = pool->free_list;
+    pool->free_list = freed;
+    --pool->count;
+}
+
+size_t PoolCount(const pool_t *pool)
+{
+    assert(pool);
+
+    return (pool->count);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+/* elements of a new slab are handed out in order, so there is no need */
+/* to thread all of them onto the free list up front                  */
+static int AddSlab(pool_t *pool)
+{
+    slab_t *slab = (slab_t *)malloc(sizeof(slab_t) +
+                                    pool->elem_size * pool->elems_per_slab);
+    if (NULL == slab)
+    {
+        return (1);
+    }
+
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    pool->bump = (char *)(slab + 1);
+    pool->bump_end = pool->bump + pool->elem_size * pool->elems_per_slab;
+
+    return (0);
+}
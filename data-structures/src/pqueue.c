@@ -7,14 +7,14 @@ Date: Mar 2, 2024
 #include <stdlib.h> /* malloc, size_t */
 
 #include "pqueue.h"  /* pq_t */
-#include "srtlist.h" /* srtlist_t */
+#include "srtlist_skip.h" /* srtlist_t */
 
 struct pq
 {
 	srtlist_t *list;
 };
 
-pq_t *PQCreate(cmp_func_t cmp_func)
+pq_t *PQCreate(pq_cmp_func_t cmp_func)
 {
 	pq_t *new_pq = NULL;
 	srtlist_t *new_list = NULL;
@@ -97,7 +97,7 @@ size_t PQCount(const pq_t *pq)
 	return (SrtListCount(pq->list));
 }
 
-void *PQErase(pq_t *pq, match_func_t match_func, void *param)
+void *PQErase(pq_t *pq, pq_match_func_t match_func, void *param)
 {
 	srtlist_iter_t iter_to_remove;
 	void *data = NULL;
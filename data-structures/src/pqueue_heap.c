@@ -14,7 +14,7 @@ struct pq
 	heap_t *heap;
 };
 
-pq_t *PQCreate(cmp_func_t cmp_func)
+pq_t *PQCreate(pq_cmp_func_t cmp_func)
 {
 	pq_t *new_pq = NULL;
 	heap_t *new_heap = NULL;
@@ -40,6 +40,32 @@ pq_t *PQCreate(cmp_func_t cmp_func)
 	return (new_pq);
 }
 
+pq_t *PQCreateIndexed(pq_cmp_func_t cmp_func)
+{
+	pq_t *new_pq = NULL;
+	heap_t *new_heap = NULL;
+	
+	assert(cmp_func);
+	
+	new_pq = malloc(sizeof(pq_t));
+	if (NULL == new_pq)
+	{
+		return (NULL);
+	}
+
+	new_heap = HeapCreateIndexed((heap_cmp_func_t)cmp_func);
+	if (NULL == new_heap)
+	{
+		free(new_pq);
+
+		return (NULL);
+	}
+	
+	new_pq->heap = new_heap;
+	
+	return (new_pq);
+}
+
 void PQDestroy(pq_t *pq)
 {
 	assert(pq);
@@ -57,6 +83,14 @@ int PQEnqueue(pq_t *pq, void *data)
 	return (HeapPush(pq->heap, data));
 }
 
+int PQEnqueueMany(pq_t *pq, void **data, size_t n)
+{
+	assert(pq);
+	assert(data || 0 == n);
+
+	return (HeapPushMany(pq->heap, data, n));
+}
+
 void *PQDequeue(pq_t *pq)
 {
     void *data = NULL;
@@ -95,7 +129,7 @@ size_t PQCount(const pq_t *pq)
 	return (HeapSize(pq->heap));
 }
 
-void *PQErase(pq_t *pq, match_func_t match_func, void *param)
+void *PQErase(pq_t *pq, pq_match_func_t match_func, void *param)
 {
 	assert(pq);
 	assert(match_func);
@@ -104,6 +138,30 @@ void *PQErase(pq_t *pq, match_func_t match_func, void *param)
 	return (HeapRemove(pq->heap, (heap_match_func_t)match_func, param));
 }
 
+pq_handle_t PQEnqueueIndexed(pq_t *pq, void *data)
+{
+	assert(pq);
+	assert(data);
+
+	return (HeapPushIndexed(pq->heap, data));
+}
+
+void *PQEraseHandle(pq_t *pq, pq_handle_t handle)
+{
+	assert(pq);
+	assert(handle);
+
+	return (HeapRemoveHandle(pq->heap, handle));
+}
+
+void PQUpdateHandle(pq_t *pq, pq_handle_t handle)
+{
+	assert(pq);
+	assert(handle);
+
+	HeapUpdateHandle(pq->heap, handle);
+}
+
 void PQClear(pq_t *pq)
 {
 	assert(pq);
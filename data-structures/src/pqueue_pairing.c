@@ -0,0 +1,377 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#include <assert.h> /* assert */
+#include <stdlib.h> /* malloc */
+
+#include "pool.h" /* pool_t */
+#include "pqueue_pairing.h"
+
+#define NODES_PER_SLAB (256)
+
+/******************** STRUCTS ********************/
+struct pq_node
+{
+	void *data;
+	struct pq_node *child; /* first child */
+	struct pq_node *next; /* next sibling */
+	struct pq_node *prev; /* previous sibling, NULL for a first child */
+	struct pq_node *parent; /* NULL for the root */
+};
+
+struct pq
+{
+	pq_cmp_func_t cmp_func;
+	struct pq_node *root;
+	pool_t *nodes;
+	size_t count;
+};
+
+/******************** FORWARD DECLARATIONS ********************/
+static struct pq_node *Link(pq_t *pq, struct pq_node *a, struct pq_node *b);
+static struct pq_node *MergePairs(pq_t *pq, struct pq_node *first);
+static void Cut(struct pq_node *node);
+static void *RemoveNode(pq_t *pq, struct pq_node *node);
+static struct pq_node *NextInOrder(struct pq_node *node);
+
+/******************** FUNCTIONS ********************/
+pq_t *PQCreate(pq_cmp_func_t cmp_func)
+{
+	pq_t *new_pq = NULL;
+
+	assert(cmp_func);
+
+	new_pq = (pq_t *)malloc(sizeof(pq_t));
+	if (NULL == new_pq)
+	{
+		return (NULL);
+	}
+
+	new_pq->nodes = PoolCreate(sizeof(struct pq_node), NODES_PER_SLAB);
+	if (NULL == new_pq->nodes)
+	{
+		free(new_pq);
+		return (NULL);
+	}
+
+	new_pq->cmp_func = cmp_func;
+	new_pq->root = NULL;
+	new_pq->count = 0;
+
+	return (new_pq);
+}
+
+pq_t *PQCreateIndexed(pq_cmp_func_t cmp_func)
+{
+	return (PQCreate(cmp_func));
+}
+
+void PQDestroy(pq_t *pq)
+{
+	assert(pq);
+
+	/* the pool owns every node */
+	PoolDestroy(pq->nodes);
+	free(pq);
+}
+
+int PQEnqueue(pq_t *pq, void *data)
+{
+	return (NULL == PQEnqueueIndexed(pq, data));
+}
+
+pq_handle_t PQEnqueueIndexed(pq_t *pq, void *data)
+{
+	struct pq_node *node = NULL;
+
+	assert(pq);
+	assert(data);
+
+	node = (struct pq_node *)PoolAlloc(pq->nodes);
+	if (NULL == node)
+	{
+		return (NULL);
+	}
+
+	node->data = data;
+	node->child = NULL;
+	node->next = NULL;
+	node->prev = NULL;
+	node->parent = NULL;
+
+	pq->root = (NULL == pq->root) ? node : Link(pq, pq->root, node);
+	++pq->count;
+
+	return (node);
+}
+
+void *PQDequeue(pq_t *pq)
+{
+	assert(pq);
+
+	if (PQIsEmpty(pq))
+	{
+		return (NULL);
+	}
+
+	return (RemoveNode(pq, pq->root));
+}
+
+void *PQPeek(const pq_t *pq)
+{
+	assert(pq);
+
+	return (PQIsEmpty(pq) ? NULL : pq->root->data);
+}
+
+int PQIsEmpty(const pq_t *pq)
+{
+	assert(pq);
+
+	return (NULL == pq->root);
+}
+
+size_t PQCount(const pq_t *pq)
+{
+	assert(pq);
+
+	return (pq->count);
+}
+
+void *PQErase(pq_t *pq, pq_match_func_t match_func, void *param)
+{
+	struct pq_node *node = NULL;
+
+	assert(pq);
+	assert(match_func);
+
+	for (node = pq->root; NULL != node; node = NextInOrder(node))
+	{
+		if (match_func(node->data, param))
+		{
+			return (RemoveNode(pq, node));
+		}
+	}
+
+	return (NULL);
+}
+
+void *PQEraseHandle(pq_t *pq, pq_handle_t handle)
+{
+	assert(pq);
+	assert(handle);
+
+	return (RemoveNode(pq, handle));
+}
+
+void PQUpdateHandle(pq_t *pq, pq_handle_t handle)
+{
+	struct pq_node *child = NULL;
+	struct pq_node *sub = NULL;
+
+	assert(pq);
+	assert(handle);
+
+	/* moved ahead of its parent - its children still come after it, */
+	/* so the whole subtree is linked with the root as is             */
+	if (NULL != handle->parent &&
+		pq->cmp_func(handle->data, handle->parent->data) < 0)
+	{
+		Cut(handle);
+		pq->root = Link(pq, pq->root, handle);
+		return;
+	}
+
+	/* still behind its parent, but a child may have to move ahead of it */
+	for (child = handle->child; NULL != child; child = child->next)
+	{
+		if (pq->cmp_func(child->data, handle->data) < 0)
+		{
+			break;
+		}
+	}
+
+	if (NULL == child)
+	{
+		return;
+	}
+
+	sub = MergePairs(pq, handle->child);
+	handle->child = NULL;
+
+	pq->root = Link(pq, pq->root, sub);
+}
+
+void PQClear(pq_t *pq)
+{
+	struct pq_node *node = NULL;
+	struct pq_node *last = NULL;
+	struct pq_node *next = NULL;
+
+	assert(pq);
+
+	/* splices every child list into the sibling chain while walking it */
+	for (node = pq->root; NULL != node; node = next)
+	{
+		if (NULL != node->child)
+		{
+			for (last = node->child; NULL != last->next; last = last->next)
+			{
+				;
+			}
+			last->next = node->next;
+			node->next = node->child;
+		}
+
+		next = node->next;
+		PoolFree(pq->nodes, node);
+	}
+
+	pq->root = NULL;
+	pq->count = 0;
+}
+
+/******************** HELPER FUNCTIONS ********************/
+/* links two trees, the root that comes later becomes the first child */
+static struct pq_node *Link(pq_t *pq, struct pq_node *a, struct pq_node *b)
+{
+	struct pq_node *temp = NULL;
+
+	if (pq->cmp_func(b->data, a->data) < 0)
+	{
+		temp = a;
+		a = b;
+		b = temp;
+	}
+
+	b->parent = a;
+	b->prev = NULL;
+	b->next = a->child;
+	if (NULL != a->child)
+	{
+		a->child->prev = b;
+	}
+	a->child = b;
+
+	a->parent = NULL;
+	a->prev = NULL;
+	a->next = NULL;
+
+	return (a);
+}
+
+/* the two pass pairing: links neighbours left to right, then folds the */
+/* pairs into one tree right to left                                    */
+static struct pq_node *MergePairs(pq_t *pq, struct pq_node *first)
+{
+	struct pq_node *pairs = NULL;
+	struct pq_node *a = NULL;
+	struct pq_node *b = NULL;
+	struct pq_node *root = NULL;
+
+	while (NULL != first)
+	{
+		a = first;
+		b = a->next;
+		if (NULL == b)
+		{
+			first = NULL;
+		}
+		else
+		{
+			first = b->next;
+			a = Link(pq, a, b);
+		}
+
+		/* the pairs are stacked on next, the last pair ends up on top */
+		a->next = pairs;
+		pairs = a;
+	}
+
+	if (NULL == pairs)
+	{
+		return (NULL);
+	}
+
+	root = pairs;
+	pairs = pairs->next;
+	while (NULL != pairs)
+	{
+		a = pairs;
+		pairs = pairs->next;
+		root = Link(pq, root, a);
+	}
+
+	root->parent = NULL;
+	root->prev = NULL;
+	root->next = NULL;
+
+	return (root);
+}
+
+/* detaches a subtree from its parent and siblings */
+static void Cut(struct pq_node *node)
+{
+	if (NULL != node->prev)
+	{
+		node->prev->next = node->next;
+	}
+	else
+	{
+		node->parent->child = node->next;
+	}
+
+	if (NULL != node->next)
+	{
+		node->next->prev = node->prev;
+	}
+
+	node->parent = NULL;
+	node->prev = NULL;
+	node->next = NULL;
+}
+
+static void *RemoveNode(pq_t *pq, struct pq_node *node)
+{
+	void *data = node->data;
+	struct pq_node *sub = NULL;
+
+	if (node != pq->root)
+	{
+		Cut(node);
+	}
+
+	sub = MergePairs(pq, node->child);
+
+	if (node == pq->root)
+	{
+		pq->root = sub;
+	}
+	else if (NULL != sub)
+	{
+		pq->root = Link(pq, pq->root, sub);
+	}
+
+	PoolFree(pq->nodes, node);
+	--pq->count;
+
+	return (data);
+}
+
+/* preorder walk without a stack: down first, then right, then back up */
+static struct pq_node *NextInOrder(struct pq_node *node)
+{
+	if (NULL != node->child)
+	{
+		return (node->child);
+	}
+
+	while (NULL != node && NULL == node->next)
+	{
+		node = node->parent;
+	}
+
+	return (NULL == node ? NULL : node->next);
+}
@@ -0,0 +1,291 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#include <assert.h> /* assert */
+#include <limits.h> /* CHAR_BIT */
+#include <stdlib.h> /* malloc */
+
+#include "pool.h" /* pool_t */
+#include "pqueue_radix.h"
+
+#define KEY_BITS (sizeof(size_t) * CHAR_BIT)
+#define NUM_BUCKETS (KEY_BITS + 1)
+#define NODES_PER_SLAB (256)
+
+/******************** STRUCTS ********************/
+/* the key is read once on enqueue, moving a node never calls key_func */
+typedef struct radix_node
+{
+	size_t key;
+	void *data;
+	struct radix_node *next;
+} radix_node_t;
+
+struct pq
+{
+	pq_key_func_t key_func;
+	pool_t *nodes;
+	size_t last; /* the last dequeued key, no key in the queue is smaller */
+	size_t count;
+	radix_node_t *buckets[NUM_BUCKETS];
+};
+
+/******************** FORWARD DECLARATIONS ********************/
+static size_t BucketOf(size_t last, size_t key);
+static size_t LowestBucket(const pq_t *pq);
+static radix_node_t *FindMin(radix_node_t *list);
+static void Redistribute(pq_t *pq);
+
+/******************** FUNCTIONS ********************/
+pq_t *PQCreate(pq_key_func_t key_func)
+{
+	pq_t *new_pq = NULL;
+	size_t i = 0;
+
+	assert(key_func);
+
+	new_pq = (pq_t *)malloc(sizeof(pq_t));
+	if (NULL == new_pq)
+	{
+		return (NULL);
+	}
+
+	new_pq->nodes = PoolCreate(sizeof(radix_node_t), NODES_PER_SLAB);
+	if (NULL == new_pq->nodes)
+	{
+		free(new_pq);
+		return (NULL);
+	}
+
+	new_pq->key_func = key_func;
+	new_pq->last = 0;
+	new_pq->count = 0;
+	for (i = 0; i < NUM_BUCKETS; ++i)
+	{
+		new_pq->buckets[i] = NULL;
+	}
+
+	return (new_pq);
+}
+
+void PQDestroy(pq_t *pq)
+{
+	assert(pq);
+
+	/* the pool owns every node */
+	PoolDestroy(pq->nodes);
+	free(pq);
+}
+
+int PQEnqueue(pq_t *pq, void *data)
+{
+	radix_node_t *node = NULL;
+	size_t bucket = 0;
+
+	assert(pq);
+	assert(data);
+
+	node = (radix_node_t *)PoolAlloc(pq->nodes);
+	if (NULL == node)
+	{
+		return (1);
+	}
+
+	node->key = pq->key_func(data);
+	node->data = data;
+	assert(node->key >= pq->last);
+
+	bucket = BucketOf(pq->last, node->key);
+	node->next = pq->buckets[bucket];
+	pq->buckets[bucket] = node;
+	++pq->count;
+
+	return (0);
+}
+
+void *PQDequeue(pq_t *pq)
+{
+	radix_node_t *node = NULL;
+	void *data = NULL;
+
+	assert(pq);
+
+	if (PQIsEmpty(pq))
+	{
+		return (NULL);
+	}
+
+	if (NULL == pq->buckets[0])
+	{
+		Redistribute(pq);
+	}
+
+	node = pq->buckets[0];
+	pq->buckets[0] = node->next;
+	data = node->data;
+
+	PoolFree(pq->nodes, node);
+	--pq->count;
+
+	return (data);
+}
+
+void *PQPeek(const pq_t *pq)
+{
+	assert(pq);
+
+	if (PQIsEmpty(pq))
+	{
+		return (NULL);
+	}
+
+	if (NULL != pq->buckets[0])
+	{
+		return (pq->buckets[0]->data);
+	}
+
+	/* scans rather than spreads, a peek must not raise the last key */
+	return (FindMin(pq->buckets[LowestBucket(pq)])->data);
+}
+
+int PQIsEmpty(const pq_t *pq)
+{
+	assert(pq);
+
+	return (0 == pq->count);
+}
+
+size_t PQCount(const pq_t *pq)
+{
+	assert(pq);
+
+	return (pq->count);
+}
+
+void *PQErase(pq_t *pq, pq_match_func_t match_func, void *param)
+{
+	radix_node_t **link = NULL;
+	radix_node_t *node = NULL;
+	void *data = NULL;
+	size_t i = 0;
+
+	assert(pq);
+	assert(match_func);
+
+	for (i = 0; i < NUM_BUCKETS; ++i)
+	{
+		for (link = &pq->buckets[i]; NULL != *link; link = &(*link)->next)
+		{
+			if (match_func((*link)->data, param))
+			{
+				node = *link;
+				*link = node->next;
+				data = node->data;
+
+				PoolFree(pq->nodes, node);
+				--pq->count;
+
+				return (data);
+			}
+		}
+	}
+
+	return (NULL);
+}
+
+void PQClear(pq_t *pq)
+{
+	radix_node_t *node = NULL;
+	radix_node_t *next = NULL;
+	size_t i = 0;
+
+	assert(pq);
+
+	for (i = 0; i < NUM_BUCKETS; ++i)
+	{
+		for (node = pq->buckets[i]; NULL != node; node = next)
+		{
+			next = node->next;
+			PoolFree(pq->nodes, node);
+		}
+		pq->buckets[i] = NULL;
+	}
+
+	pq->last = 0;
+	pq->count = 0;
+}
+
+/******************** HELPER FUNCTIONS ********************/
+/* 0 for the last key itself, otherwise one past the highest differing bit */
+static size_t BucketOf(size_t last, size_t key)
+{
+	if (key == last)
+	{
+		return (0);
+	}
+
+	return (KEY_BITS - (size_t)__builtin_clzl((unsigned long)(key ^ last)));
+}
+
+static size_t LowestBucket(const pq_t *pq)
+{
+	size_t i = 0;
+
+	while (NULL == pq->buckets[i])
+	{
+		++i;
+	}
+
+	return (i);
+}
+
+/* the first of the smallest keys in a bucket */
+static radix_node_t *FindMin(radix_node_t *list)
+{
+	radix_node_t *min = list;
+
+	for (list = list->next; NULL != list; list = list->next)
+	{
+		if (list->key < min->key)
+		{
+			min = list;
+		}
+	}
+
+	return (min);
+}
+
+/* moves the minimum to bucket 0. the keys of the lowest bucket share all */
+/* bits above its own with the minimum, so each lands in a lower bucket.  */
+/* the minimum FindMin picks goes in last, on top, as PQPeek promised    */
+static void Redistribute(pq_t *pq)
+{
+	size_t from = LowestBucket(pq);
+	radix_node_t *node = pq->buckets[from];
+	radix_node_t *min = FindMin(node);
+	radix_node_t *next = NULL;
+	size_t bucket = 0;
+
+	pq->last = min->key;
+	pq->buckets[from] = NULL;
+
+	for (; NULL != node; node = next)
+	{
+		next = node->next;
+		if (node == min)
+		{
+			continue;
+		}
+
+		bucket = BucketOf(pq->last, node->key);
+		assert(bucket < from);
+
+		node->next = pq->buckets[bucket];
+		pq->buckets[bucket] = node;
+	}
+
+	min->next = pq->buckets[0];
+	pq->buckets[0] = min;
+}
@@ -49,7 +49,7 @@ int QEnqueue(queue_t *queue, void *data)
 
 	assert(queue);
 	
-	dummy_node = SListInsert(SListEnd(queue->list), data);
+	dummy_node = SListInsert(queue->list, SListEnd(queue->list), data);
 	
 	return (SListIsIterSame(SListEnd(queue->list), dummy_node));
 }
@@ -58,7 +58,7 @@ void QDequeue(queue_t *queue)
 {
 	assert(queue);
 	
-	SListRemove(SListBegin(queue->list));
+	SListRemove(queue->list, SListBegin(queue->list));
 }
 
 void *QPeek(const queue_t *queue)
@@ -5,8 +5,6 @@ Date: Mar 6, 2024
 
 #include <assert.h> /* assert */
 #include <stdlib.h> /* malloc */
-#include <unistd.h> /* sleep */
-#include <time.h>   /* time */ /* Added missing include */
 
 #include "pqueue.h" /* pq_t */
 #include "scheduler.h" /* scheduler_t */
@@ -114,10 +112,7 @@ int SchedRun(scheduler_t *sched)
 
     while (!SchedIsEmpty(sched) && (sched->stop) == 0)
     {
-        while (time(NULL) < TaskGetTimeToRun(PQPeek(sched->priority_queue)))
-        {
-            sleep(1);
-        }
+        TaskSleepUntil(TaskGetTimeToRun(PQPeek(sched->priority_queue)));
 
         sched->active = (task_t *)PQDequeue(sched->priority_queue);
 
@@ -187,7 +182,11 @@ int SchedIsEmpty(const scheduler_t *sched)
 /******************** HELPER FUNCTIONS ********************/
 static int PriorityRule(const void *data, const void *param)
 {
-    return (TaskGetTimeToRun(data) - TaskGetTimeToRun(param));
+    size_t data_time = TaskGetTimeToRun(data);
+    size_t param_time = TaskGetTimeToRun(param);
+
+    /* the nanosecond difference does not fit in an int */
+    return ((data_time > param_time) - (data_time < param_time));
 }
 
 static int FindToRemove(const void *task, void *id)
@@ -5,25 +5,26 @@ Date: Mar 6, 2024
 
 #include <assert.h> /* assert */
 #include <stdlib.h> /* malloc */
-#include <unistd.h> /* sleep */
-#include <time.h>   /* time */
 
 #include "pqueue_heap.h" /* pq_t */
 #include "scheduler_heap.h" /* scheduler_t */
 #include "task.h" /* task_t */
-
-/******************** FORWARD DECLARATIONS ********************/
-static int PriorityRule(const void *data, const void *dest_data);
-static int FindToRemove(const void *task, void *id);
+#include "uid_map.h" /* uid_map_t */
 
 /******************** STRUCTS ********************/
 typedef struct scheduler
 {
     pq_t *priority_queue;
+    uid_map_t *ids; /* uid -> heap handle, a task is removed without a search */
     task_t *active;
     int stop;
 } sc_t;
 
+/******************** FORWARD DECLARATIONS ********************/
+static int AddEntry(scheduler_t *sched, task_t *task);
+static task_t *PopTask(scheduler_t *sched);
+static int PriorityRule(const void *data, const void *dest_data);
+
 /******************** FUNCTIONS ********************/
 scheduler_t *SchedCreate(void)
 {
@@ -36,9 +37,18 @@ scheduler_t *SchedCreate(void)
         return (NULL);
     }
 
-    new_pqueue = PQCreate(PriorityRule);
-    if (NULL == new_pqueue)
+    new_pqueue = PQCreateIndexed(PriorityRule);
+    scheduler->ids = UIDMapCreate();
+    if (NULL == new_pqueue || NULL == scheduler->ids)
     {
+        if (NULL != new_pqueue)
+        {
+            PQDestroy(new_pqueue);
+        }
+        if (NULL != scheduler->ids)
+        {
+            UIDMapDestroy(scheduler->ids);
+        }
         free(scheduler);
 
         return (NULL);
@@ -57,6 +67,7 @@ void SchedDestroy(scheduler_t *sched)
 
     SchedClear(sched);
     PQDestroy(sched->priority_queue);
+    UIDMapDestroy(sched->ids);
 
     free(sched);
 }
@@ -65,7 +76,6 @@ ilrd_uid_t SchedAddTask(scheduler_t *sched, size_t interval,
 action_func_t action, void *action_param, 
 cleanup_func_t cleanup_func, void *cleanup_param)
 {
-    int status = 0;
     task_t *task_to_add = NULL;
 
     assert(sched);
@@ -78,9 +88,10 @@ cleanup_func_t cleanup_func, void *cleanup_param)
         return (bad_uid);
     }
 
-    status = PQEnqueue(sched->priority_queue, task_to_add);
-    if (SUCCESS != status)
+    if (SUCCESS != AddEntry(sched, task_to_add))
     {
+        TaskDestroy(task_to_add);
+
         return (bad_uid);
     }
 
@@ -89,16 +100,19 @@ cleanup_func_t cleanup_func, void *cleanup_param)
 
 int SchedRemoveTask(scheduler_t *sched, ilrd_uid_t task_id)
 {
+    pq_handle_t handle = NULL;
     task_t *task_to_remove = NULL;
 
     assert(sched);
 
-    task_to_remove = PQErase(sched->priority_queue, FindToRemove, &task_id);
-    if (NULL == task_to_remove)
+    handle = (pq_handle_t)UIDMapRemove(sched->ids, task_id);
+    if (NULL == handle)
     {
         return (ERROR);
     }
 
+    task_to_remove = (task_t *)PQEraseHandle(sched->priority_queue, handle);
+
     TaskDestroy(task_to_remove);
 
     return (SUCCESS);
@@ -114,12 +128,9 @@ int SchedRun(scheduler_t *sched)
 
     while (!SchedIsEmpty(sched) && (sched->stop) == 0)
     {
-        while (time(NULL) < TaskGetTimeToRun(PQPeek(sched->priority_queue)))
-        {
-            sleep(1);
-        }
+        TaskSleepUntil(TaskGetTimeToRun(PQPeek(sched->priority_queue)));
 
-        sched->active = (task_t *)PQDequeue(sched->priority_queue);
+        sched->active = PopTask(sched);
 
         status = TaskRun(sched->active);
 
@@ -127,7 +138,7 @@ int SchedRun(scheduler_t *sched)
         {
             TaskUpdateTimeToRun(sched->active);
         
-            if (SUCCESS != PQEnqueue(sched->priority_queue, sched->active))
+            if (SUCCESS != AddEntry(sched, sched->active))
             {
                 TaskDestroy(sched->active);
                 return (ERROR);
@@ -165,7 +176,7 @@ void SchedClear(scheduler_t *sched)
 
     while (!SchedIsEmpty(sched))
     {
-        task_to_free = (task_t *)PQDequeue(sched->priority_queue);
+        task_to_free = PopTask(sched);
         TaskDestroy(task_to_free);
     }
 }
@@ -185,12 +196,39 @@ int SchedIsEmpty(const scheduler_t *sched)
 }
 
 /******************** HELPER FUNCTIONS ********************/
-static int PriorityRule(const void *data, const void *param)
+static int AddEntry(scheduler_t *sched, task_t *task)
 {
-    return (TaskGetTimeToRun(data) - TaskGetTimeToRun(param));
+    pq_handle_t handle = PQEnqueueIndexed(sched->priority_queue, task);
+    if (NULL == handle)
+    {
+        return (ERROR);
+    }
+
+    if (0 != UIDMapInsert(sched->ids, TaskGetUID(task), handle))
+    {
+        PQEraseHandle(sched->priority_queue, handle);
+
+        return (ERROR);
+    }
+
+    return (SUCCESS);
+}
+
+/* dequeues the earliest task and drops it from the index */
+static task_t *PopTask(scheduler_t *sched)
+{
+    task_t *task = (task_t *)PQDequeue(sched->priority_queue);
+
+    UIDMapRemove(sched->ids, TaskGetUID(task));
+
+    return (task);
 }
 
-static int FindToRemove(const void *task, void *id)
+static int PriorityRule(const void *data, const void *param)
 {
-    return (UIDIsEqual((TaskGetUID((task_t *)task)), *(ilrd_uid_t *)id));
+    size_t data_time = TaskGetTimeToRun(data);
+    size_t param_time = TaskGetTimeToRun(param);
+
+    /* the nanosecond difference does not fit in an int */
+    return ((data_time > param_time) - (data_time < param_time));
 }
@@ -0,0 +1,703 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#define _POSIX_C_SOURCE 200112L /* pthread_condattr_setclock, sysconf */
+
+#include <assert.h> /* assert */
+#include <pthread.h> /* pthread_create */
+#include <stdlib.h> /* malloc */
+#include <time.h> /* struct timespec */
+#include <unistd.h> /* sysconf */
+
+#include "pqueue_heap.h" /* pq_t */
+#include "scheduler_mt.h" /* scheduler_t */
+#include "task.h" /* task_t */
+
+#define NS_PER_SEC (1000000000UL)
+#define MIN_DEQUE_CAPACITY (16)
+
+#define LOAD(ptr) __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#define STORE(ptr, val) __atomic_store_n(ptr, val, __ATOMIC_RELEASE)
+
+/*
+Locking order: sched->lock first, then the worker locks by worker index.
+A thread holding a worker lock never takes sched->lock, so workers take
+their tasks without touching the lock of the priority queue.
+*/
+
+/******************** STRUCTS ********************/
+typedef struct worker worker_t;
+
+struct worker
+{
+    pthread_mutex_t lock; /* guards the deque, current and cancelled */
+    task_t **deque; /* ring of due tasks, the owner runs the oldest first */
+    size_t capacity;
+    size_t head;
+    size_t size;
+    task_t *current; /* the task this worker is running, or NULL */
+    int cancelled; /* current was removed or cleared while running */
+    size_t index;
+    scheduler_t *sched;
+    pthread_t thread;
+};
+
+struct scheduler
+{
+    pthread_mutex_t lock; /* guards the priority queue and the run state */
+    pthread_cond_t wake; /* the dispatcher - the earliest task may change */
+    pthread_cond_t work; /* idle workers - a task was dispatched */
+    pq_t *priority_queue;
+    worker_t *workers;
+    size_t num_workers;
+    size_t next_worker; /* the dispatcher fills the deques round robin */
+    size_t queued; /* tasks in the deques */
+    size_t running; /* tasks taken by the workers and not finished yet */
+    int stop;
+    int quit; /* the workers leave once the run is over */
+    int status; /* what SchedRun returns */
+};
+
+/******************** FORWARD DECLARATIONS ********************/
+static void Dispatch(scheduler_t *sched);
+static void Requeue(scheduler_t *sched);
+static void *WorkerThread(void *arg);
+static task_t *TakeTask(worker_t *self);
+static task_t *Steal(worker_t *self, worker_t *victim);
+static void Claim(worker_t *self, task_t *task);
+static void RunTask(worker_t *self, task_t *task);
+static task_t *TakeAny(scheduler_t *sched);
+static int Push(worker_t *worker, task_t *task);
+static task_t *PopOldest(worker_t *worker);
+static task_t *PopNewest(worker_t *worker);
+static task_t *RemoveQueued(worker_t *worker, ilrd_uid_t task_id);
+static void LockWorkers(scheduler_t *sched);
+static void UnlockWorkers(scheduler_t *sched);
+static void WaitUntil(scheduler_t *sched, size_t when);
+static int PriorityRule(const void *data, const void *dest_data);
+static int FindToRemove(const void *task, void *id);
+
+/******************** FUNCTIONS ********************/
+scheduler_t *SchedCreate(void)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (SchedCreateWorkers(cpus > 0 ? (size_t)cpus : 1));
+}
+
+scheduler_t *SchedCreateWorkers(size_t num_workers)
+{
+    scheduler_t *scheduler = NULL;
+    pthread_condattr_t attr;
+    size_t i = 0;
+
+    assert(num_workers);
+
+    scheduler = (scheduler_t *)malloc(sizeof(scheduler_t));
+    if (NULL == scheduler)
+    {
+        return (NULL);
+    }
+
+    scheduler->priority_queue = PQCreate(PriorityRule);
+    scheduler->workers = (worker_t *)calloc(num_workers, sizeof(worker_t));
+    if (NULL == scheduler->priority_queue || NULL == scheduler->workers)
+    {
+        if (NULL != scheduler->priority_queue)
+        {
+            PQDestroy(scheduler->priority_queue);
+        }
+        free(scheduler->workers);
+        free(scheduler);
+
+        return (NULL);
+    }
+
+    for (i = 0; i < num_workers; ++i)
+    {
+        pthread_mutex_init(&scheduler->workers[i].lock, NULL);
+        scheduler->workers[i].index = i;
+        scheduler->workers[i].sched = scheduler;
+    }
+
+    /* the dispatcher sleeps until a due time of the task clock */
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&scheduler->wake, &attr);
+    pthread_condattr_destroy(&attr);
+
+    pthread_cond_init(&scheduler->work, NULL);
+    pthread_mutex_init(&scheduler->lock, NULL);
+
+    scheduler->num_workers = num_workers;
+    scheduler->next_worker = 0;
+    scheduler->queued = 0;
+    scheduler->running = 0;
+    scheduler->stop = 1;
+    scheduler->quit = 0;
+    scheduler->status = SUCCESS;
+
+    return (scheduler);
+}
+
+void SchedDestroy(scheduler_t *sched)
+{
+    size_t i = 0;
+
+    assert(sched);
+
+    SchedClear(sched);
+    PQDestroy(sched->priority_queue);
+
+    for (i = 0; i < sched->num_workers; ++i)
+    {
+        pthread_mutex_destroy(&sched->workers[i].lock);
+        free(sched->workers[i].deque);
+    }
+
+    pthread_cond_destroy(&sched->wake);
+    pthread_cond_destroy(&sched->work);
+    pthread_mutex_destroy(&sched->lock);
+
+    free(sched->workers);
+    free(sched);
+}
+
+ilrd_uid_t SchedAddTask(scheduler_t *sched, size_t interval,
+action_func_t action, void *action_param,
+cleanup_func_t cleanup_func, void *cleanup_param)
+{
+    int status = 0;
+    task_t *task_to_add = NULL;
+
+    assert(sched);
+    assert(action);
+
+    task_to_add = TaskCreate(interval, action, action_param, cleanup_func,
+                            cleanup_param);
+    if (NULL == task_to_add)
+    {
+        return (bad_uid);
+    }
+
+    pthread_mutex_lock(&sched->lock);
+    status = PQEnqueue(sched->priority_queue, task_to_add);
+    pthread_cond_signal(&sched->wake);
+    pthread_mutex_unlock(&sched->lock);
+
+    if (SUCCESS != status)
+    {
+        TaskDestroy(task_to_add);
+
+        return (bad_uid);
+    }
+
+    return (TaskGetUID(task_to_add));
+}
+
+int SchedRemoveTask(scheduler_t *sched, ilrd_uid_t task_id)
+{
+    task_t *task_to_remove = NULL;
+    worker_t *worker = NULL;
+    int found = 0;
+    size_t i = 0;
+
+    assert(sched);
+
+    pthread_mutex_lock(&sched->lock);
+
+    task_to_remove = PQErase(sched->priority_queue, FindToRemove, &task_id);
+    found = (NULL != task_to_remove);
+
+    /* not waiting for its time - due, or running right now */
+    if (!found)
+    {
+        LockWorkers(sched);
+        for (i = 0; i < sched->num_workers && !found; ++i)
+        {
+            worker = &sched->workers[i];
+            task_to_remove = RemoveQueued(worker, task_id);
+            found = (NULL != task_to_remove);
+            if (!found && NULL != worker->current && !worker->cancelled &&
+                UIDIsEqual(TaskGetUID(worker->current), task_id))
+            {
+                worker->cancelled = 1;
+                found = 1;
+            }
+        }
+        UnlockWorkers(sched);
+    }
+
+    pthread_mutex_unlock(&sched->lock);
+
+    if (NULL != task_to_remove)
+    {
+        TaskDestroy(task_to_remove);
+    }
+
+    return (found ? SUCCESS : ERROR);
+}
+
+int SchedRun(scheduler_t *sched)
+{
+    size_t started = 0;
+    size_t i = 0;
+    int status = 0;
+
+    assert(sched);
+
+    pthread_mutex_lock(&sched->lock);
+    STORE(&sched->stop, 0);
+    sched->quit = 0;
+    sched->status = SUCCESS;
+    pthread_mutex_unlock(&sched->lock);
+
+    for (started = 0; started < sched->num_workers; ++started)
+    {
+        if (0 != pthread_create(&sched->workers[started].thread, NULL,
+                                    WorkerThread, &sched->workers[started]))
+        {
+            break;
+        }
+    }
+
+    pthread_mutex_lock(&sched->lock);
+    if (0 == started)
+    {
+        STORE(&sched->stop, 1);
+        sched->status = ERROR;
+    }
+
+    /* the workers that did start steal the deques of the ones that did not */
+    Dispatch(sched);
+
+    sched->quit = 1;
+    pthread_cond_broadcast(&sched->work);
+    pthread_mutex_unlock(&sched->lock);
+
+    for (i = 0; i < started; ++i)
+    {
+        pthread_join(sched->workers[i].thread, NULL);
+    }
+
+    pthread_mutex_lock(&sched->lock);
+    Requeue(sched);
+    status = sched->status;
+    pthread_mutex_unlock(&sched->lock);
+
+    return (status);
+}
+
+int SchedStop(scheduler_t *sched)
+{
+    assert(sched);
+
+    pthread_mutex_lock(&sched->lock);
+    STORE(&sched->stop, 1);
+    pthread_cond_signal(&sched->wake);
+    pthread_cond_broadcast(&sched->work);
+    pthread_mutex_unlock(&sched->lock);
+
+    return (SUCCESS);
+}
+
+void SchedClear(scheduler_t *sched)
+{
+    task_t *task_to_free = NULL;
+
+    assert(sched);
+
+    /* one at a time, so cleanup functions run without any lock held */
+    while (NULL != (task_to_free = TakeAny(sched)))
+    {
+        TaskDestroy(task_to_free);
+    }
+}
+
+size_t SchedSize(const scheduler_t *sched)
+{
+    scheduler_t *mutable_sched = (scheduler_t *)sched;
+    size_t size = 0;
+
+    assert(sched);
+
+    pthread_mutex_lock(&mutable_sched->lock);
+    size = PQCount(sched->priority_queue) + LOAD(&mutable_sched->queued);
+    pthread_mutex_unlock(&mutable_sched->lock);
+
+    return (size);
+}
+
+int SchedIsEmpty(const scheduler_t *sched)
+{
+    assert(sched);
+
+    return (0 == SchedSize(sched));
+}
+
+/******************** HELPER FUNCTIONS ********************/
+/* the dispatcher loop, runs with sched->lock held */
+static void Dispatch(scheduler_t *sched)
+{
+    task_t *task = NULL;
+    size_t due = 0;
+
+    while (!sched->stop)
+    {
+        if (PQIsEmpty(sched->priority_queue))
+        {
+            /* a running task may still come back with REPEAT */
+            if (0 == LOAD(&sched->running) && 0 == LOAD(&sched->queued))
+            {
+                break;
+            }
+
+            pthread_cond_wait(&sched->wake, &sched->lock);
+            continue;
+        }
+
+        due = TaskGetTimeToRun(PQPeek(sched->priority_queue));
+        if (TaskTimeNow() < due)
+        {
+            WaitUntil(sched, due);
+            continue;
+        }
+
+        task = (task_t *)PQDequeue(sched->priority_queue);
+        if (SUCCESS != Push(&sched->workers[sched->next_worker], task))
+        {
+            if (SUCCESS != PQEnqueue(sched->priority_queue, task))
+            {
+                TaskDestroy(task);
+            }
+            STORE(&sched->stop, 1);
+            sched->status = ERROR;
+            break;
+        }
+
+        sched->next_worker = (sched->next_worker + 1) % sched->num_workers;
+        pthread_cond_signal(&sched->work);
+    }
+}
+
+/* puts the due tasks that did not start back, runs with sched->lock held */
+static void Requeue(scheduler_t *sched)
+{
+    task_t *task = NULL;
+    size_t i = 0;
+
+    for (i = 0; i < sched->num_workers; ++i)
+    {
+        while (0 != sched->workers[i].size)
+        {
+            task = PopOldest(&sched->workers[i]);
+            __atomic_fetch_sub(&sched->queued, 1, __ATOMIC_RELEASE);
+
+            if (SUCCESS != PQEnqueue(sched->priority_queue, task))
+            {
+                TaskDestroy(task);
+                sched->status = ERROR;
+            }
+        }
+    }
+}
+
+static void *WorkerThread(void *arg)
+{
+    worker_t *self = (worker_t *)arg;
+    scheduler_t *sched = self->sched;
+    task_t *task = NULL;
+    int quit = 0;
+
+    while (!quit)
+    {
+        task = LOAD(&sched->stop) ? NULL : TakeTask(self);
+        if (NULL != task)
+        {
+            RunTask(self, task);
+            continue;
+        }
+
+        pthread_mutex_lock(&sched->lock);
+        while (!sched->quit && (sched->stop || 0 == LOAD(&sched->queued)))
+        {
+            pthread_cond_wait(&sched->work, &sched->lock);
+        }
+        quit = sched->quit;
+        pthread_mutex_unlock(&sched->lock);
+    }
+
+    return (NULL);
+}
+
+/* the oldest task of the own deque, or else the newest of another one */
+static task_t *TakeTask(worker_t *self)
+{
+    scheduler_t *sched = self->sched;
+    task_t *task = NULL;
+    size_t i = 0;
+
+    pthread_mutex_lock(&self->lock);
+    if (0 != self->size)
+    {
+        task = PopOldest(self);
+        Claim(self, task);
+    }
+    pthread_mutex_unlock(&self->lock);
+
+    for (i = 1; i < sched->num_workers && NULL == task; ++i)
+    {
+        task = Steal(self, &sched->workers[(self->index + i) %
+                                                        sched->num_workers]);
+    }
+
+    return (task);
+}
+
+/* both locks are held, so the task is never out of sight of a remove */
+static task_t *Steal(worker_t *self, worker_t *victim)
+{
+    worker_t *first = (self->index < victim->index) ? self : victim;
+    worker_t *second = (self->index < victim->index) ? victim : self;
+    task_t *task = NULL;
+
+    pthread_mutex_lock(&first->lock);
+    pthread_mutex_lock(&second->lock);
+
+    if (0 != victim->size)
+    {
+        task = PopNewest(victim);
+        Claim(self, task);
+    }
+
+    pthread_mutex_unlock(&second->lock);
+    pthread_mutex_unlock(&first->lock);
+
+    return (task);
+}
+
+/* runs with self->lock held - counted running before it stops being queued */
+static void Claim(worker_t *self, task_t *task)
+{
+    __atomic_fetch_add(&self->sched->running, 1, __ATOMIC_RELEASE);
+    __atomic_fetch_sub(&self->sched->queued, 1, __ATOMIC_RELEASE);
+
+    self->current = task;
+    self->cancelled = 0;
+}
+
+static void RunTask(worker_t *self, task_t *task)
+{
+    scheduler_t *sched = self->sched;
+    task_t *task_to_free = task;
+    int status = TaskRun(task);
+
+    pthread_mutex_lock(&sched->lock);
+
+    pthread_mutex_lock(&self->lock);
+    if (REPEAT == status && !self->cancelled)
+    {
+        TaskUpdateTimeToRun(task);
+        if (SUCCESS == PQEnqueue(sched->priority_queue, task))
+        {
+            task_to_free = NULL;
+        }
+        else
+        {
+            status = ERROR;
+        }
+    }
+    self->current = NULL;
+    pthread_mutex_unlock(&self->lock);
+
+    if ((STOP == status || ERROR == status) && SUCCESS == sched->status)
+    {
+        STORE(&sched->stop, 1);
+        sched->status = status;
+        pthread_cond_broadcast(&sched->work);
+    }
+
+    __atomic_fetch_sub(&sched->running, 1, __ATOMIC_RELEASE);
+    pthread_cond_signal(&sched->wake);
+
+    pthread_mutex_unlock(&sched->lock);
+
+    if (NULL != task_to_free)
+    {
+        TaskDestroy(task_to_free);
+    }
+}
+
+/* a task to be cleared - when none is left, the running ones are not */
+/* repeated                                                              */
+static task_t *TakeAny(scheduler_t *sched)
+{
+    task_t *task = NULL;
+    size_t i = 0;
+
+    pthread_mutex_lock(&sched->lock);
+
+    if (!PQIsEmpty(sched->priority_queue))
+    {
+        task = (task_t *)PQDequeue(sched->priority_queue);
+    }
+    else
+    {
+        LockWorkers(sched);
+        for (i = 0; i < sched->num_workers && NULL == task; ++i)
+        {
+            if (0 != sched->workers[i].size)
+            {
+                task = PopOldest(&sched->workers[i]);
+                __atomic_fetch_sub(&sched->queued, 1, __ATOMIC_RELEASE);
+            }
+        }
+
+        for (i = 0; i < sched->num_workers && NULL == task; ++i)
+        {
+            sched->workers[i].cancelled = 1;
+        }
+        UnlockWorkers(sched);
+
+        pthread_cond_signal(&sched->wake);
+    }
+
+    pthread_mutex_unlock(&sched->lock);
+
+    return (task);
+}
+
+static int Push(worker_t *worker, task_t *task)
+{
+    task_t **deque = NULL;
+    size_t capacity = 0;
+    size_t i = 0;
+
+    pthread_mutex_lock(&worker->lock);
+
+    if (worker->size == worker->capacity)
+    {
+        capacity = (0 == worker->capacity) ? MIN_DEQUE_CAPACITY :
+                                                        2 * worker->capacity;
+        deque = (task_t **)malloc(capacity * sizeof(task_t *));
+        if (NULL == deque)
+        {
+            pthread_mutex_unlock(&worker->lock);
+            return (ERROR);
+        }
+
+        for (i = 0; i < worker->size; ++i)
+        {
+            deque[i] = worker->deque[(worker->head + i) % worker->capacity];
+        }
+
+        free(worker->deque);
+        worker->deque = deque;
+        worker->capacity = capacity;
+        worker->head = 0;
+    }
+
+    worker->deque[(worker->head + worker->size) % worker->capacity] = task;
+    ++worker->size;
+    __atomic_fetch_add(&worker->sched->queued, 1, __ATOMIC_RELEASE);
+
+    pthread_mutex_unlock(&worker->lock);
+
+    return (SUCCESS);
+}
+
+static task_t *PopOldest(worker_t *worker)
+{
+    task_t *task = worker->deque[worker->head];
+
+    worker->head = (worker->head + 1) % worker->capacity;
+    --worker->size;
+
+    return (task);
+}
+
+static task_t *PopNewest(worker_t *worker)
+{
+    --worker->size;
+
+    return (worker->deque[(worker->head + worker->size) % worker->capacity]);
+}
+
+/* takes a due task that did not start yet out of the deque */
+static task_t *RemoveQueued(worker_t *worker, ilrd_uid_t task_id)
+{
+    task_t *task = NULL;
+    size_t i = 0;
+
+    for (i = 0; i < worker->size; ++i)
+    {
+        task = worker->deque[(worker->head + i) % worker->capacity];
+        if (UIDIsEqual(TaskGetUID(task), task_id))
+        {
+            break;
+        }
+    }
+
+    if (i == worker->size)
+    {
+        return (NULL);
+    }
+
+    for (; i + 1 < worker->size; ++i)
+    {
+        worker->deque[(worker->head + i) % worker->capacity] =
+                        worker->deque[(worker->head + i + 1) % worker->capacity];
+    }
+    --worker->size;
+    __atomic_fetch_sub(&worker->sched->queued, 1, __ATOMIC_RELEASE);
+
+    return (task);
+}
+
+static void LockWorkers(scheduler_t *sched)
+{
+    size_t i = 0;
+
+    for (i = 0; i < sched->num_workers; ++i)
+    {
+        pthread_mutex_lock(&sched->workers[i].lock);
+    }
+}
+
+static void UnlockWorkers(scheduler_t *sched)
+{
+    size_t i = sched->num_workers;
+
+    while (0 < i)
+    {
+        --i;
+        pthread_mutex_unlock(&sched->workers[i].lock);
+    }
+}
+
+/* waits on the task clock until when, or until woken up earlier */
+static void WaitUntil(scheduler_t *sched, size_t when)
+{
+    struct timespec deadline;
+
+    deadline.tv_sec = (time_t)(when / NS_PER_SEC);
+    deadline.tv_nsec = (long)(when % NS_PER_SEC);
+
+    pthread_cond_timedwait(&sched->wake, &sched->lock, &deadline);
+}
+
+static int PriorityRule(const void *data, const void *param)
+{
+    size_t data_time = TaskGetTimeToRun(data);
+    size_t param_time = TaskGetTimeToRun(param);
+
+    /* the nanosecond difference does not fit in an int */
+    return ((data_time > param_time) - (data_time < param_time));
+}
+
+static int FindToRemove(const void *task, void *id)
+{
+    return (UIDIsEqual((TaskGetUID((task_t *)task)), *(ilrd_uid_t *)id));
+}
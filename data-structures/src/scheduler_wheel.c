@@ -0,0 +1,463 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#include <assert.h> /* assert */
+#include <stdlib.h> /* malloc */
+
+#include "pool.h" /* pool_t */
+#include "scheduler_wheel.h" /* scheduler_t */
+#include "task.h" /* task_t */
+#include "uid_map.h" /* uid_map_t */
+
+#define WHEEL_TICK_NS (1000000UL) /* 1 ms per slot of the lowest level */
+#define WHEEL_BITS (6)
+#define WHEEL_SLOTS (1 << WHEEL_BITS) /* slots in every level */
+#define WHEEL_MASK (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS (5)
+/* ticks the wheel can see ahead, farther tasks wait in the top level */
+#define WHEEL_SPAN ((size_t)1 << (WHEEL_LEVELS * WHEEL_BITS))
+#define ENTRIES_PER_SLAB (256)
+
+/******************** STRUCTS ********************/
+typedef struct link link_t;
+typedef struct entry entry_t;
+
+struct link
+{
+    link_t *next;
+    link_t *prev;
+};
+
+struct entry
+{
+    link_t link; /* must stay first, the slot lists hold links */
+    task_t *task;
+    ilrd_uid_t id;
+    size_t expires; /* in ticks */
+};
+
+struct scheduler
+{
+    link_t slots[WHEEL_LEVELS][WHEEL_SLOTS];
+    link_t expired; /* the due tasks of the last tick, in firing order */
+    size_t now; /* the next tick to be processed */
+    uid_map_t *ids; /* uid -> entry, so a task is removed without a search */
+    pool_t *pool;
+    task_t *active;
+    int stop;
+};
+
+/******************** FORWARD DECLARATIONS ********************/
+static int AddEntry(scheduler_t *sched, task_t *task);
+static void FreeEntry(scheduler_t *sched, entry_t *entry);
+static void Place(scheduler_t *sched, entry_t *entry);
+static void Advance(scheduler_t *sched);
+static void Cascade(scheduler_t *sched, size_t level, size_t slot);
+static size_t NextEventTick(const scheduler_t *sched);
+static size_t CurrentTick(void);
+static void ListInit(link_t *list);
+static int ListIsEmpty(const link_t *list);
+static void ListPushBack(link_t *list, link_t *link);
+static void ListUnlink(link_t *link);
+static void ListMoveAll(link_t *from, link_t *to);
+static void ClearList(scheduler_t *sched, link_t *list);
+
+/******************** FUNCTIONS ********************/
+scheduler_t *SchedCreate(void)
+{
+    scheduler_t *scheduler = NULL;
+    size_t level = 0;
+    size_t slot = 0;
+
+    scheduler = (scheduler_t *)malloc(sizeof(scheduler_t));
+    if (NULL == scheduler)
+    {
+        return (NULL);
+    }
+
+    scheduler->ids = UIDMapCreate();
+    scheduler->pool = PoolCreate(sizeof(entry_t), ENTRIES_PER_SLAB);
+    if (NULL == scheduler->ids || NULL == scheduler->pool)
+    {
+        if (NULL != scheduler->ids)
+        {
+            UIDMapDestroy(scheduler->ids);
+        }
+        if (NULL != scheduler->pool)
+        {
+            PoolDestroy(scheduler->pool);
+        }
+        free(scheduler);
+
+        return (NULL);
+    }
+
+    for (level = 0; level < WHEEL_LEVELS; ++level)
+    {
+        for (slot = 0; slot < WHEEL_SLOTS; ++slot)
+        {
+            ListInit(&scheduler->slots[level][slot]);
+        }
+    }
+    ListInit(&scheduler->expired);
+
+    scheduler->now = CurrentTick();
+    scheduler->active = NULL;
+    scheduler->stop = 1;
+
+    return (scheduler);
+}
+
+void SchedDestroy(scheduler_t *sched)
+{
+    assert(sched);
+
+    SchedClear(sched);
+    PoolDestroy(sched->pool);
+    UIDMapDestroy(sched->ids);
+
+    free(sched);
+}
+
+ilrd_uid_t SchedAddTask(scheduler_t *sched, size_t interval,
+action_func_t action, void *action_param,
+cleanup_func_t cleanup_func, void *cleanup_param)
+{
+    task_t *task_to_add = NULL;
+
+    assert(sched);
+    assert(action);
+
+    task_to_add = TaskCreate(interval, action, action_param, cleanup_func,
+                            cleanup_param);
+    if (NULL == task_to_add)
+    {
+        return (bad_uid);
+    }
+
+    if (SUCCESS != AddEntry(sched, task_to_add))
+    {
+        TaskDestroy(task_to_add);
+
+        return (bad_uid);
+    }
+
+    return (TaskGetUID(task_to_add));
+}
+
+int SchedRemoveTask(scheduler_t *sched, ilrd_uid_t task_id)
+{
+    entry_t *entry = NULL;
+    task_t *task_to_remove = NULL;
+
+    assert(sched);
+
+    entry = (entry_t *)UIDMapFind(sched->ids, task_id);
+    if (NULL == entry)
+    {
+        return (ERROR);
+    }
+
+    task_to_remove = entry->task;
+    ListUnlink(&entry->link);
+    FreeEntry(sched, entry);
+
+    TaskDestroy(task_to_remove);
+
+    return (SUCCESS);
+}
+
+int SchedRun(scheduler_t *sched)
+{
+    int status = 0;
+    entry_t *entry = NULL;
+
+    assert(sched);
+
+    sched->stop = 0;
+
+    while (!SchedIsEmpty(sched) && (sched->stop) == 0)
+    {
+        if (ListIsEmpty(&sched->expired))
+        {
+            /* nothing happens in the ticks before, they are skipped */
+            sched->now = NextEventTick(sched);
+            TaskSleepUntil(sched->now * WHEEL_TICK_NS);
+
+            Advance(sched);
+            continue;
+        }
+
+        /* the tick has started, the task itself may be due later in it */
+        entry = (entry_t *)sched->expired.next;
+        TaskSleepUntil(TaskGetTimeToRun(entry->task));
+
+        sched->active = entry->task;
+        ListUnlink(&entry->link);
+        FreeEntry(sched, entry);
+
+        status = TaskRun(sched->active);
+
+        if (REPEAT == status)
+        {
+            TaskUpdateTimeToRun(sched->active);
+
+            if (SUCCESS != AddEntry(sched, sched->active))
+            {
+                TaskDestroy(sched->active);
+                return (ERROR);
+            }
+        }
+        else
+        {
+            TaskDestroy(sched->active);
+        }
+
+        if (STOP == status || ERROR == status)
+        {
+            SchedStop(sched);
+            return (status);
+        }
+    }
+
+    return (SUCCESS);
+}
+
+int SchedStop(scheduler_t *sched)
+{
+    assert(sched);
+
+    sched->stop = 1;
+
+    return (SUCCESS);
+}
+
+void SchedClear(scheduler_t *sched)
+{
+    size_t level = 0;
+    size_t slot = 0;
+
+    assert(sched);
+
+    for (level = 0; level < WHEEL_LEVELS; ++level)
+    {
+        for (slot = 0; slot < WHEEL_SLOTS; ++slot)
+        {
+            ClearList(sched, &sched->slots[level][slot]);
+        }
+    }
+    ClearList(sched, &sched->expired);
+}
+
+size_t SchedSize(const scheduler_t *sched)
+{
+    assert(sched);
+
+    return (UIDMapSize(sched->ids));
+}
+
+int SchedIsEmpty(const scheduler_t *sched)
+{
+    assert(sched);
+
+    return (0 == UIDMapSize(sched->ids));
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static int AddEntry(scheduler_t *sched, task_t *task)
+{
+    entry_t *entry = (entry_t *)PoolAlloc(sched->pool);
+    if (NULL == entry)
+    {
+        return (ERROR);
+    }
+
+    entry->task = task;
+    entry->id = TaskGetUID(task);
+    entry->expires = TaskGetTimeToRun(task) / WHEEL_TICK_NS;
+
+    if (0 != UIDMapInsert(sched->ids, entry->id, entry))
+    {
+        PoolFree(sched->pool, entry);
+
+        return (ERROR);
+    }
+
+    Place(sched, entry);
+
+    return (SUCCESS);
+}
+
+/* the entry must already be unlinked from its slot */
+static void FreeEntry(scheduler_t *sched, entry_t *entry)
+{
+    UIDMapRemove(sched->ids, entry->id);
+    PoolFree(sched->pool, entry);
+}
+
+/* picks the lowest level whose span still reaches the expiration tick */
+static void Place(scheduler_t *sched, entry_t *entry)
+{
+    size_t expires = entry->expires;
+    size_t delta = 0;
+    size_t level = 0;
+
+    /* overdue tasks fire with the next tick */
+    if (expires < sched->now)
+    {
+        expires = sched->now;
+    }
+
+    delta = expires - sched->now;
+    if (delta >= WHEEL_SPAN)
+    {
+        /* parked as far as the wheel sees, cascades will re-place it */
+        expires = sched->now + WHEEL_SPAN - 1;
+        delta = WHEEL_SPAN - 1;
+    }
+
+    while (0 != (delta >> ((level + 1) * WHEEL_BITS)))
+    {
+        ++level;
+    }
+
+    ListPushBack(&sched->slots[level][(expires >> (level * WHEEL_BITS)) &
+                                            WHEEL_MASK], &entry->link);
+}
+
+/* processes the tick sched->now, its due tasks are moved to expired */
+static void Advance(scheduler_t *sched)
+{
+    size_t tick = sched->now;
+    size_t level = 1;
+
+    /* a level's next slot comes down whenever the level below wraps */
+    while (level < WHEEL_LEVELS &&
+           0 == ((tick >> ((level - 1) * WHEEL_BITS)) & WHEEL_MASK))
+    {
+        Cascade(sched, level, (tick >> (level * WHEEL_BITS)) & WHEEL_MASK);
+        ++level;
+    }
+
+    ListMoveAll(&sched->slots[0][tick & WHEEL_MASK], &sched->expired);
+
+    sched->now = tick + 1;
+}
+
+static void Cascade(scheduler_t *sched, size_t level, size_t slot)
+{
+    link_t pending;
+    entry_t *entry = NULL;
+
+    ListInit(&pending);
+    ListMoveAll(&sched->slots[level][slot], &pending);
+
+    while (!ListIsEmpty(&pending))
+    {
+        entry = (entry_t *)pending.next;
+        ListUnlink(&entry->link);
+        Place(sched, entry);
+    }
+}
+
+/* the first tick at which a slot fires or a non empty slot cascades */
+static size_t NextEventTick(const scheduler_t *sched)
+{
+    size_t next = (size_t)-1;
+    size_t level = 0;
+    size_t offset = 0;
+    size_t block = 0;
+    size_t first = 0;
+
+    for (offset = 0; offset < WHEEL_SLOTS && (size_t)-1 == next; ++offset)
+    {
+        if (!ListIsEmpty(&sched->slots[0][(sched->now + offset) & WHEEL_MASK]))
+        {
+            next = sched->now + offset;
+        }
+    }
+
+    /* a higher level slot cascades when its block starts. The slot of the */
+    /* current block was already cascaded and waits a whole round, unless  */
+    /* now is the first tick of the block and it is still to be processed  */
+    for (level = 1; level < WHEEL_LEVELS; ++level)
+    {
+        first = (0 != (sched->now & ((1UL << (level * WHEEL_BITS)) - 1)));
+        for (offset = first; offset < first + WHEEL_SLOTS; ++offset)
+        {
+            block = (sched->now >> (level * WHEEL_BITS)) + offset;
+            if (!ListIsEmpty(&sched->slots[level][block & WHEEL_MASK]))
+            {
+                block <<= level * WHEEL_BITS;
+                next = (block < next) ? block : next;
+                break;
+            }
+        }
+    }
+
+    assert((size_t)-1 != next);
+
+    return (next);
+}
+
+static size_t CurrentTick(void)
+{
+    return (TaskTimeNow() / WHEEL_TICK_NS);
+}
+
+static void ListInit(link_t *list)
+{
+    list->next = list;
+    list->prev = list;
+}
+
+static int ListIsEmpty(const link_t *list)
+{
+    return (list->next == list);
+}
+
+static void ListPushBack(link_t *list, link_t *link)
+{
+    link->next = list;
+    link->prev = list->prev;
+    list->prev->next = link;
+    list->prev = link;
+}
+
+static void ListUnlink(link_t *link)
+{
+    link->prev->next = link->next;
+    link->next->prev = link->prev;
+}
+
+/* appends all of from to the end of to, from is left empty */
+static void ListMoveAll(link_t *from, link_t *to)
+{
+    if (ListIsEmpty(from))
+    {
+        return;
+    }
+
+    from->next->prev = to->prev;
+    to->prev->next = from->next;
+    from->prev->next = to;
+    to->prev = from->prev;
+
+    ListInit(from);
+}
+
+/* destroys the task of every entry in the list, the list is left empty */
+static void ClearList(scheduler_t *sched, link_t *list)
+{
+    entry_t *entry = NULL;
+
+    while (!ListIsEmpty(list))
+    {
+        entry = (entry_t *)list->next;
+        ListUnlink(&entry->link);
+        TaskDestroy(entry->task);
+        FreeEntry(sched, entry);
+    }
+}
@@ -6,6 +6,7 @@ Date: Feb 16, 2024
 #include <stdlib.h> /* malloc */
 #include <assert.h> /* assert */
 #include "slist.h" /* slist_t */
+#include "pool.h" /* pool_t */
 
 enum status 
 {
@@ -27,13 +28,15 @@ struct slist
 {
     node_t *head;
     node_t *tail;
+    pool_t *pool; /* NULL when the nodes are allocated with malloc */
+    size_t count;
 };
 
 /******************** FORWARD DECLARATIONS ********************/
 static slist_iter_t NodeToIter(node_t *node);
 static node_t *IterToNode(slist_iter_t iter);
-static int AddOne(void *data , void *count);
-static node_t *CreateNode(void *data, void* next);
+static node_t *CreateNode(slist_t *list, void *data, void* next);
+static void FreeNode(slist_t *list, node_t *node);
 static node_t *GoToEnd(node_t *node);
 
 /******************** FUNCTIONS ********************/
@@ -46,8 +49,11 @@ slist_t *SListCreate()
 	{
 		return NULL;
 	}
+
+	new_list->pool = NULL;
+	new_list->count = 0;
 	
-	dummy = CreateNode(new_list, NULL);
+	dummy = CreateNode(new_list, new_list, NULL);
 	if (NULL == dummy)
 	{
 		free(new_list);
@@ -60,6 +66,40 @@ slist_t *SListCreate()
 	return new_list;
 }
 
+pool_t *SListCreatePool(size_t nodes_per_slab)
+{
+	return (PoolCreate(sizeof(node_t), nodes_per_slab));
+}
+
+slist_t *SListCreateWithPool(pool_t *pool)
+{
+	node_t *dummy;
+	slist_t *new_list = NULL;
+	
+	assert(pool);
+
+	new_list = (slist_t *)malloc(sizeof(slist_t));
+	if (NULL == new_list)
+	{
+		return NULL;
+	}
+
+	new_list->pool = pool;
+	new_list->count = 0;
+
+	dummy = CreateNode(new_list, new_list, NULL);
+	if (NULL == dummy)
+	{
+		free(new_list);
+		return NULL;
+	}
+
+	new_list->head = dummy;
+	new_list->tail = dummy;
+
+	return new_list;
+}
+
 void SListDestroy(slist_t *list)
 {
 	slist_iter_t curr = SListBegin(list);
@@ -70,11 +110,11 @@ void SListDestroy(slist_t *list)
 	while (!SListIsIterSame(curr, SListEnd(list)))
 	{
 		next = curr->next;
-		free(curr);
+		FreeNode(list, curr);
 		curr = next;
 	}
 
-	free(curr);
+	FreeNode(list, curr);
 	free(list);
 }
 
@@ -112,10 +152,10 @@ int SListIsIterSame(slist_iter_t where1, slist_iter_t where2)
 	return where1_node == where2_node;
 }
 
-slist_iter_t SListInsert(slist_iter_t where, void* data)
+slist_iter_t SListInsert(slist_t *list, slist_iter_t where, void* data)
 {
 	node_t *where_node = IterToNode(where);
-	node_t *new_node = CreateNode(where_node->data, where_node->next);
+	node_t *new_node = CreateNode(list, where_node->data, where_node->next);
 	if (NULL == new_node)
 	{
 		return NodeToIter(GoToEnd(where_node));
@@ -123,6 +163,7 @@ slist_iter_t SListInsert(slist_iter_t where, void* data)
 	
 	where_node->next = new_node;
 	where_node->data = data;
+	++list->count;
 
 	
 	if (NULL == new_node->next)
@@ -133,19 +174,21 @@ slist_iter_t SListInsert(slist_iter_t where, void* data)
 	return NodeToIter(where_node);
 }
 
-slist_iter_t SListRemove(slist_iter_t to_remove)
+slist_iter_t SListRemove(slist_t *list, slist_iter_t to_remove)
 {
 	node_t *temp_node = NULL;
 	node_t *to_remove_node = IterToNode(to_remove);
 	
+	assert(list);
 	assert(to_remove);
 	assert(to_remove_node->next != NULL);
 	
 	temp_node = to_remove_node->next;
 	to_remove_node->data = to_remove_node->next->data;
 	to_remove_node->next = to_remove_node->next->next;
+	--list->count;
 	
-	free(temp_node);
+	FreeNode(list, temp_node);
 	
 	if (to_remove_node->next == NULL)
 	{
@@ -176,15 +219,9 @@ void SListSetData(slist_iter_t iter, void *data)
 
 size_t SListCount(const slist_t *list)
 {
-	size_t count = 0;
-	node_t *head = list->head;
-	node_t *tail = list->tail;
-	
 	assert(list);
-
-	SListForEach(head, tail, AddOne, &count);
 		
-	return (count);
+	return (list->count);
 }
 
 int SListIsEmpty(const slist_t *list)
@@ -234,6 +271,7 @@ void SListAppend(slist_t *dest, slist_t *src)
 	assert(dest != src);
 	assert(dest);
 	assert(src);
+	assert(dest->pool == src->pool);
 	
 	/* prevent breaking dest when src is empty */
 	if (SListIsEmpty(src)) 
@@ -248,6 +286,9 @@ void SListAppend(slist_t *dest, slist_t *src)
 	src->head->data = src_dummy_data;
     src->tail = src->head;
     src->tail->next = NULL;
+
+	dest->count += src->count;
+	src->count = 0;
 }
 
 /******************** FUNCTIONS HELPERS ********************/
@@ -261,18 +302,19 @@ static node_t *IterToNode(slist_iter_t iter)
 	return ((node_t *)iter);
 }
 
-static int AddOne(void *data , void *count)
-{	
-	(void)data;
-	
-	*(size_t *)count = *(size_t *)count + 1;
-	
-	return SUCCESS;
-}
-
-static node_t *CreateNode(void *data, void *next)
+static node_t *CreateNode(slist_t *list, void *data, void *next)
 {
-	node_t *new_node = (node_t *)(malloc)(sizeof(node_t));
+	node_t *new_node = NULL;
+
+	if (NULL != list->pool)
+	{
+		new_node = (node_t *)PoolAlloc(list->pool);
+	}
+	else
+	{
+		new_node = (node_t *)(malloc)(sizeof(node_t));
+	}
+
 	if (NULL == new_node)
 	{
 		return NULL;
@@ -284,6 +326,18 @@ static node_t *CreateNode(void *data, void *next)
 	return new_node;
 }
 
+static void FreeNode(slist_t *list, node_t *node)
+{
+	if (NULL != list->pool)
+	{
+		PoolFree(list->pool, node);
+	}
+	else
+	{
+		free(node);
+	}
+}
+
 static node_t *GoToEnd(node_t *node)
 {
 	while(node->next != NULL)
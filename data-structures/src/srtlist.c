@@ -7,12 +7,6 @@ Date: Feb 22, 2024
 #include <assert.h> /*assert*/
 #include "srtlist.h" /*srtlist_iter_t*/
 
-#ifndef NDEBUG
-    #define DEBUG_ONLY(x) {x;}
-#else
-    #define DEBUG_ONLY(x)
-#endif
-
 /******************** STRUCTS ********************/
 struct srtlist
 {
@@ -20,6 +14,15 @@ struct srtlist
 	cmp_func_t cmp_func;
 };
 
+/******************** FORWARD DECLARATIONS ********************/
+static srtlist_iter_t SkipNotAfter(const srtlist_t *dest, srtlist_iter_t where,
+								   const void *data);
+static srtlist_iter_t RunEnd(const srtlist_t *dest, srtlist_iter_t where,
+							 const srtlist_t *src, const srtlist_t *other,
+							 int wins_ties);
+static int IsHeadBefore(srtlist_t **srcs, size_t lhs, size_t rhs);
+static void SiftDown(srtlist_t **srcs, size_t *heads, size_t n, size_t idx);
+
 /******************** FUNCTIONS ********************/
 srtlist_t *SrtListCreate(cmp_func_t cmp_func)
 {
@@ -63,7 +66,7 @@ srtlist_iter_t SrtListBegin(const srtlist_t *list)
 	assert(list);
 	
 	iter.iter = DListBegin(list->dlist);
-	DEBUG_ONLY(iter.list = (srtlist_t *)list);
+	iter.list = list;
 	
 	return (iter);
 }
@@ -75,7 +78,7 @@ srtlist_iter_t SrtListEnd(const srtlist_t *list)
 	assert(list);
 	
 	iter.iter = DListEnd(list->dlist);
-	DEBUG_ONLY(iter.list = (srtlist_t *)list);
+	iter.list = list;
 	
 	return (iter);
 }
@@ -111,15 +114,15 @@ srtlist_iter_t SrtListInsert(srtlist_t *list, void* data)
 		runner = SrtListNext(runner);
 	}
 	
-	runner.iter = DListInsert(runner.iter, data);
-	DEBUG_ONLY(runner.list = list);
+	runner.iter = DListInsert(list->dlist, runner.iter, data);
+	runner.list = list;
 	
 	return (runner);
 }
 
 srtlist_iter_t SrtListRemove(srtlist_iter_t to_remove)
 {
-	to_remove.iter = DListRemove(to_remove.iter);
+	to_remove.iter = DListRemove(to_remove.list->dlist, to_remove.iter);
 	
 	return (to_remove);
 }
@@ -197,40 +200,171 @@ void *SrtListPopFront(srtlist_t *list)
 
 void SrtListMerge(srtlist_t *dest, srtlist_t *src)
 {
-	srtlist_iter_t from = SrtListBegin(src);
-	srtlist_iter_t to = SrtListNext(from);
 	srtlist_iter_t where = SrtListBegin(dest);
+	srtlist_iter_t to;
 	
 	assert(dest);
 	assert(src);
-	assert(where.list != from.list);
+	assert(dest != src);
 	assert(src->cmp_func == dest->cmp_func);
 	
+	/* one walk over both lists, src moves over in whole runs */
 	while (!SrtListIsEmpty(src))
 	{
-		from = SrtListBegin(src);
-		to = SrtListNext(from);
+		where = SkipNotAfter(dest, where, SrtListGetData(SrtListBegin(src)));
+		to = RunEnd(dest, where, src, NULL, 0);
 		
-		while(!SrtListIsIterSame(where, SrtListEnd(dest)) &&
-		dest->cmp_func(SrtListGetData(from), SrtListGetData(where)) >= 0)
+		DListSplice(src->dlist, SrtListBegin(src).iter, to.iter, dest->dlist,
+					where.iter);
+	}
+}
+
+void SrtListMergeMany(srtlist_t *dest, srtlist_t **srcs, size_t k)
+{
+	srtlist_iter_t where = SrtListBegin(dest);
+	srtlist_iter_t to;
+	srtlist_t *src = NULL;
+	size_t *heads = NULL;
+	size_t next = 0;
+	size_t n = 0;
+	size_t i = 0;
+	
+	assert(dest);
+	assert(srcs || 0 == k);
+	
+	heads = (size_t *)malloc(k * sizeof(size_t));
+	if (NULL == heads)
+	{
+		/* no room for the heap, merges them one at a time instead */
+		for (i = 0; i < k; ++i)
 		{
-			where = SrtListNext(where);
+			SrtListMerge(dest, srcs[i]);
 		}
 		
-		if (SrtListIsIterSame(where, SrtListEnd(dest)))
+		return;
+	}
+	
+	/* a min heap of the non empty srcs, by their first element */
+	for (i = 0; i < k; ++i)
+	{
+		assert(srcs[i] != dest);
+		assert(srcs[i]->cmp_func == dest->cmp_func);
+		
+		if (!SrtListIsEmpty(srcs[i]))
 		{
-			to = SrtListEnd(src);
-		} 
-		else
+			heads[n++] = i;
+		}
+	}
+	
+	for (i = n / 2; 0 < i--; )
+	{
+		SiftDown(srcs, heads, n, i);
+	}
+	
+	/* the top src gives up the run that goes before both dest and the  */
+	/* next smallest head, then sinks to its place in the heap         */
+	while (0 < n)
+	{
+		src = srcs[heads[0]];
+		next = (n > 2 && IsHeadBefore(srcs, heads[2], heads[1])) ? 2 : 1;
+		
+		where = SkipNotAfter(dest, where, SrtListGetData(SrtListBegin(src)));
+		to = RunEnd(dest, where, src, (n > 1) ? srcs[heads[next]] : NULL, 
+										(n > 1) && heads[0] < heads[next]);
+		
+		DListSplice(src->dlist, SrtListBegin(src).iter, to.iter, dest->dlist,
+					where.iter);
+		
+		if (SrtListIsEmpty(src))
 		{
-			while(!SrtListIsIterSame(to, SrtListEnd(src)) &&
-			dest->cmp_func(SrtListGetData(where), SrtListGetData(to)) >= 0)
+			heads[0] = heads[--n];
+		}
+		
+		SiftDown(srcs, heads, n, 0);
+	}
+	
+	free(heads);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+/* the first dest element after data - dest keeps its place on ties */
+static srtlist_iter_t SkipNotAfter(const srtlist_t *dest, srtlist_iter_t where,
+								   const void *data)
+{
+	while (!SrtListIsIterSame(where, SrtListEnd(dest)) && 
+		   0 >= dest->cmp_func(SrtListGetData(where), data))
+	{
+		where = SrtListNext(where);
+	}
+	
+	return (where);
+}
+
+/* the end of the src run that goes before 'where', and before the head */
+/* of 'other' unless it is NULL. on a tie with other src goes first    */
+/* only when wins_ties is set                                           */
+static srtlist_iter_t RunEnd(const srtlist_t *dest, srtlist_iter_t where,
+							 const srtlist_t *src, const srtlist_t *other,
+							 int wins_ties)
+{
+	srtlist_iter_t to = SrtListNext(SrtListBegin(src));
+	int res = 0;
+	
+	while (!SrtListIsIterSame(to, SrtListEnd(src)))
+	{
+		if (!SrtListIsIterSame(where, SrtListEnd(dest)) && 
+			0 <= dest->cmp_func(SrtListGetData(to), SrtListGetData(where)))
+		{
+			break;
+		}
+		
+		if (NULL != other)
+		{
+			res = dest->cmp_func(SrtListGetData(to), 
+								 SrtListGetData(SrtListBegin(other)));
+			if (0 < res || (0 == res && !wins_ties))
 			{
-				to = SrtListNext(to);
+				break;
 			}
 		}
 		
-		DListSplice(from.iter, to.iter, where.iter); 
+		to = SrtListNext(to);
 	}
+	
+	return (to);
+}
+
+/* compares the first elements, an earlier src goes first on a tie */
+static int IsHeadBefore(srtlist_t **srcs, size_t lhs, size_t rhs)
+{
+	int res = srcs[lhs]->cmp_func(SrtListGetData(SrtListBegin(srcs[lhs])), 
+								  SrtListGetData(SrtListBegin(srcs[rhs])));
+	
+	return (0 > res || (0 == res && lhs < rhs));
 }
 
+static void SiftDown(srtlist_t **srcs, size_t *heads, size_t n, size_t idx)
+{
+	size_t child = 2 * idx + 1;
+	size_t tmp = 0;
+	
+	while (child < n)
+	{
+		if (child + 1 < n && IsHeadBefore(srcs, heads[child + 1], heads[child]))
+		{
+			++child;
+		}
+		
+		if (!IsHeadBefore(srcs, heads[child], heads[idx]))
+		{
+			break;
+		}
+		
+		tmp = heads[idx];
+		heads[idx] = heads[child];
+		heads[child] = tmp;
+		
+		idx = child;
+		child = 2 * idx + 1;
+	}
+}
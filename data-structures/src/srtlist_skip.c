@@ -0,0 +1,496 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#include <stdlib.h> /* malloc */
+#include <stddef.h> /* offsetof */
+#include <assert.h> /* assert */
+
+#include "srtlist_skip.h" /* srtlist_iter_t */
+
+#ifndef NDEBUG
+    #define DEBUG_ONLY(x) {x;}
+#else
+    #define DEBUG_ONLY(x)
+#endif
+
+#define MAX_LEVEL (32) /* 4^32 nodes before the top level gets crowded */
+#define SEED (0x9E3779B9UL)
+
+/******************** STRUCTS ********************/
+typedef struct skip_node node_t;
+
+typedef struct skip_link
+{
+	node_t *next;
+	node_t *prev;
+} skip_link_t;
+
+struct skip_node
+{
+	void *data;
+	srtlist_t *list; /* the owner, needed to keep the count on remove */
+	size_t level;
+	skip_link_t links[1]; /* level links, allocated past the struct */
+};
+
+struct srtlist
+{
+	cmp_func_t cmp_func;
+	node_t *head; /* sentinels on every level */
+	node_t *tail;
+	size_t level; /* the highest level in use */
+	size_t count;
+	size_t seed;
+};
+
+/******************** FORWARD DECLARATIONS ********************/
+static node_t *CreateNode(srtlist_t *list, void *data, size_t level);
+static size_t RandomLevel(srtlist_t *list);
+static void FindPreds(srtlist_t *list, const void *data, node_t **preds);
+static node_t *LowerBound(const srtlist_t *list, const void *data);
+static void LinkNode(srtlist_t *list, node_t *node, node_t **preds);
+static void UnlinkNode(node_t *node);
+static srtlist_iter_t NodeToIter(const srtlist_t *list, node_t *node);
+
+/******************** FUNCTIONS ********************/
+srtlist_t *SrtListCreate(cmp_func_t cmp_func)
+{
+	srtlist_t *new_srtlist = NULL;
+	size_t i = 0;
+
+	assert(cmp_func);
+
+	new_srtlist = (srtlist_t *)malloc(sizeof(srtlist_t));
+	if (NULL == new_srtlist)
+	{
+		return (NULL);
+	}
+
+	new_srtlist->head = CreateNode(new_srtlist, new_srtlist, MAX_LEVEL);
+	new_srtlist->tail = CreateNode(new_srtlist, new_srtlist, MAX_LEVEL);
+	if (NULL == new_srtlist->head || NULL == new_srtlist->tail)
+	{
+		free(new_srtlist->head);
+		free(new_srtlist->tail);
+		free(new_srtlist);
+
+		return (NULL);
+	}
+
+	for (i = 0; i < MAX_LEVEL; ++i)
+	{
+		new_srtlist->head->links[i].next = new_srtlist->tail;
+		new_srtlist->head->links[i].prev = NULL;
+		new_srtlist->tail->links[i].next = NULL;
+		new_srtlist->tail->links[i].prev = new_srtlist->head;
+	}
+
+	new_srtlist->cmp_func = cmp_func;
+	new_srtlist->level = 1;
+	new_srtlist->count = 0;
+	new_srtlist->seed = SEED;
+
+	return (new_srtlist);
+}
+
+void SrtListDestroy(srtlist_t *list)
+{
+	node_t *node = NULL;
+	node_t *next = NULL;
+
+	assert(list);
+
+	for (node = list->head->links[0].next; node != list->tail; node = next)
+	{
+		next = node->links[0].next;
+		free(node);
+	}
+
+	free(list->head);
+	free(list->tail);
+	free(list);
+}
+
+srtlist_iter_t SrtListBegin(const srtlist_t *list)
+{
+	assert(list);
+
+	return (NodeToIter(list, list->head->links[0].next));
+}
+
+srtlist_iter_t SrtListEnd(const srtlist_t *list)
+{
+	assert(list);
+
+	return (NodeToIter(list, list->tail));
+}
+
+srtlist_iter_t SrtListNext(srtlist_iter_t iter)
+{
+	iter.iter = iter.iter->links[0].next;
+
+	return (iter);
+}
+
+srtlist_iter_t SrtListPrev(srtlist_iter_t iter)
+{
+	iter.iter = iter.iter->links[0].prev;
+
+	return (iter);
+}
+
+int SrtListIsIterSame(srtlist_iter_t iter1, srtlist_iter_t iter2)
+{
+	return (iter1.iter == iter2.iter);
+}
+
+srtlist_iter_t SrtListInsert(srtlist_t *list, void *data)
+{
+	node_t *preds[MAX_LEVEL];
+	node_t *node = NULL;
+
+	assert(list);
+
+	node = CreateNode(list, data, RandomLevel(list));
+	if (NULL == node)
+	{
+		return (SrtListEnd(list));
+	}
+
+	FindPreds(list, data, preds);
+	LinkNode(list, node, preds);
+
+	return (NodeToIter(list, node));
+}
+
+srtlist_iter_t SrtListRemove(srtlist_iter_t to_remove)
+{
+	node_t *node = to_remove.iter;
+
+	assert(node != node->list->tail);
+
+	to_remove.iter = node->links[0].next;
+
+	UnlinkNode(node);
+	free(node);
+
+	return (to_remove);
+}
+
+void *SrtListGetData(srtlist_iter_t iter)
+{
+	return (iter.iter->data);
+}
+
+size_t SrtListCount(const srtlist_t *list)
+{
+	assert(list);
+
+	return (list->count);
+}
+
+int SrtListIsEmpty(const srtlist_t *list)
+{
+	assert(list);
+
+	return (0 == list->count);
+}
+
+srtlist_iter_t SrtListFind(srtlist_t *list, srtlist_iter_t from,
+						   srtlist_iter_t to, void *data)
+{
+	node_t *found = NULL;
+
+	assert(list);
+	assert(from.list == to.list);
+
+	if (SrtListIsIterSame(from, to))
+	{
+		return (to);
+	}
+
+	/* the first node not before data, but not before 'from' either */
+	found = from.iter;
+	if (list->cmp_func(found->data, data) < 0)
+	{
+		found = LowerBound(list, data);
+
+		/* the range ends before it */
+		if (to.iter != list->tail && list->cmp_func(to.iter->data, data) < 0)
+		{
+			return (to);
+		}
+	}
+
+	if (found == list->tail || 0 != list->cmp_func(found->data, data))
+	{
+		return (to);
+	}
+
+	from.iter = found;
+
+	return (from);
+}
+
+srtlist_iter_t SrtListFindIf(srtlist_iter_t from, srtlist_iter_t to,
+							 match_func_t is_match, void *param)
+{
+	assert(from.list == to.list);
+	assert(is_match);
+
+	while (!SrtListIsIterSame(from, to) &&
+		   !is_match(SrtListGetData(from), param))
+	{
+		from = SrtListNext(from);
+	}
+
+	return (from);
+}
+
+int SrtListForEach(srtlist_iter_t from, srtlist_iter_t to,
+				   action_func_t action, void *param)
+{
+	int status = 0;
+
+	assert(action);
+	assert(from.list == to.list);
+
+	while (!SrtListIsIterSame(from, to) && 0 == status)
+	{
+		status = action(SrtListGetData(from), param);
+		from = SrtListNext(from);
+	}
+
+	return (status);
+}
+
+void *SrtListPopBack(srtlist_t *list)
+{
+	node_t *node = NULL;
+	void *data = NULL;
+
+	assert(list);
+	assert(!SrtListIsEmpty(list));
+
+	node = list->tail->links[0].prev;
+	data = node->data;
+
+	UnlinkNode(node);
+	free(node);
+
+	return (data);
+}
+
+void *SrtListPopFront(srtlist_t *list)
+{
+	node_t *node = NULL;
+	void *data = NULL;
+
+	assert(list);
+	assert(!SrtListIsEmpty(list));
+
+	node = list->head->links[0].next;
+	data = node->data;
+
+	UnlinkNode(node);
+	free(node);
+
+	return (data);
+}
+
+void SrtListMerge(srtlist_t *dest, srtlist_t *src)
+{
+	node_t *preds[MAX_LEVEL];
+	node_t *node = NULL;
+	node_t *start = NULL;
+	size_t i = 0;
+
+	assert(dest);
+	assert(src);
+	assert(dest != src);
+	assert(src->cmp_func == dest->cmp_func);
+
+	for (i = 0; i < MAX_LEVEL; ++i)
+	{
+		preds[i] = dest->head;
+	}
+
+	/* the nodes move over with their towers. src is sorted, so the     */
+	/* predecessors of one node are a lower bound for the next - every  */
+	/* level resumes from where the last search left it (a finger)      */
+	while (!SrtListIsEmpty(src))
+	{
+		node = src->head->links[0].next;
+		UnlinkNode(node);
+		node->list = dest;
+
+		start = dest->head;
+		for (i = (node->level > dest->level ? node->level : dest->level);
+															0 < i--; )
+		{
+			if (preds[i] != dest->head && (start == dest->head ||
+				dest->cmp_func(preds[i]->data, start->data) > 0))
+			{
+				start = preds[i];
+			}
+
+			while (start->links[i].next != dest->tail &&
+				dest->cmp_func(start->links[i].next->data, node->data) <= 0)
+			{
+				start = start->links[i].next;
+			}
+
+			preds[i] = start;
+		}
+
+		LinkNode(dest, node, preds);
+
+		/* the new node is the nearest predecessor of the next one */
+		for (i = 0; i < node->level; ++i)
+		{
+			preds[i] = node;
+		}
+	}
+}
+
+/* every node is placed by a search already, a heap over the heads would */
+/* not save any of them                                                  */
+void SrtListMergeMany(srtlist_t *dest, srtlist_t **srcs, size_t k)
+{
+	size_t i = 0;
+
+	assert(dest);
+	assert(srcs || 0 == k);
+
+	for (i = 0; i < k; ++i)
+	{
+		SrtListMerge(dest, srcs[i]);
+	}
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static node_t *CreateNode(srtlist_t *list, void *data, size_t level)
+{
+	node_t *node = (node_t *)malloc(offsetof(node_t, links) +
+											level * sizeof(skip_link_t));
+	if (NULL == node)
+	{
+		return (NULL);
+	}
+
+	node->data = data;
+	node->list = list;
+	node->level = level;
+
+	return (node);
+}
+
+/* one xorshift draw per node: each pair of zero bits is one more level, */
+/* so a node reaches level k + 1 with probability 1/4^k                  */
+static size_t RandomLevel(srtlist_t *list)
+{
+	size_t bits = list->seed;
+	size_t level = 1;
+
+	bits ^= bits << 13;
+	bits ^= bits >> 7;
+	bits ^= bits << 17;
+	list->seed = bits;
+
+	while (0 == (bits & 3) && level < MAX_LEVEL)
+	{
+		++level;
+		bits >>= 2;
+	}
+
+	return (level);
+}
+
+/* the last node on every level that is not after data - a new node with */
+/* equal data goes after them, as in srtlist.c                           */
+static void FindPreds(srtlist_t *list, const void *data, node_t **preds)
+{
+	node_t *runner = list->head;
+	size_t i = MAX_LEVEL;
+
+	while (i > list->level)
+	{
+		preds[--i] = list->head;
+	}
+
+	while (0 < i--)
+	{
+		while (runner->links[i].next != list->tail &&
+			   list->cmp_func(runner->links[i].next->data, data) <= 0)
+		{
+			runner = runner->links[i].next;
+		}
+
+		preds[i] = runner;
+	}
+}
+
+/* the first node that is not before data, or the tail */
+static node_t *LowerBound(const srtlist_t *list, const void *data)
+{
+	node_t *runner = list->head;
+	size_t i = list->level;
+
+	while (0 < i--)
+	{
+		while (runner->links[i].next != list->tail &&
+			   list->cmp_func(runner->links[i].next->data, data) < 0)
+		{
+			runner = runner->links[i].next;
+		}
+	}
+
+	return (runner->links[0].next);
+}
+
+static void LinkNode(srtlist_t *list, node_t *node, node_t **preds)
+{
+	size_t i = 0;
+
+	for (i = 0; i < node->level; ++i)
+	{
+		node->links[i].prev = preds[i];
+		node->links[i].next = preds[i]->links[i].next;
+		preds[i]->links[i].next->links[i].prev = node;
+		preds[i]->links[i].next = node;
+	}
+
+	if (node->level > list->level)
+	{
+		list->level = node->level;
+	}
+
+	++list->count;
+}
+
+/* every level is doubly linked, so no search is needed to unlink */
+static void UnlinkNode(node_t *node)
+{
+	size_t i = 0;
+
+	for (i = 0; i < node->level; ++i)
+	{
+		node->links[i].prev->links[i].next = node->links[i].next;
+		node->links[i].next->links[i].prev = node->links[i].prev;
+	}
+
+	--node->list->count;
+}
+
+static srtlist_iter_t NodeToIter(const srtlist_t *list, node_t *node)
+{
+	srtlist_iter_t iter;
+
+	iter.iter = node;
+	DEBUG_ONLY(iter.list = list);
+	(void)list;
+
+	return (iter);
+}
@@ -8,14 +8,20 @@ Date: Feb 7, 2024
 #include <assert.h> /* assert */
 #include <string.h> /* memcpy */
 
+#define GROWTH_FACTOR (2)
+
 typedef struct stack
 {
 	size_t capacity;
 	size_t element_size;
 	size_t top;
+	int is_small; /* may spill out of the inline buffer when full */
 	void *elements;
 } stack_t;
 
+static int Spill(stack_t *stack);
+static void *InlineBuffer(const stack_t *stack);
+
 stack_t *StackCreate(size_t capacity, size_t element_size)
 {
 	stack_t *new_stack = (stack_t *)calloc(1, sizeof(stack_t)
@@ -32,6 +38,28 @@ stack_t *StackCreate(size_t capacity, size_t element_size)
 	new_stack->capacity = capacity;
 	new_stack->element_size = element_size;
 	new_stack->top = 0;
+	new_stack->is_small = 0;
+	
+	return new_stack;
+}
+
+stack_t *StackCreateSmall(size_t inline_capacity, size_t element_size)
+{
+	stack_t *new_stack = NULL;
+	
+	/* an empty buffer could not double */
+	if (0 == inline_capacity)
+	{
+		inline_capacity = 1;
+	}
+	
+	new_stack = StackCreate(inline_capacity, element_size);
+	if (NULL == new_stack)
+	{
+		return NULL;
+	}
+	
+	new_stack->is_small = 1;
 	
 	return new_stack;
 }
@@ -40,6 +68,10 @@ void StackDestroy(stack_t *stack)
 {
 	assert(stack);
 	
+	if (stack->elements != InlineBuffer(stack))
+	{
+		free(stack->elements);
+	}
 	free(stack);
 }
 
@@ -50,7 +82,8 @@ void StackPush(stack_t *stack, void *element)
 	assert(stack);	
 	assert(element);	
 	
-	if(stack->top == stack->capacity)
+	if(stack->top == stack->capacity && 
+	   (!stack->is_small || 0 != Spill(stack)))
 	{
 		printf("Can't push. Stack is full.\n");
 		return;
@@ -107,3 +140,37 @@ size_t StackSize(const stack_t *stack)
 	return stack->top;
 }
 
+/* doubles into a heap buffer, the inline one is left unused */
+static int Spill(stack_t *stack)
+{
+	size_t capacity = stack->capacity * GROWTH_FACTOR;
+	void *elements = NULL;
+	
+	if (stack->elements == InlineBuffer(stack))
+	{
+		elements = malloc(capacity * stack->element_size);
+		if (NULL == elements)
+		{
+			return 1;
+		}
+		memcpy(elements, stack->elements, stack->top * stack->element_size);
+	}
+	else
+	{
+		elements = realloc(stack->elements, capacity * stack->element_size);
+		if (NULL == elements)
+		{
+			return 1;
+		}
+	}
+	
+	stack->elements = elements;
+	stack->capacity = capacity;
+	
+	return 0;
+}
+
+static void *InlineBuffer(const stack_t *stack)
+{
+	return ((char *)stack + sizeof(stack_t));
+}
@@ -3,12 +3,17 @@ Owner: Uri Naor
 Date: Mar 3, 2024
 */
 
+#define _POSIX_C_SOURCE 200112L /* clock_gettime, clock_nanosleep */
+
 #include <assert.h> /* assert */
+#include <errno.h>  /* EINTR */
 #include <stdlib.h> /* malloc */
-#include <time.h>   /* time */
+#include <time.h>   /* clock_gettime */
 
 #include "task.h" /* task_t */
 
+#define NS_PER_SEC (1000000000UL)
+
 /******************** STRUCTS ********************/
 struct task
 {
@@ -18,7 +23,7 @@ struct task
 	void *action_params;
 	void *cleanup_params;
 	size_t interval;
-	time_t exec_time;
+	size_t exec_time; /* nanoseconds, see TaskTimeNow */
 };
 
 /******************** FUNCTIONS ********************/
@@ -42,7 +47,7 @@ void* action_params, task_clean_func_t cleanup , void *cleanup_params)
         return (NULL);
     }
 
-    task->exec_time = time(NULL) + (time_t)interval;
+    task->exec_time = TaskTimeNow() + interval;
     task->interval = interval;
     task->action = action;
     task->action_params = action_params;
@@ -96,7 +101,7 @@ int TaskIsSame(const task_t *task1, const task_t *task2)
     return (UIDIsEqual(task1->id, task2->id));
 }
 
-time_t TaskGetTimeToRun(const task_t *task)
+size_t TaskGetTimeToRun(const task_t *task)
 {
     assert(task);
 
@@ -107,5 +112,34 @@ void TaskUpdateTimeToRun(task_t *task)
 {
     assert(task);
 
-    task->exec_time = time(NULL) + (time_t)task->interval;
+    task->exec_time = TaskTimeNow() + task->interval;
+}
+
+size_t TaskTimeNow(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((size_t)now.tv_sec * NS_PER_SEC + (size_t)now.tv_nsec);
+}
+
+void TaskSleepUntil(size_t when)
+{
+    struct timespec deadline;
+
+    /* a due task does not pay for a system call */
+    if (TaskTimeNow() >= when)
+    {
+        return;
+    }
+
+    /* an absolute deadline does not drift, whatever woke us up */
+    deadline.tv_sec = (time_t)(when / NS_PER_SEC);
+    deadline.tv_nsec = (long)(when % NS_PER_SEC);
+
+    while (EINTR == clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline,
+                                                                        NULL))
+    {
+    }
 }
@@ -35,3 +35,9 @@ int UIDIsEqual(ilrd_uid_t one, ilrd_uid_t other)
 	return ((one.counter == other.counter) && (one.pid == other.pid) && 
 		   (one.time == other.time));
 }
+
+size_t UIDHash(ilrd_uid_t uid)
+{
+	/* the counter alone is unique within a process */
+	return (uid.counter ^ (size_t)uid.pid ^ (size_t)uid.time);
+}
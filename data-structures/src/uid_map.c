@@ -0,0 +1,198 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#include <assert.h> /* assert */
+#include <stdlib.h> /* malloc */
+
+#include "pool.h" /* pool_t */
+#include "uid_map.h" /* uid_map_t */
+
+#define MIN_BUCKETS (64)
+#define NODES_PER_SLAB (256)
+
+/******************** STRUCTS ********************/
+typedef struct node node_t;
+
+struct node
+{
+    node_t *next;
+    ilrd_uid_t uid;
+    void *value;
+};
+
+struct uid_map
+{
+    node_t **buckets;
+    size_t mask; /* number of buckets - 1, it is a power of two */
+    size_t size;
+    pool_t *pool;
+};
+
+/******************** FORWARD DECLARATIONS ********************/
+static node_t **Bucket(const uid_map_t *map, ilrd_uid_t uid);
+static node_t **FindLink(const uid_map_t *map, ilrd_uid_t uid);
+static void Grow(uid_map_t *map);
+
+/******************** FUNCTIONS ********************/
+uid_map_t *UIDMapCreate(void)
+{
+    uid_map_t *map = (uid_map_t *)malloc(sizeof(uid_map_t));
+    if (NULL == map)
+    {
+        return (NULL);
+    }
+
+    map->buckets = (node_t **)calloc(MIN_BUCKETS, sizeof(node_t *));
+    map->pool = PoolCreate(sizeof(node_t), NODES_PER_SLAB);
+    if (NULL == map->buckets || NULL == map->pool)
+    {
+        if (NULL != map->pool)
+        {
+            PoolDestroy(map->pool);
+        }
+        free(map->buckets);
+        free(map);
+
+        return (NULL);
+    }
+
+    map->mask = MIN_BUCKETS - 1;
+    map->size = 0;
+
+    return (map);
+}
+
+void UIDMapDestroy(uid_map_t *map)
+{
+    assert(map);
+
+    /* the nodes go away with the slabs of the pool */
+    PoolDestroy(map->pool);
+    free(map->buckets);
+    free(map);
+}
+
+int UIDMapInsert(uid_map_t *map, ilrd_uid_t uid, void *value)
+{
+    node_t **bucket = NULL;
+    node_t *node = NULL;
+
+    assert(map);
+    assert(NULL == UIDMapFind(map, uid));
+
+    node = (node_t *)PoolAlloc(map->pool);
+    if (NULL == node)
+    {
+        return (1);
+    }
+
+    if (map->size > map->mask)
+    {
+        Grow(map);
+    }
+
+    node->uid = uid;
+    node->value = value;
+
+    bucket = Bucket(map, uid);
+    node->next = *bucket;
+    *bucket = node;
+    ++map->size;
+
+    return (0);
+}
+
+void *UIDMapRemove(uid_map_t *map, ilrd_uid_t uid)
+{
+    node_t **link = NULL;
+    node_t *node = NULL;
+    void *value = NULL;
+
+    assert(map);
+
+    link = FindLink(map, uid);
+    if (NULL == *link)
+    {
+        return (NULL);
+    }
+
+    node = *link;
+    value = node->value;
+    *link = node->next;
+    PoolFree(map->pool, node);
+    --map->size;
+
+    return (value);
+}
+
+void *UIDMapFind(const uid_map_t *map, ilrd_uid_t uid)
+{
+    node_t *node = NULL;
+
+    assert(map);
+
+    node = *FindLink(map, uid);
+
+    return (NULL == node ? NULL : node->value);
+}
+
+size_t UIDMapSize(const uid_map_t *map)
+{
+    assert(map);
+
+    return (map->size);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static node_t **Bucket(const uid_map_t *map, ilrd_uid_t uid)
+{
+    return (&map->buckets[UIDHash(uid) & map->mask]);
+}
+
+/* the link that points at the node of uid, or the NULL ending its chain */
+static node_t **FindLink(const uid_map_t *map, ilrd_uid_t uid)
+{
+    node_t **link = Bucket(map, uid);
+
+    while (NULL != *link && !UIDIsEqual((*link)->uid, uid))
+    {
+        link = &(*link)->next;
+    }
+
+    return (link);
+}
+
+/* doubles the buckets, if that fails the chains just get longer */
+static void Grow(uid_map_t *map)
+{
+    size_t old_size = map->mask + 1;
+    size_t bucket = 0;
+    node_t **old_buckets = map->buckets;
+    node_t **new_bucket = NULL;
+    node_t *node = NULL;
+    node_t *next = NULL;
+    node_t **new_buckets = (node_t **)calloc(2 * old_size, sizeof(node_t *));
+
+    if (NULL == new_buckets)
+    {
+        return;
+    }
+
+    map->buckets = new_buckets;
+    map->mask = 2 * old_size - 1;
+
+    for (bucket = 0; bucket < old_size; ++bucket)
+    {
+        for (node = old_buckets[bucket]; NULL != node; node = next)
+        {
+            next = node->next;
+            new_bucket = Bucket(map, node->uid);
+            node->next = *new_bucket;
+            *new_bucket = node;
+        }
+    }
+
+    free(old_buckets);
+}
@@ -0,0 +1,55 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Benchmark Backend Loader
+
+Description:
+The benchmarks that compare implementations of one interface load each
+implementation from its own library with dlopen, since they all export the
+same names. BenchLibOpen opens a library, BenchLibSym fills in a function
+pointer from it and BenchLibClose closes it again.
+
+The including test defines _GNU_SOURCE (for RTLD_DEEPBIND) before its first
+#include and links with -ldl.
+*/
+
+#ifndef BENCH_LIB_H
+#define BENCH_LIB_H
+
+#include <stdio.h> /* printf */
+#include <dlfcn.h> /* dlopen */
+
+/* the libraries export the same names - DEEPBIND keeps every library */
+/* bound to its own symbols instead of the ones the test is linked with */
+static void *BenchLibOpen(const char *lib)
+{
+	void *handle = dlopen(lib, RTLD_NOW | RTLD_LOCAL | RTLD_DEEPBIND);
+
+	if (NULL == handle)
+	{
+		printf("%s is not built, skipped\n", lib);
+	}
+
+	return (handle);
+}
+
+/* func is the address of the function pointer to fill in. returns 1 and */
+/* sets it to NULL if the library has no such symbol, as optional ones  */
+static int BenchLibSym(void *handle, const char *name, void **func)
+{
+	/* ISO C has no cast from void * to a function pointer, POSIX way */
+	*func = dlsym(handle, name);
+
+	return (NULL == *func);
+}
+
+static void BenchLibClose(void *handle)
+{
+	if (NULL != handle)
+	{
+		dlclose(handle);
+	}
+}
+
+#endif /* BENCH_LIB_H */
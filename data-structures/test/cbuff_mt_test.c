@@ -0,0 +1,738 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Build: make TARGET=cbuff && make TARGET=cbuff_mt AF="-pthread -ldl"
+Run:   ./cbuff_mt.out        (tests, then benchmark)
+       ./cbuff_mt.out bench  (benchmark only)
+
+The benchmark compares both buffers with cbuff.c behind a mutex, the way
+it is shared between threads today, loaded from libcbuff.so with dlopen.
+A thread that finds its buffer full or empty yields, so the numbers stay
+meaningful on a machine with fewer cores than threads.
+*/
+
+#define _GNU_SOURCE /* RTLD_DEEPBIND, clock_gettime, sched_yield */
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* malloc */
+#include <string.h> /* strcmp */
+#include <pthread.h> /* pthread_create */
+#include <sched.h> /* sched_yield */
+#include <time.h> /* clock_gettime */
+
+#include "bench_lib.h" /* BenchLibOpen */
+#include "cbuff_mt.h" /* cbuff_spsc_t */
+
+#define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
+#define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
+
+#define STREAM_BYTES (1 << 24)
+#define MAX_CHUNK 100
+#define MPMC_THREADS 2 /* producers, and as many consumers */
+#define MPMC_ITEMS (1 << 18) /* per producer */
+#define BENCH_BYTES (1 << 26)
+#define BENCH_CHUNK 64
+#define BENCH_ITEMS (1 << 20) /* per producer */
+#define PING_PONGS 20000
+
+/******************** TYPEDEFS ********************/
+/* cbuff.h functions, cbuff_t is opaque here */
+typedef struct locked_cbuff
+{
+	void *handle;
+	void *buffer;
+	pthread_mutex_t lock;
+	void *(*create)(size_t capacity);
+	void (*destroy)(void *buffer);
+	long (*read)(void *buffer, void *dest, size_t count);
+	long (*write)(void *buffer, const void *src, size_t count);
+	size_t (*size)(const void *buffer);
+	size_t (*free_space)(const void *buffer);
+} locked_cbuff_t;
+
+typedef struct stream_args
+{
+	cbuff_spsc_t *spsc;
+	locked_cbuff_t *locked;
+	size_t bytes;
+	size_t chunk; /* 0 for random chunk sizes */
+	int status;
+} stream_args_t;
+
+typedef struct mpmc_args
+{
+	cbuff_mpmc_t *mpmc;
+	locked_cbuff_t *locked;
+	size_t id;
+	size_t items;
+	size_t *done; /* producers that finished */
+	unsigned char *seen; /* one flag per item, test only */
+	int status;
+} mpmc_args_t;
+
+typedef struct ping_args
+{
+	cbuff_spsc_t *spsc[2];
+	locked_cbuff_t *locked[2];
+	double *round_trips;
+} ping_args_t;
+
+/******************** FORWARD DECLARATIONS ********************/
+static int TestSPSCFlow(void);
+static int TestSPSCThreads(void);
+static int TestMPMCThreads(void);
+static void *StreamWriter(void *arg);
+static void *StreamReader(void *arg);
+static void *MPMCProducer(void *arg);
+static void *MPMCConsumer(void *arg);
+static void BenchThroughput(locked_cbuff_t *locked);
+static void BenchLatency(locked_cbuff_t *locked);
+static double RunStream(stream_args_t *args);
+static double RunMPMC(mpmc_args_t *proto);
+static void *Pinger(void *arg);
+static void *Ponger(void *arg);
+static int LoadLockedCBuff(locked_cbuff_t *locked);
+static long LockedWrite(locked_cbuff_t *locked, const void *src, size_t n);
+static long LockedRead(locked_cbuff_t *locked, void *dest, size_t n);
+static long LockedWriteAll(locked_cbuff_t *locked, const void *src, size_t n);
+static long LockedReadAll(locked_cbuff_t *locked, void *dest, size_t n);
+static unsigned char StreamByte(size_t i);
+static size_t NextRand(size_t *state);
+static double NowSec(void);
+static int CmpDouble(const void *a, const void *b);
+
+int main(int argc, char *argv[])
+{
+	locked_cbuff_t locked;
+	int status = 0;
+
+	if (argc < 2 || 0 != strcmp(argv[1], "bench"))
+	{
+		status = TestSPSCFlow();
+		printf("CBuff MT| TestSPSCFlow: %s\n", 0 == status ? PASS : FAIL);
+		if (0 == status)
+		{
+			status = TestSPSCThreads();
+			printf("CBuff MT| TestSPSCThreads: %s\n",
+											0 == status ? PASS : FAIL);
+		}
+		if (0 == status)
+		{
+			status = TestMPMCThreads();
+			printf("CBuff MT| TestMPMCThreads: %s\n",
+											0 == status ? PASS : FAIL);
+		}
+		if (0 != status)
+		{
+			printf("failed at check %d\n", status);
+			return (status);
+		}
+	}
+
+	LoadLockedCBuff(&locked);
+	BenchThroughput(&locked);
+	BenchLatency(&locked);
+
+	BenchLibClose(locked.handle);
+
+	return (0);
+}
+
+/******************** TEST FUNCTIONS ********************/
+/* the cbuff.c rules on one thread: partial writes, -1 when full or empty */
+static int TestSPSCFlow(void)
+{
+	cbuff_spsc_t *spsc = CBuffSPSCCreate(10);
+	char src[20] = "abcdefghijklmnopqrs";
+	char dest[20] = {0};
+	int status = 0;
+
+	if (NULL == spsc)
+	{
+		return (1);
+	}
+
+	if (16 != CBuffSPSCCapacity(spsc) || 0 != CBuffSPSCSize(spsc) ||
+		-1 != CBuffSPSCRead(spsc, dest, 1))
+	{
+		status = 2;
+	}
+	else if (16 != CBuffSPSCWrite(spsc, src, 20) ||
+			 -1 != CBuffSPSCWrite(spsc, src, 1) || 16 != CBuffSPSCSize(spsc))
+	{
+		status = 3;
+	}
+	/* the next write wraps around the end of the buffer */
+	else if (5 != CBuffSPSCRead(spsc, dest, 5) ||
+			 0 != memcmp(dest, "abcde", 5) ||
+			 5 != CBuffSPSCWrite(spsc, "vwxyz", 5))
+	{
+		status = 4;
+	}
+	else if (16 != CBuffSPSCRead(spsc, dest, 20) ||
+			 0 != memcmp(dest, "fghijklmnopvwxyz", 16) ||
+			 0 != CBuffSPSCSize(spsc))
+	{
+		status = 5;
+	}
+
+	CBuffSPSCDestroy(spsc);
+
+	return (status);
+}
+
+/* a known byte stream, written and read in random chunk sizes */
+static int TestSPSCThreads(void)
+{
+	stream_args_t args;
+
+	args.spsc = CBuffSPSCCreate(1000);
+	args.locked = NULL;
+	args.bytes = STREAM_BYTES;
+	args.chunk = 0;
+	args.status = 0;
+
+	if (NULL == args.spsc)
+	{
+		return (11);
+	}
+
+	RunStream(&args);
+	CBuffSPSCDestroy(args.spsc);
+
+	return (0 == args.status ? 0 : 12);
+}
+
+/* every item comes out exactly once, and a consumer gets the items of */
+/* each producer in the order they were pushed                        */
+static int TestMPMCThreads(void)
+{
+	mpmc_args_t proto;
+	size_t i = 0;
+	int status = 0;
+
+	proto.mpmc = CBuffMPMCCreate(64, sizeof(size_t));
+	proto.locked = NULL;
+	proto.items = MPMC_ITEMS;
+	proto.seen = (unsigned char *)calloc(MPMC_THREADS * MPMC_ITEMS, 1);
+	proto.status = 0;
+
+	if (NULL == proto.mpmc || NULL == proto.seen)
+	{
+		status = 21;
+	}
+	else if (64 != CBuffMPMCCapacity(proto.mpmc) ||
+			 0 != CBuffMPMCSize(proto.mpmc))
+	{
+		status = 22;
+	}
+	else
+	{
+		RunMPMC(&proto);
+		status = (0 != proto.status) ? 23 : 0;
+		for (i = 0; i < MPMC_THREADS * MPMC_ITEMS && 0 == status; ++i)
+		{
+			status = (1 != proto.seen[i]) ? 24 : 0;
+		}
+	}
+
+	if (NULL != proto.mpmc)
+	{
+		CBuffMPMCDestroy(proto.mpmc);
+	}
+	free(proto.seen);
+
+	return (status);
+}
+
+/******************** THREADS ********************/
+static void *StreamWriter(void *arg)
+{
+	stream_args_t *args = (stream_args_t *)arg;
+	unsigned char chunk[BENCH_CHUNK > MAX_CHUNK ? BENCH_CHUNK : MAX_CHUNK];
+	size_t seed = 1;
+	size_t sent = 0;
+	size_t n = 0;
+	size_t i = 0;
+	long written = 0;
+
+	while (sent < args->bytes)
+	{
+		n = (0 != args->chunk) ? args->chunk : 1 + NextRand(&seed) % MAX_CHUNK;
+		n = (n < args->bytes - sent) ? n : args->bytes - sent;
+		for (i = 0; i < n; ++i)
+		{
+			chunk[i] = StreamByte(sent + i);
+		}
+
+		/* a partial write leaves the rest for the next round */
+		written = (NULL != args->spsc) ? CBuffSPSCWrite(args->spsc, chunk, n) :
+										LockedWrite(args->locked, chunk, n);
+		if (written < 0)
+		{
+			sched_yield();
+			continue;
+		}
+		sent += (size_t)written;
+	}
+
+	return (NULL);
+}
+
+static void *StreamReader(void *arg)
+{
+	stream_args_t *args = (stream_args_t *)arg;
+	unsigned char chunk[BENCH_CHUNK > MAX_CHUNK ? BENCH_CHUNK : MAX_CHUNK];
+	size_t seed = 2;
+	size_t received = 0;
+	size_t n = 0;
+	long i = 0;
+	long read = 0;
+
+	while (received < args->bytes)
+	{
+		n = (0 != args->chunk) ? args->chunk : 1 + NextRand(&seed) % MAX_CHUNK;
+		read = (NULL != args->spsc) ? CBuffSPSCRead(args->spsc, chunk, n) :
+										LockedRead(args->locked, chunk, n);
+		if (read < 0)
+		{
+			sched_yield();
+			continue;
+		}
+
+		for (i = 0; i < read; ++i)
+		{
+			if (chunk[i] != StreamByte(received + (size_t)i))
+			{
+				args->status = 1;
+			}
+		}
+		received += (size_t)read;
+	}
+
+	return (NULL);
+}
+
+/* items are id << 32 | index, so a consumer can tell whose they are */
+static void *MPMCProducer(void *arg)
+{
+	mpmc_args_t *args = (mpmc_args_t *)arg;
+	size_t item = 0;
+	size_t i = 0;
+
+	for (i = 0; i < args->items; ++i)
+	{
+		item = (args->id << 32) | i;
+		while (0 != ((NULL != args->mpmc) ? CBuffMPMCPush(args->mpmc, &item) :
+					 (int)LockedWriteAll(args->locked, &item, sizeof(item))))
+		{
+			sched_yield();
+		}
+	}
+
+	__atomic_fetch_add(args->done, 1, __ATOMIC_RELEASE);
+
+	return (NULL);
+}
+
+static void *MPMCConsumer(void *arg)
+{
+	mpmc_args_t *args = (mpmc_args_t *)arg;
+	size_t last[MPMC_THREADS];
+	size_t item = 0;
+	size_t producer = 0;
+	size_t i = 0;
+	int got = 0;
+
+	for (i = 0; i < MPMC_THREADS; ++i)
+	{
+		last[i] = (size_t)-1;
+	}
+
+	for (;;)
+	{
+		got = (NULL != args->mpmc) ? CBuffMPMCPop(args->mpmc, &item) :
+					(int)LockedReadAll(args->locked, &item, sizeof(item));
+		if (0 != got)
+		{
+			/* done only once the producers are and nothing is left */
+			if (MPMC_THREADS == __atomic_load_n(args->done, __ATOMIC_ACQUIRE))
+			{
+				got = (NULL != args->mpmc) ? CBuffMPMCPop(args->mpmc, &item) :
+						(int)LockedReadAll(args->locked, &item, sizeof(item));
+				if (0 != got)
+				{
+					break;
+				}
+			}
+			else
+			{
+				sched_yield();
+				continue;
+			}
+		}
+
+		if (NULL != args->seen)
+		{
+			producer = item >> 32;
+			i = item & 0xFFFFFFFF;
+			if (producer >= MPMC_THREADS || i >= args->items ||
+				(last[producer] != (size_t)-1 && i <= last[producer]))
+			{
+				args->status = 1;
+				continue;
+			}
+			last[producer] = i;
+			__atomic_fetch_add(&args->seen[producer * args->items + i], 1,
+															__ATOMIC_RELAXED);
+		}
+	}
+
+	return (NULL);
+}
+
+static void *Pinger(void *arg)
+{
+	ping_args_t *args = (ping_args_t *)arg;
+	double start = 0;
+	size_t i = 0;
+
+	for (i = 0; i < PING_PONGS; ++i)
+	{
+		start = NowSec();
+		if (NULL != args->spsc[0])
+		{
+			while (0 > CBuffSPSCWrite(args->spsc[0], &start, sizeof(start)))
+			{
+				sched_yield();
+			}
+			while (0 > CBuffSPSCRead(args->spsc[1], &start, sizeof(start)))
+			{
+				sched_yield();
+			}
+		}
+		else
+		{
+			while (0 > LockedWriteAll(args->locked[0], &start, sizeof(start)))
+			{
+				sched_yield();
+			}
+			while (0 > LockedReadAll(args->locked[1], &start, sizeof(start)))
+			{
+				sched_yield();
+			}
+		}
+		args->round_trips[i] = (NowSec() - start) * 1e9;
+	}
+
+	return (NULL);
+}
+
+static void *Ponger(void *arg)
+{
+	ping_args_t *args = (ping_args_t *)arg;
+	double stamp = 0;
+	size_t i = 0;
+
+	for (i = 0; i < PING_PONGS; ++i)
+	{
+		if (NULL != args->spsc[0])
+		{
+			while (0 > CBuffSPSCRead(args->spsc[0], &stamp, sizeof(stamp)))
+			{
+				sched_yield();
+			}
+			while (0 > CBuffSPSCWrite(args->spsc[1], &stamp, sizeof(stamp)))
+			{
+				sched_yield();
+			}
+		}
+		else
+		{
+			while (0 > LockedReadAll(args->locked[0], &stamp, sizeof(stamp)))
+			{
+				sched_yield();
+			}
+			while (0 > LockedWriteAll(args->locked[1], &stamp, sizeof(stamp)))
+			{
+				sched_yield();
+			}
+		}
+	}
+
+	return (NULL);
+}
+
+/******************** BENCHMARK ********************/
+static void BenchThroughput(locked_cbuff_t *locked)
+{
+	stream_args_t stream;
+	mpmc_args_t proto;
+	double seconds = 0;
+
+	printf("\nthroughput, %d byte chunks through a 64KB buffer:\n",
+																BENCH_CHUNK);
+
+	stream.spsc = CBuffSPSCCreate(1 << 16);
+	stream.locked = NULL;
+	stream.bytes = BENCH_BYTES;
+	stream.chunk = BENCH_CHUNK;
+	stream.status = 0;
+	seconds = RunStream(&stream);
+	printf("%-22s %10.1f MB/s\n", "spsc", BENCH_BYTES / seconds / 1e6);
+	CBuffSPSCDestroy(stream.spsc);
+
+	if (NULL != locked->handle)
+	{
+		stream.spsc = NULL;
+		stream.locked = locked;
+		locked->buffer = locked->create(1 << 16);
+		seconds = RunStream(&stream);
+		printf("%-22s %10.1f MB/s\n", "cbuff + mutex",
+											BENCH_BYTES / seconds / 1e6);
+		locked->destroy(locked->buffer);
+	}
+
+	printf("\nthroughput, %d producers and %d consumers, 8 byte items:\n",
+												MPMC_THREADS, MPMC_THREADS);
+
+	proto.mpmc = CBuffMPMCCreate(1 << 13, sizeof(size_t));
+	proto.locked = NULL;
+	proto.items = BENCH_ITEMS;
+	proto.seen = NULL;
+	proto.status = 0;
+	seconds = RunMPMC(&proto);
+	printf("%-22s %10.1f M items/s\n", "mpmc",
+							MPMC_THREADS * BENCH_ITEMS / seconds / 1e6);
+	CBuffMPMCDestroy(proto.mpmc);
+
+	if (NULL != locked->handle)
+	{
+		proto.mpmc = NULL;
+		proto.locked = locked;
+		locked->buffer = locked->create((1 << 13) * sizeof(size_t));
+		seconds = RunMPMC(&proto);
+		printf("%-22s %10.1f M items/s\n", "cbuff + mutex",
+							MPMC_THREADS * BENCH_ITEMS / seconds / 1e6);
+		locked->destroy(locked->buffer);
+	}
+}
+
+/* round trips of a timestamp through a pair of buffers */
+static void BenchLatency(locked_cbuff_t *locked)
+{
+	ping_args_t args;
+	pthread_t threads[2];
+	size_t round = 0;
+
+	args.round_trips = (double *)malloc(PING_PONGS * sizeof(double));
+	if (NULL == args.round_trips)
+	{
+		return;
+	}
+
+	printf("\nround trip latency, ns:\n");
+	printf("%-22s %10s %10s %10s\n", "buffer", "p50", "p99", "max");
+
+	for (round = 0; round < 2; ++round)
+	{
+		if (1 == round && NULL == locked[0].handle)
+		{
+			break;
+		}
+
+		args.spsc[0] = (0 == round) ? CBuffSPSCCreate(1 << 12) : NULL;
+		args.spsc[1] = (0 == round) ? CBuffSPSCCreate(1 << 12) : NULL;
+		args.locked[0] = locked;
+		args.locked[1] = locked;
+		if (1 == round)
+		{
+			/* one mutex for both directions, as with a single shared lock */
+			locked->buffer = locked->create(1 << 12);
+			args.locked[1] = (locked_cbuff_t *)malloc(sizeof(locked_cbuff_t));
+			if (NULL == args.locked[1])
+			{
+				locked->destroy(locked->buffer);
+				break;
+			}
+			*args.locked[1] = *locked;
+			args.locked[1]->buffer = locked->create(1 << 12);
+		}
+
+		pthread_create(&threads[0], NULL, Pinger, &args);
+		pthread_create(&threads[1], NULL, Ponger, &args);
+		pthread_join(threads[0], NULL);
+		pthread_join(threads[1], NULL);
+
+		qsort(args.round_trips, PING_PONGS, sizeof(double), CmpDouble);
+		printf("%-22s %10.0f %10.0f %10.0f\n",
+			   (0 == round) ? "spsc" : "cbuff + mutex",
+			   args.round_trips[PING_PONGS / 2],
+			   args.round_trips[PING_PONGS * 99 / 100],
+			   args.round_trips[PING_PONGS - 1]);
+
+		if (0 == round)
+		{
+			CBuffSPSCDestroy(args.spsc[0]);
+			CBuffSPSCDestroy(args.spsc[1]);
+		}
+		else
+		{
+			locked->destroy(locked->buffer);
+			locked->destroy(args.locked[1]->buffer);
+			free(args.locked[1]);
+		}
+	}
+
+	free(args.round_trips);
+}
+
+static double RunStream(stream_args_t *args)
+{
+	pthread_t threads[2];
+	double start = NowSec();
+
+	pthread_create(&threads[0], NULL, StreamWriter, args);
+	pthread_create(&threads[1], NULL, StreamReader, args);
+	pthread_join(threads[0], NULL);
+	pthread_join(threads[1], NULL);
+
+	return (NowSec() - start);
+}
+
+static double RunMPMC(mpmc_args_t *proto)
+{
+	pthread_t threads[2 * MPMC_THREADS];
+	mpmc_args_t args[2 * MPMC_THREADS];
+	size_t done = 0;
+	double start = NowSec();
+	size_t i = 0;
+
+	for (i = 0; i < 2 * MPMC_THREADS; ++i)
+	{
+		args[i] = *proto;
+		args[i].id = i % MPMC_THREADS;
+		args[i].done = &done;
+		pthread_create(&threads[i], NULL,
+				(i < MPMC_THREADS) ? MPMCProducer : MPMCConsumer, &args[i]);
+	}
+
+	for (i = 0; i < 2 * MPMC_THREADS; ++i)
+	{
+		pthread_join(threads[i], NULL);
+		proto->status |= args[i].status;
+	}
+
+	return (NowSec() - start);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static int LoadLockedCBuff(locked_cbuff_t *locked)
+{
+	void *lib = BenchLibOpen("./libcbuff.so");
+
+	if (NULL == lib ||
+		0 != BenchLibSym(lib, "CBuffCreate", (void **)&locked->create) ||
+		0 != BenchLibSym(lib, "CBuffDestroy", (void **)&locked->destroy) ||
+		0 != BenchLibSym(lib, "CBuffRead", (void **)&locked->read) ||
+		0 != BenchLibSym(lib, "CBuffWrite", (void **)&locked->write) ||
+		0 != BenchLibSym(lib, "CBuffSize", (void **)&locked->size) ||
+		0 != BenchLibSym(lib, "CBuffFreeSpace", (void **)&locked->free_space))
+	{
+		if (NULL != lib)
+		{
+			printf("./libcbuff.so is incomplete, cbuff + mutex skipped\n");
+		}
+		BenchLibClose(lib);
+		locked->handle = NULL;
+		return (1);
+	}
+
+	locked->handle = lib;
+	pthread_mutex_init(&locked->lock, NULL);
+
+	return (0);
+}
+
+static long LockedWrite(locked_cbuff_t *locked, const void *src, size_t n)
+{
+	long written = 0;
+
+	pthread_mutex_lock(&locked->lock);
+	written = locked->write(locked->buffer, src, n);
+	pthread_mutex_unlock(&locked->lock);
+
+	return (written);
+}
+
+static long LockedRead(locked_cbuff_t *locked, void *dest, size_t n)
+{
+	long read = 0;
+
+	pthread_mutex_lock(&locked->lock);
+	read = locked->read(locked->buffer, dest, n);
+	pthread_mutex_unlock(&locked->lock);
+
+	return (read);
+}
+
+/* whole items only - with several writers a partial one would interleave */
+static long LockedWriteAll(locked_cbuff_t *locked, const void *src, size_t n)
+{
+	long status = -1;
+
+	pthread_mutex_lock(&locked->lock);
+	if (locked->free_space(locked->buffer) >= n)
+	{
+		locked->write(locked->buffer, src, n);
+		status = 0;
+	}
+	pthread_mutex_unlock(&locked->lock);
+
+	return (status);
+}
+
+static long LockedReadAll(locked_cbuff_t *locked, void *dest, size_t n)
+{
+	long status = -1;
+
+	pthread_mutex_lock(&locked->lock);
+	if (locked->size(locked->buffer) >= n)
+	{
+		locked->read(locked->buffer, dest, n);
+		status = 0;
+	}
+	pthread_mutex_unlock(&locked->lock);
+
+	return (status);
+}
+
+static unsigned char StreamByte(size_t i)
+{
+	return ((unsigned char)(i * 131 + (i >> 8)));
+}
+
+static size_t NextRand(size_t *state)
+{
+	*state = *state * 6364136223846793005UL + 1442695040888963407UL;
+
+	return (*state >> 33);
+}
+
+static double NowSec(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return ((double)now.tv_sec + (double)now.tv_nsec / 1e9);
+}
+
+static int CmpDouble(const void *a, const void *b)
+{
+	double lhs = *(const double *)a;
+	double rhs = *(const double *)b;
+
+	return ((lhs > rhs) - (lhs < rhs));
+}
@@ -3,14 +3,30 @@ Owner: Uri Naor
 Date: Feb 19, 2024
 */
 
+#define _POSIX_C_SOURCE 200112L /* pipe */
+
 #define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
 #define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
 
 #include <stdio.h> /* printf */
 #include <string.h> /* strcmp */
+#include <unistd.h> /* pipe */
+#include <time.h> /* clock_gettime */
 
 #include "cbuff.h" /*  CBuffCreate */
 
+#define SHIP_BYTES (1 << 26)
+#define RECORD_SIZE 100 /* a log line, does not divide the ring */
+#define RING_SIZE (1 << 16)
+#define SHIP_CHUNK 10000 /* does not divide it either */
+
+static ssize_t FillFromPipe(cbuff_t *buffer, const char *msg, size_t len);
+static void BenchShipping(void);
+static double Ship(cbuff_t *buffer, int use_writev, size_t *syscalls);
+static ssize_t ShipBySpans(cbuff_t *buffer, int fd, size_t count, 
+						   size_t *syscalls);
+static double NowSec(void);
+
 int main()
 {
 	cbuff_t *new_buff = CBuffCreate(20);
@@ -20,6 +36,13 @@ int main()
 	char dest3[] = "hello-amigo-shalom-bonjour";
 	ssize_t written = 0;
 	ssize_t read = 0;
+	cbuff_t *span_buff = CBuffCreate(8);
+	cbuff_span_t spans[2];
+	char dest4[16] = {0};
+	cbuff_t *mirror_buff = CBuffCreateMirrored(100);
+	char page[5000];
+	int fds[2];
+	size_t found = 0;
 	
 	printf("Testing Create & Empty List Case:\n");
 	printf("Testing IsEmpty - empty list case, should be 1: %s\n" , CBuffIsEmpty(new_buff) == 1 ? PASS : FAIL);
@@ -87,8 +110,239 @@ int main()
 	printf("Testing Size - after reading case, should be 0: %s\n" , CBuffSize(new_buff) == 0 ? PASS : FAIL);
 	printf("Testing FreeSpace - after reading case, should be 20: %s\n" , CBuffFreeSpace(new_buff) == 20 ? PASS : FAIL);
 	
+	printf("\nTesting Read & Write of 0 Elements in a list of 3\n");
+	CBuffWrite(new_buff, src, 3);
+	read = CBuffRead(new_buff, dest3, 0);
+	printf("Testing Read, - 0 element case, should be 0: %s\n" , read == 0 ? PASS : FAIL);
+	written = CBuffWrite(new_buff, src, 0);
+	printf("Testing Written, - 0 element case, should be 0: %s\n" , written == 0 ? PASS : FAIL);
+	printf("Testing Size - after 0 element case, should be 3: %s\n" , CBuffSize(new_buff) == 3 ? PASS : FAIL);
+	CBuffRead(new_buff, dest3, 3);
+	
+	printf("\nTesting Spans - write in place across the end of the buffer\n");
+	CBuffWrite(span_buff, src, 6);
+	CBuffRead(span_buff, dest4, 5);
+	found = CBuffWriteReserve(span_buff, 10, spans);
+	printf("Testing WriteReserve - 1 of 8 used, should be 7 in 2 spans of 2 and 5: %s\n" , 
+	found == 7 && spans[0].size == 2 && spans[1].size == 5 ? PASS : FAIL);
+	memcpy(spans[0].data, "gh", 2);
+	memcpy(spans[1].data, "ij", 2);
+	CBuffWriteCommit(span_buff, 4);
+	printf("Testing Size - after committing 4 of 7, should be 5: %s\n" , CBuffSize(span_buff) == 5 ? PASS : FAIL);
+	
+	printf("\nTesting Spans - read in place across the end of the buffer\n");
+	found = CBuffReadPeek(span_buff, 10, spans);
+	printf("Testing ReadPeek - should be fgh and ij: %s\n" , 
+	found == 5 && spans[0].size == 3 && 0 == memcmp(spans[0].data, "fgh", 3) && 
+	spans[1].size == 2 && 0 == memcmp(spans[1].data, "ij", 2) ? PASS : FAIL);
+	printf("Testing Size - peeking does not read, should be 5: %s\n" , CBuffSize(span_buff) == 5 ? PASS : FAIL);
+	CBuffReadConsume(span_buff, 3);
+	found = CBuffReadPeek(span_buff, 10, spans);
+	printf("Testing ReadConsume - 3 consumed, should be ij in 1 span: %s\n" , 
+	found == 2 && spans[1].size == 0 && 0 == memcmp(spans[0].data, "ij", 2) ? PASS : FAIL);
+	
+	printf("\nTesting Spans - full and empty buffer\n");
+	CBuffWrite(span_buff, src, 6);
+	printf("Testing WriteReserve - full buffer, should be 0: %s\n" , CBuffWriteReserve(span_buff, 1, spans) == 0 ? PASS : FAIL);
+	CBuffReadConsume(span_buff, 8);
+	printf("Testing ReadPeek - empty buffer, should be 0: %s\n" , CBuffReadPeek(span_buff, 1, spans) == 0 ? PASS : FAIL);
+	
+	printf("\nTesting Spans - read(2) from a pipe straight into the buffer\n");
+	memset(dest4, 0, sizeof(dest4));
+	if (5 == FillFromPipe(span_buff, "hello", 5))
+	{
+		CBuffRead(span_buff, dest4, sizeof(dest4));
+	}
+	printf("Testing WriteCommit - after read(2), should be hello: %s\n" , strcmp(dest4, "hello") == 0 ? PASS : FAIL);
+	
+	printf("\nTesting Mirrored - a page sized ring that never splits\n");
+	printf("Testing CreateMirrored - 100 rounded up to a page, should be 4096: %s\n" , 
+	NULL != mirror_buff && CBuffFreeSpace(mirror_buff) == 4096 ? PASS : FAIL);
+	memset(page, 'x', sizeof(page));
+	CBuffWrite(mirror_buff, page, 4000);
+	CBuffRead(mirror_buff, page, 4000);
+	memcpy(page, "wraps around the end", 20);
+	CBuffWrite(mirror_buff, page, 1000);
+	found = CBuffReadPeek(mirror_buff, 1000, spans);
+	printf("Testing ReadPeek - past the end, should be 1 span of 1000: %s\n" , 
+	found == 1000 && spans[0].size == 1000 && spans[1].size == 0 ? PASS : FAIL);
+	printf("Testing ReadPeek - should read the same bytes as Read: %s\n" , 
+	0 == memcmp(spans[0].data, "wraps around the end", 20) ? PASS : FAIL);
+	found = CBuffWriteReserve(mirror_buff, 5000, spans);
+	printf("Testing WriteReserve - should be 1 span of 3096: %s\n" , 
+	found == 3096 && spans[0].size == 3096 && spans[1].size == 0 ? PASS : FAIL);
+	
+	printf("\nTesting Readv & Writev - through a pipe, across the end\n");
+	if (0 == pipe(fds))
+	{
+		printf("Testing Writev - 1000 bytes, should be 1000: %s\n" , 
+		CBuffWritev(mirror_buff, fds[1], 1000) == 1000 ? PASS : FAIL);
+		printf("Testing Writev - empty buffer, should be 0, no syscall: %s\n" , 
+		CBuffWritev(mirror_buff, -1, 1) == 0 ? PASS : FAIL);
+		printf("Testing Writev - bad fd, should be Error -1: %s\n" , 
+		CBuffWrite(mirror_buff, "x", 1) == 1 && 
+		CBuffWritev(mirror_buff, -1, 1) == -1 && 
+		CBuffRead(mirror_buff, dest4, 1) == 1 ? PASS : FAIL);
+		printf("Testing Readv - 1000 bytes, should be 1000: %s\n" , 
+		CBuffReadv(span_buff, fds[0], 8) == 8 && 
+		CBuffReadv(mirror_buff, fds[0], 4096) == 992 ? PASS : FAIL);
+		CBuffRead(span_buff, dest4, 8);
+		CBuffRead(mirror_buff, page, 992);
+		printf("Testing Readv - plain and mirrored, should be the same bytes: %s\n" , 
+		0 == memcmp(dest4, "wraps ar", 8) && 0 == memcmp(page, "ound the end", 12) ? PASS : FAIL);
+		close(fds[0]);
+		close(fds[1]);
+	}
+	
+	CBuffDestroy(mirror_buff);
+	CBuffDestroy(span_buff);
 	CBuffDestroy(new_buff);
+	
+	BenchShipping();
 
 	return 0;
 }
 
+/* the bytes go from the pipe to the buffer without a copy in between */
+static ssize_t FillFromPipe(cbuff_t *buffer, const char *msg, size_t len)
+{
+	cbuff_span_t spans[2];
+	ssize_t received = -1;
+	int fds[2];
+	
+	if (0 != pipe(fds))
+	{
+		return (-1);
+	}
+	
+	if ((ssize_t)len == write(fds[1], msg, len) && 
+		0 != CBuffWriteReserve(buffer, len, spans))
+	{
+		received = read(fds[0], spans[0].data, spans[0].size);
+		if (0 < received)
+		{
+			CBuffWriteCommit(buffer, received);
+		}
+	}
+	
+	close(fds[0]);
+	close(fds[1]);
+	
+	return (received);
+}
+
+
+/* log records through a pipe, the ring shipped in pieces of SHIP_CHUNK */
+static void BenchShipping(void)
+{
+	cbuff_t *buffer = NULL;
+	size_t syscalls = 0;
+	double seconds = 0;
+	
+	printf("\nshipping %d MB of %d byte records through a pipe:\n", 
+		   SHIP_BYTES >> 20, RECORD_SIZE);
+	printf("%-28s %12s %10s\n", "ring, writer", "writes", "MB/s");
+	
+	buffer = CBuffCreate(RING_SIZE);
+	seconds = Ship(buffer, 0, &syscalls);
+	printf("%-28s %12lu %10.0f\n", "plain, write(2) per span", 
+		   (unsigned long)syscalls, SHIP_BYTES / seconds / 1e6);
+	CBuffDestroy(buffer);
+	
+	buffer = CBuffCreate(RING_SIZE);
+	seconds = Ship(buffer, 1, &syscalls);
+	printf("%-28s %12lu %10.0f\n", "plain, CBuffWritev", 
+		   (unsigned long)syscalls, SHIP_BYTES / seconds / 1e6);
+	CBuffDestroy(buffer);
+	
+	buffer = CBuffCreateMirrored(RING_SIZE);
+	if (NULL == buffer)
+	{
+		return;
+	}
+	seconds = Ship(buffer, 1, &syscalls);
+	printf("%-28s %12lu %10.0f\n", "mirrored, CBuffWritev", 
+		   (unsigned long)syscalls, SHIP_BYTES / seconds / 1e6);
+	CBuffDestroy(buffer);
+}
+
+static double Ship(cbuff_t *buffer, int use_writev, size_t *syscalls)
+{
+	char record[RECORD_SIZE];
+	char sink[SHIP_CHUNK];
+	size_t shipped = 0;
+	double start = 0;
+	ssize_t sent = 0;
+	int fds[2];
+	
+	*syscalls = 0;
+	memset(record, 'r', sizeof(record));
+	if (0 != pipe(fds))
+	{
+		return (1);
+	}
+	
+	start = NowSec();
+	while (shipped < SHIP_BYTES)
+	{
+		while (CBuffFreeSpace(buffer) >= RECORD_SIZE)
+		{
+			CBuffWrite(buffer, record, RECORD_SIZE);
+		}
+		
+		/* the pipe holds a chunk, the reader drains it right away */
+		if (use_writev)
+		{
+			sent = CBuffWritev(buffer, fds[1], SHIP_CHUNK);
+			++*syscalls;
+		}
+		else
+		{
+			sent = ShipBySpans(buffer, fds[1], SHIP_CHUNK, syscalls);
+		}
+		if (0 >= sent || sent != read(fds[0], sink, sent))
+		{
+			break;
+		}
+		shipped += sent;
+	}
+	
+	close(fds[0]);
+	close(fds[1]);
+	
+	return (NowSec() - start);
+}
+
+/* how a caller ships the two spans without writev: one write(2) each */
+static ssize_t ShipBySpans(cbuff_t *buffer, int fd, size_t count, 
+						   size_t *syscalls)
+{
+	cbuff_span_t spans[2];
+	ssize_t sent = 0;
+	ssize_t total = 0;
+	size_t i = 0;
+	
+	CBuffReadPeek(buffer, count, spans);
+	for (i = 0; i < 2 && 0 != spans[i].size; ++i)
+	{
+		sent = write(fd, spans[i].data, spans[i].size);
+		++*syscalls;
+		if (0 >= sent)
+		{
+			break;
+		}
+		total += sent;
+	}
+	CBuffReadConsume(buffer, total);
+	
+	return (total);
+}
+
+static double NowSec(void)
+{
+	struct timespec now;
+	
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	
+	return ((double)now.tv_sec + (double)now.tv_nsec / 1e9);
+}
@@ -0,0 +1,437 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Build: make TARGET=chash AF=-pthread
+Run:   ./chash.out [max_threads]
+*/
+
+#define _POSIX_C_SOURCE 200112L /* clock_gettime, sysconf */
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* malloc */
+#include <pthread.h> /* pthread_create */
+#include <time.h> /* clock_gettime */
+#include <unistd.h> /* sysconf */
+
+#include "chash.h" /* chash_t */
+#include "hash.h" /* hash_t */
+
+#define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
+#define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
+
+#define STRESS_THREADS 4
+#define STRESS_KEYS (1 << 14)
+#define BENCH_KEYS (1 << 16)
+#define BENCH_OPS 200000 /* operations per thread */
+#define MAX_THREADS 64
+
+/******************** TYPEDEFS ********************/
+typedef struct stress_args
+{
+    chash_t *hash;
+    size_t *keys;
+    size_t id;
+    int status;
+} stress_args_t;
+
+typedef struct bench_args
+{
+    chash_t *chash;
+    hash_t *hash;
+    pthread_mutex_t *lock;
+    size_t *keys;
+    size_t id;
+    size_t num_threads;
+    size_t read_percent;
+} bench_args_t;
+
+/******************** FORWARD DECLARATIONS ********************/
+static int TestFlow(void);
+static int TestConcurrent(void);
+static void *StressThread(void *arg);
+static void BenchScaling(size_t max_threads);
+static double RunBench(bench_args_t *proto, size_t num_threads,
+                                                    void *(*thread)(void *));
+static void *BenchCHashThread(void *arg);
+static void *BenchLockedHashThread(void *arg);
+static size_t NextRand(size_t *state);
+static double NowSec(void);
+static size_t HashFunc(const void *value);
+static int CmpFunc(const void *a, const void *b);
+
+int main(int argc, char *argv[])
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t max_threads = (argc > 1) ? (size_t)atol(argv[1]) :
+                                                (size_t)(cpus > 0 ? cpus : 1);
+    int status = TestFlow();
+
+    printf("CHash| TestFlow: %s\n", 0 == status ? PASS : FAIL);
+    if (0 != status)
+    {
+        printf("failed at check %d\n", status);
+        return (status);
+    }
+
+    status = TestConcurrent();
+    printf("CHash| TestConcurrent: %s\n", 0 == status ? PASS : FAIL);
+    if (0 != status)
+    {
+        printf("failed at check %d\n", status);
+        return (status);
+    }
+
+    BenchScaling(max_threads < MAX_THREADS ? max_threads : MAX_THREADS);
+
+    return (0);
+}
+
+/******************** TEST FUNCTIONS ********************/
+static int TestFlow(void)
+{
+    size_t values[] = {1, 2, 3, 17, 33, 49};
+    size_t n = sizeof(values) / sizeof(values[0]);
+    size_t missing = 100;
+    size_t i = 0;
+    chash_t *hash = CHashCreate(HashFunc, CmpFunc, 16, 4);
+
+    if (NULL == hash)
+    {
+        return (1);
+    }
+
+    if (!CHashIsEmpty(hash))
+    {
+        CHashDestroy(hash);
+        return (2);
+    }
+
+    for (i = 0; i < n; ++i)
+    {
+        CHashInsert(hash, &values[i]);
+    }
+
+    for (i = 0; i < n; ++i)
+    {
+        if (&values[i] != CHashFind(hash, &values[i]))
+        {
+            CHashDestroy(hash);
+            return (3);
+        }
+    }
+
+    if (NULL != CHashFind(hash, &missing) || n != CHashSize(hash))
+    {
+        CHashDestroy(hash);
+        return (4);
+    }
+
+    CHashRemove(hash, &values[3]);
+    CHashRemove(hash, &missing);
+    if (n - 1 != CHashSize(hash) || NULL != CHashFind(hash, &values[3]) ||
+        &values[4] != CHashFind(hash, &values[4]))
+    {
+        CHashDestroy(hash);
+        return (5);
+    }
+
+    CHashDestroy(hash);
+
+    return (0);
+}
+
+/* every thread owns the keys with key % STRESS_THREADS == id and checks */
+/* them while the other threads insert, remove and look up their own     */
+static int TestConcurrent(void)
+{
+    pthread_t threads[STRESS_THREADS];
+    stress_args_t args[STRESS_THREADS];
+    size_t *keys = (size_t *)malloc(STRESS_KEYS * sizeof(size_t));
+    chash_t *hash = CHashCreate(HashFunc, CmpFunc, 1024, 16);
+    size_t i = 0;
+    int status = 0;
+
+    if (NULL == keys || NULL == hash)
+    {
+        free(keys);
+        return (1);
+    }
+
+    for (i = 0; i < STRESS_KEYS; ++i)
+    {
+        keys[i] = i;
+    }
+
+    for (i = 0; i < STRESS_THREADS; ++i)
+    {
+        args[i].hash = hash;
+        args[i].keys = keys;
+        args[i].id = i;
+        args[i].status = 0;
+        pthread_create(&threads[i], NULL, StressThread, &args[i]);
+    }
+
+    for (i = 0; i < STRESS_THREADS; ++i)
+    {
+        pthread_join(threads[i], NULL);
+        status = (0 != args[i].status) ? args[i].status : status;
+    }
+
+    if (0 == status && STRESS_KEYS / 2 != CHashSize(hash))
+    {
+        status = 10;
+    }
+
+    CHashDestroy(hash);
+    free(keys);
+
+    return (status);
+}
+
+static void *StressThread(void *arg)
+{
+    stress_args_t *args = (stress_args_t *)arg;
+    size_t seed = args->id + 1;
+    size_t i = 0;
+    size_t other = 0;
+    void *found = NULL;
+
+    for (i = args->id; i < STRESS_KEYS; i += STRESS_THREADS)
+    {
+        CHashInsert(args->hash, &args->keys[i]);
+    }
+
+    for (i = args->id; i < STRESS_KEYS; i += STRESS_THREADS)
+    {
+        if (&args->keys[i] != CHashFind(args->hash, &args->keys[i]))
+        {
+            args->status = 2;
+        }
+
+        if (0 == (i / STRESS_THREADS) % 2)
+        {
+            CHashRemove(args->hash, &args->keys[i]);
+        }
+
+        /* keys of other threads come and go, but are never a wrong match */
+        other = NextRand(&seed) % STRESS_KEYS;
+        found = CHashFind(args->hash, &args->keys[other]);
+        if (NULL != found && &args->keys[other] != found)
+        {
+            args->status = 3;
+        }
+    }
+
+    for (i = args->id; i < STRESS_KEYS; i += STRESS_THREADS)
+    {
+        found = CHashFind(args->hash, &args->keys[i]);
+        if ((0 == (i / STRESS_THREADS) % 2) != (NULL == found))
+        {
+            args->status = 4;
+        }
+    }
+
+    return (NULL);
+}
+
+/******************** BENCHMARK ********************/
+static void BenchScaling(size_t max_threads)
+{
+    size_t read_percents[] = {50, 90, 99};
+    size_t *keys = (size_t *)malloc(BENCH_KEYS * sizeof(size_t));
+    pthread_mutex_t lock;
+    bench_args_t proto;
+    size_t r = 0;
+    size_t threads = 0;
+    size_t i = 0;
+    double chash_mops = 0;
+    double locked_mops = 0;
+
+    if (NULL == keys)
+    {
+        return;
+    }
+
+    for (i = 0; i < BENCH_KEYS; ++i)
+    {
+        keys[i] = i;
+    }
+
+    pthread_mutex_init(&lock, NULL);
+    proto.keys = keys;
+    proto.lock = &lock;
+
+    printf("\nthroughput benchmark, %d keys, %d ops per thread, Mops/s:\n",
+                                                        BENCH_KEYS, BENCH_OPS);
+    printf("%-7s %-8s %14s %18s\n", "reads", "threads", "chash",
+                                                        "mutex + hash_t");
+
+    for (r = 0; r < sizeof(read_percents) / sizeof(read_percents[0]); ++r)
+    {
+        for (threads = 1; threads <= max_threads; threads *= 2)
+        {
+            proto.read_percent = read_percents[r];
+
+            /* both tables start half full, writers keep them that way */
+            proto.chash = CHashCreate(HashFunc, CmpFunc, BENCH_KEYS, 256);
+            proto.hash = HashCreate(HashFunc, CmpFunc, BENCH_KEYS);
+            for (i = 0; i < BENCH_KEYS; i += 2)
+            {
+                CHashInsert(proto.chash, &keys[i]);
+                HashInsert(proto.hash, &keys[i]);
+            }
+
+            chash_mops = RunBench(&proto, threads, BenchCHashThread);
+            locked_mops = RunBench(&proto, threads, BenchLockedHashThread);
+
+            printf("%5lu%%  %-8lu %14.2f %18.2f\n",
+                (unsigned long)read_percents[r], (unsigned long)threads,
+                                                    chash_mops, locked_mops);
+
+            CHashDestroy(proto.chash);
+            HashDestroy(proto.hash);
+        }
+    }
+
+    pthread_mutex_destroy(&lock);
+    free(keys);
+}
+
+static double RunBench(bench_args_t *proto, size_t num_threads,
+                                                    void *(*thread)(void *))
+{
+    pthread_t threads[MAX_THREADS];
+    bench_args_t args[MAX_THREADS];
+    double start = 0;
+    size_t i = 0;
+
+    start = NowSec();
+
+    for (i = 0; i < num_threads; ++i)
+    {
+        args[i] = *proto;
+        args[i].id = i;
+        args[i].num_threads = num_threads;
+        pthread_create(&threads[i], NULL, thread, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; ++i)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    return ((double)BENCH_OPS * num_threads / (NowSec() - start) / 1e6);
+}
+
+/* a write toggles a key owned by this thread, so writers never race */
+static void *BenchCHashThread(void *arg)
+{
+    bench_args_t *args = (bench_args_t *)arg;
+    size_t seed = args->id * 7919 + 1;
+    size_t key = 0;
+    size_t op = 0;
+
+    for (op = 0; op < BENCH_OPS; ++op)
+    {
+        key = NextRand(&seed) % BENCH_KEYS;
+
+        if (NextRand(&seed) % 100 < args->read_percent)
+        {
+            CHashFind(args->chash, &args->keys[key]);
+        }
+        else
+        {
+            key -= key % args->num_threads;
+            key += args->id;
+            key %= BENCH_KEYS;
+
+            if (NULL == CHashFind(args->chash, &args->keys[key]))
+            {
+                CHashInsert(args->chash, &args->keys[key]);
+            }
+            else
+            {
+                CHashRemove(args->chash, &args->keys[key]);
+            }
+        }
+    }
+
+    return (NULL);
+}
+
+static void *BenchLockedHashThread(void *arg)
+{
+    bench_args_t *args = (bench_args_t *)arg;
+    size_t seed = args->id * 7919 + 1;
+    size_t key = 0;
+    size_t op = 0;
+
+    for (op = 0; op < BENCH_OPS; ++op)
+    {
+        key = NextRand(&seed) % BENCH_KEYS;
+
+        pthread_mutex_lock(args->lock);
+        if (NextRand(&seed) % 100 < args->read_percent)
+        {
+            HashFind(args->hash, &args->keys[key]);
+        }
+        else
+        {
+            key -= key % args->num_threads;
+            key += args->id;
+            key %= BENCH_KEYS;
+
+            if (NULL == HashFind(args->hash, &args->keys[key]))
+            {
+                HashInsert(args->hash, &args->keys[key]);
+            }
+            else
+            {
+                HashRemove(args->hash, &args->keys[key]);
+            }
+        }
+        pthread_mutex_unlock(args->lock);
+    }
+
+    return (NULL);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static size_t NextRand(size_t *state)
+{
+    /* xorshift, rand() would serialize the threads on its own lock */
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+
+    return (*state);
+}
+
+static double NowSec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (now.tv_sec + now.tv_nsec / 1e9);
+}
+
+static size_t HashFunc(const void *value)
+{
+    size_t key = *(const size_t *)value;
+
+    key ^= key >> 16;
+    key *= 0x45D9F3BUL;
+    key ^= key >> 16;
+
+    return (key);
+}
+
+static int CmpFunc(const void *a, const void *b)
+{
+    size_t lhs = *(const size_t *)a;
+    size_t rhs = *(const size_t *)b;
+
+    return ((lhs > rhs) - (lhs < rhs));
+}
@@ -0,0 +1,289 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Run: ./dheap.out [max_elements]   (default 100K, a few seconds. Pass
+     10000000 or 100000000 for the full benchmark, which takes minutes)
+*/
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* malloc */
+#include <time.h> /* clock */
+
+#include "dheap.h" /* dheap_t */
+#include "heap.h" /* heap_t */
+
+#define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
+#define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
+
+#define TEST_SIZE 5000
+#define BENCH_MIN 1000
+#define BENCH_MAX 100000
+#define BENCH_OPS 10000000 /* small heaps repeat until about this many ops, */
+                           /* or max_elements ops if that is smaller        */
+
+/******************** FORWARD DECLARATIONS ********************/
+static int TestFlow(size_t arity);
+static int TestRemove(size_t arity);
+static void BenchSizes(size_t max_size);
+static void BenchHeap(size_t *keys, size_t n, size_t reps, double result[2]);
+static void BenchDHeap(size_t *keys, size_t n, size_t reps, size_t arity,
+                                                            double result[2]);
+static int CmpFunc(const void *a, const void *b);
+static int MatchFunc(const void *data, const void *params);
+
+int main(int argc, char *argv[])
+{
+    size_t arities[] = {2, 3, 4, 8};
+    size_t max_size = (argc > 1) ? (size_t)atol(argv[1]) : BENCH_MAX;
+    size_t i = 0;
+    int status = 0;
+
+    for (i = 0; i < sizeof(arities) / sizeof(arities[0]); ++i)
+    {
+        status = TestFlow(arities[i]);
+        printf("DHeap| TestFlow %lu-ary: %s\n", (unsigned long)arities[i],
+                                                0 == status ? PASS : FAIL);
+        if (0 != status)
+        {
+            printf("failed at check %d\n", status);
+            return (status);
+        }
+
+        status = TestRemove(arities[i]);
+        printf("DHeap| TestRemove %lu-ary: %s\n", (unsigned long)arities[i],
+                                                0 == status ? PASS : FAIL);
+        if (0 != status)
+        {
+            printf("failed at check %d\n", status);
+            return (status);
+        }
+    }
+
+    BenchSizes(max_size);
+
+    return (0);
+}
+
+/******************** TEST FUNCTIONS ********************/
+static int TestFlow(size_t arity)
+{
+    size_t *keys = (size_t *)malloc(TEST_SIZE * sizeof(size_t));
+    dheap_t *heap = DHeapCreate(CmpFunc, arity);
+    size_t prev = 0;
+    size_t i = 0;
+    int status = 0;
+
+    if (NULL == keys || NULL == heap)
+    {
+        free(keys);
+        return (1);
+    }
+
+    if (!DHeapIsEmpty(heap) || NULL != DHeapPeek(heap))
+    {
+        status = 2;
+    }
+
+    for (i = 0; i < TEST_SIZE && 0 == status; ++i)
+    {
+        keys[i] = (size_t)rand() % 1000;
+        if (SUCCESS != DHeapPush(heap, &keys[i]))
+        {
+            status = 3;
+        }
+    }
+
+    if (0 == status && TEST_SIZE != DHeapSize(heap))
+    {
+        status = 4;
+    }
+
+    for (i = 0; i < TEST_SIZE && 0 == status; ++i)
+    {
+        if (*(size_t *)DHeapPeek(heap) < prev)
+        {
+            status = 5;
+        }
+        prev = *(size_t *)DHeapPop(heap);
+    }
+
+    if (0 == status && !DHeapIsEmpty(heap))
+    {
+        status = 6;
+    }
+
+    DHeapDestroy(heap);
+    free(keys);
+
+    return (status);
+}
+
+static int TestRemove(size_t arity)
+{
+    size_t keys[] = {5, 1, 9, 3, 7, 2, 8, 6, 4, 0};
+    size_t n = sizeof(keys) / sizeof(keys[0]);
+    size_t missing = 100;
+    size_t expected[] = {0, 1, 2, 4, 5, 6, 8, 9};
+    dheap_t *heap = DHeapCreate(CmpFunc, arity);
+    size_t i = 0;
+    int status = 0;
+
+    if (NULL == heap)
+    {
+        return (1);
+    }
+
+    for (i = 0; i < n; ++i)
+    {
+        DHeapPush(heap, &keys[i]);
+    }
+
+    if (&keys[3] != DHeapRemove(heap, MatchFunc, &keys[3]) ||
+        &keys[4] != DHeapRemove(heap, MatchFunc, &keys[4]) ||
+        NULL != DHeapRemove(heap, MatchFunc, &missing) ||
+        n - 2 != DHeapSize(heap))
+    {
+        status = 2;
+    }
+
+    for (i = 0; i < n - 2 && 0 == status; ++i)
+    {
+        if (expected[i] != *(size_t *)DHeapPop(heap))
+        {
+            status = 3;
+        }
+    }
+
+    DHeapDestroy(heap);
+
+    return (status);
+}
+
+/******************** BENCHMARK ********************/
+static void BenchSizes(size_t max_size)
+{
+    size_t arities[] = {2, 4, 8};
+    size_t num_arities = sizeof(arities) / sizeof(arities[0]);
+    size_t *keys = (size_t *)malloc(max_size * sizeof(size_t));
+    double result[2] = {0};
+    size_t ops = (max_size < BENCH_OPS) ? max_size : BENCH_OPS;
+    size_t reps = 0;
+    size_t n = 0;
+    size_t i = 0;
+
+    if (NULL == keys)
+    {
+        printf("not enough memory for %lu elements\n", (unsigned long)max_size);
+        return;
+    }
+
+    for (i = 0; i < max_size; ++i)
+    {
+        keys[i] = (size_t)rand() * (RAND_MAX + (size_t)1) + (size_t)rand();
+    }
+
+    printf("\npush / pop throughput, ns per operation:\n");
+    printf("%-11s %-8s %10s %10s\n", "elements", "heap", "push", "pop");
+
+    for (n = BENCH_MIN; n <= max_size; n *= 10)
+    {
+        reps = (n < ops) ? ops / n : 1;
+
+        BenchHeap(keys, n, reps, result);
+        printf("%-11lu %-8s %10.1f %10.1f\n", (unsigned long)n, "heap_t",
+                                                        result[0], result[1]);
+
+        for (i = 0; i < num_arities; ++i)
+        {
+            BenchDHeap(keys, n, reps, arities[i], result);
+            printf("%-11lu %lu%-7s %10.1f %10.1f\n", (unsigned long)n,
+                        (unsigned long)arities[i], "-ary", result[0], result[1]);
+        }
+    }
+
+    free(keys);
+}
+
+static void BenchHeap(size_t *keys, size_t n, size_t reps, double result[2])
+{
+    clock_t push_time = 0;
+    clock_t pop_time = 0;
+    clock_t start = 0;
+    size_t rep = 0;
+    size_t i = 0;
+    heap_t *heap = NULL;
+
+    for (rep = 0; rep < reps; ++rep)
+    {
+        heap = HeapCreate(CmpFunc);
+
+        start = clock();
+        for (i = 0; i < n; ++i)
+        {
+            HeapPush(heap, &keys[i]);
+        }
+        push_time += clock() - start;
+
+        start = clock();
+        for (i = 0; i < n; ++i)
+        {
+            HeapPop(heap);
+        }
+        pop_time += clock() - start;
+
+        HeapDestroy(heap);
+    }
+
+    result[0] = (double)push_time / CLOCKS_PER_SEC * 1e9 / (n * reps);
+    result[1] = (double)pop_time / CLOCKS_PER_SEC * 1e9 / (n * reps);
+}
+
+static void BenchDHeap(size_t *keys, size_t n, size_t reps, size_t arity,
+                                                            double result[2])
+{
+    clock_t push_time = 0;
+    clock_t pop_time = 0;
+    clock_t start = 0;
+    size_t rep = 0;
+    size_t i = 0;
+    dheap_t *heap = NULL;
+
+    for (rep = 0; rep < reps; ++rep)
+    {
+        heap = DHeapCreate(CmpFunc, arity);
+
+        start = clock();
+        for (i = 0; i < n; ++i)
+        {
+            DHeapPush(heap, &keys[i]);
+        }
+        push_time += clock() - start;
+
+        start = clock();
+        for (i = 0; i < n; ++i)
+        {
+            DHeapPop(heap);
+        }
+        pop_time += clock() - start;
+
+        DHeapDestroy(heap);
+    }
+
+    result[0] = (double)push_time / CLOCKS_PER_SEC * 1e9 / (n * reps);
+    result[1] = (double)pop_time / CLOCKS_PER_SEC * 1e9 / (n * reps);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static int CmpFunc(const void *a, const void *b)
+{
+    size_t lhs = *(const size_t *)a;
+    size_t rhs = *(const size_t *)b;
+
+    return ((lhs > rhs) - (lhs < rhs));
+}
+
+static int MatchFunc(const void *data, const void *params)
+{
+    return (*(const size_t *)data == *(const size_t *)params);
+}
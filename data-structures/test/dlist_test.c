@@ -46,9 +46,9 @@ int TestFlow()
 		return 1;
 	}
 	
-	DListInsert(DListBegin(list), &data1);
-	DListInsert(DListEnd(list), &data2);
-	DListInsert(DListBegin(list), &data3);
+	DListInsert(list, DListBegin(list), &data1);
+	DListInsert(list, DListEnd(list), &data2);
+	DListInsert(list, DListBegin(list), &data3);
 	
 	if(*(int *)DListGetData(DListBegin(list)) != 3)
 	{
@@ -77,7 +77,7 @@ int TestFlow()
 		return 5;
 	}
 	
-	DListRemove(DListBegin(list));
+	DListRemove(list, DListBegin(list));
 	
 	if(*(int *)DListGetData(DListBegin(list)) != 5)
 	{
@@ -181,7 +181,7 @@ int TestFlow()
     from = DListNext(where);
     to = DListPrev(DListEnd(splice_list));
     
-    DListSplice(from, to, where);
+    DListSplice(splice_list, from, to, splice_list, where);
     
     if(*(int *)DListGetData(DListBegin(splice_list)) != 1)
 	{
@@ -220,11 +220,165 @@ int TestFlow()
     return 0;
 }
 
+int TestPool()
+{
+	int data[100];
+	size_t i = 0;
+	dlist_iter_t iter = NULL;
+	pool_t *pool = DListCreatePool(16);
+	dlist_t *list = NULL;
+	dlist_t *other = NULL;
+	
+	if (NULL == pool)
+	{
+		printf("Pool case: pool creation failed.\n");
+		return 1;
+	}
+	
+	list = DListCreateWithPool(pool);
+	other = DListCreateWithPool(pool);
+	if (NULL == list || NULL == other)
+	{
+		printf("Pool case: list creation failed.\n");
+		return 1;
+	}
+	
+	for (i = 0; i < 100; ++i)
+	{
+		data[i] = (int)i;
+		DListPushBack(list, &data[i]);
+	}
+	
+	/* removed nodes go back to the pool and are reused */
+	for (i = 0; i < 50; ++i)
+	{
+		DListPopFront(list);
+	}
+	
+	for (i = 0; i < 50; ++i)
+	{
+		DListPushFront(list, &data[49 - i]);
+	}
+	
+	if (DListCount(list) != 100 || PoolCount(pool) != 100)
+	{
+		printf("Pool case: count should be 100, but result is different.\n");
+		return 2;
+	}
+	
+	/* lists on the same pool exchange nodes */
+	DListSplice(list, DListBegin(list), DListEnd(list), other, 
+				DListEnd(other));
+	DListSplice(other, DListBegin(other), DListEnd(other), list, 
+				DListEnd(list));
+	
+	if (DListCount(list) != 100 || !DListIsEmpty(other))
+	{
+		printf("Pool case: splice between pooled lists failed.\n");
+		return 3;
+	}
+	
+	for (i = 0, iter = DListBegin(list); i < 100; ++i, iter = DListNext(iter))
+	{
+		if (*(int *)DListGetData(iter) != (int)i)
+		{
+			printf("Pool case: element %lu is out of order.\n", 
+				   (unsigned long)i);
+			return 4;
+		}
+	}
+	
+	/* the nodes go back to the pool, the pool outlives its lists */
+	DListDestroy(list);
+	DListDestroy(other);
+	
+	if (PoolCount(pool) != 0)
+	{
+		printf("Pool case: destroyed lists should return their nodes.\n");
+		return 5;
+	}
+	
+	PoolDestroy(pool);
+	
+	return 0;
+}
+
+int TestCount()
+{
+	int data[10];
+	size_t i = 0;
+	dlist_iter_t from = NULL;
+	dlist_iter_t to = NULL;
+	dlist_t *list = DListCreate();
+	dlist_t *other = DListCreate();
+	
+	for (i = 0; i < 10; ++i)
+	{
+		data[i] = (int)i;
+		DListPushBack(i < 6 ? list : other, &data[i]);
+	}
+	
+	/* move 3 elements from the middle of list to the front of other */
+	from = DListNext(DListBegin(list));
+	to = DListNext(DListNext(DListNext(from)));
+	DListSplice(list, from, to, other, DListBegin(other));
+	
+	if (DListCount(list) != 3 || DListCount(other) != 7)
+	{
+		printf("Count case: splice between lists should leave 3 and 7.\n");
+		return 1;
+	}
+	
+	/* a splice within a list does not change its count */
+	DListSplice(other, DListBegin(other), DListNext(DListBegin(other)), 
+				other, DListEnd(other));
+	
+	if (DListCount(other) != 7)
+	{
+		printf("Count case: splice within a list should keep 7.\n");
+		return 2;
+	}
+	
+	/* move everything back, list becomes empty */
+	DListSplice(list, DListBegin(list), DListEnd(list), other, DListEnd(other));
+	
+	if (DListCount(list) != 0 || !DListIsEmpty(list) || 
+		DListCount(other) != 10)
+	{
+		printf("Count case: splice of a whole list should leave 0 and 10.\n");
+		return 3;
+	}
+	
+	DListPopFront(other);
+	DListRemove(other, DListBegin(other));
+	
+	if (DListCount(other) != 8)
+	{
+		printf("Count case: count should be 8 after two removes.\n");
+		return 4;
+	}
+	
+	DListDestroy(list);
+	DListDestroy(other);
+	
+	return 0;
+}
+
 /******************** MAIN ********************/
 int main()
 {
 	int test_status = TestFlow();
 	
+	if(test_status == 0)
+	{
+		test_status = TestPool();
+	}
+	
+	if(test_status == 0)
+	{
+		test_status = TestCount();
+	}
+	
 	if(test_status == 0)
 	{
 		printf("DList| ALL TESTS: %s\n", PASS);
@@ -7,8 +7,22 @@ Date: Feb 13, 2024
 #define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
 
 #include <stdio.h> /* printf */
+#include <stdlib.h> /* malloc */
+#include <time.h> /* clock */
 #include "dvector.h"
 
+#define BULK_SIZE 1000
+#define OSC_OPS 2000000
+#define BENCH_BULK 4000000
+#define SCRATCH_VECTORS 1000000
+#define SCRATCH_INLINE 8
+
+static void TestBulk(void);
+static void BenchOscillation(void);
+static void BenchBulk(void);
+static void TestSmall(void);
+static void BenchSmall(void);
+
 /******************** TESTS ********************/
 int main()
 {
@@ -42,6 +56,12 @@ int main()
 	printf("Testing Capacity: Capacity 10 case:"
 	" should be 10: %s\n", (DvectorCapacity(dvector)) == 10 ? PASS : FAIL);
 	DvectorPushBack(dvector, &a);
+	DvectorPushBack(dvector, &a);
+	DvectorPushBack(dvector, &a);
+	printf("Testing Size: %lu\n", DvectorSize(dvector));
+	printf("Testing Capacity: Full at 10 case:"
+	" should be 10: %s\n", (DvectorCapacity(dvector)) == 10 ? PASS : FAIL);
+	DvectorPushBack(dvector, &a);
 	printf("Testing Size: %lu\n", DvectorSize(dvector));
 	printf("Testing Capacity: Capacity 20 case:"
 	" should be 20: %s\n", (DvectorCapacity(dvector)) == 20 ? PASS : FAIL);
@@ -114,8 +134,266 @@ int main()
 	printf("Calling destroy\n");
 	DvectorDestroy(dvector);
 	
+	TestBulk();
+	TestSmall();
+	BenchOscillation();
+	BenchBulk();
+	BenchSmall();
+	
 	return 0;
 }
 
+static void TestBulk(void)
+{
+	dvector_t *dvector = DVectorCreate(0, sizeof(int));
+	int values[BULK_SIZE];
+	int ok = 1;
+	int i = 0;
+	
+	for (i = 0; i < BULK_SIZE; ++i)
+	{
+		values[i] = i;
+	}
+	
+	printf("\nBulk operations\n");
+	printf("Pop from empty: should fail: %s\n", 
+	(0 != DvectorPopBack(dvector)) ? PASS : FAIL);
+	
+	/* 0..99 then 900..999, and 100..899 inserted between them */
+	DvectorPushBackMany(dvector, values, 100);
+	DvectorPushBackMany(dvector, values + 900, 100);
+	DvectorInsertRange(dvector, 100, values + 100, 800);
+	DvectorInsertRange(dvector, 0, values, 0);
+	for (i = 0; i < BULK_SIZE; ++i)
+	{
+		ok &= (*(int *)DvectorGetAccessToElement(dvector, i) == i);
+	}
+	printf("Push Many and Insert Range: %s\n", 
+	(ok && BULK_SIZE == DvectorSize(dvector)) ? PASS : FAIL);
+	printf("One doubling per batch: capacity 1024: %s\n", 
+	(1024 == DvectorCapacity(dvector)) ? PASS : FAIL);
+	
+	DvectorResize(dvector, 10);
+	DvectorResize(dvector, 20);
+	ok = (20 == DvectorSize(dvector) && 1024 == DvectorCapacity(dvector));
+	for (i = 0; i < 20; ++i)
+	{
+		ok &= (*(int *)DvectorGetAccessToElement(dvector, i) == 
+												((i < 10) ? i : 0));
+	}
+	printf("Resize keeps the front and zero fills: %s\n", ok ? PASS : FAIL);
+	
+	/* pops down to a quarter, halves, then push and pop at that size */
+	while (DvectorSize(dvector) > 256)
+	{
+		DvectorPopBack(dvector);
+	}
+	DvectorResize(dvector, 257);
+	while (DvectorSize(dvector) > 256)
+	{
+		DvectorPopBack(dvector);
+	}
+	printf("Shrink once at a quarter: capacity 512: %s\n", 
+	(512 == DvectorCapacity(dvector)) ? PASS : FAIL);
+	DvectorPushBack(dvector, &values[0]);
+	DvectorPopBack(dvector);
+	DvectorPushBack(dvector, &values[0]);
+	printf("No resize when oscillating: capacity 512: %s\n", 
+	(512 == DvectorCapacity(dvector)) ? PASS : FAIL);
+	
+	/* sizes past what a size_t can count fail and change nothing */
+	ok = (0 != DvectorPushBackMany(dvector, values, (size_t)-1));
+	ok &= (0 != DvectorInsertRange(dvector, 0, values, (size_t)-1));
+	ok &= (0 != DvectorResize(dvector, (size_t)-1));
+	ok &= (0 != DvectorReserve(dvector, (size_t)-1 / 2 + 2));
+	printf("Overflowing sizes fail: %s\n", (ok && 257 == DvectorSize(dvector)
+				&& 512 == DvectorCapacity(dvector)) ? PASS : FAIL);
+	
+	DvectorDestroy(dvector);
+}
 
+/* push and pop around one size, from a vector that grew from 1 */
+static void BenchOscillation(void)
+{
+	size_t sizes[] = {2, 100, 10000, 1000000};
+	size_t amplitudes[] = {1, 16};
+	dvector_t *dvector = NULL;
+	clock_t start = 0;
+	size_t s = 0;
+	size_t a = 0;
+	size_t i = 0;
+	size_t j = 0;
+	int value = 0;
+	
+	printf("\npush/pop oscillation, ns per operation\n");
+	printf("%-9s %12s %12s\n", "size", "by 1", "by 16");
+	
+	for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+	{
+		printf("%-9lu", (unsigned long)sizes[s]);
+		
+		for (a = 0; a < sizeof(amplitudes) / sizeof(amplitudes[0]); ++a)
+		{
+			dvector = DVectorCreate(1, sizeof(int));
+			for (i = 0; i < sizes[s]; ++i)
+			{
+				DvectorPushBack(dvector, &value);
+			}
+			
+			start = clock();
+			for (i = 0; i < OSC_OPS / (2 * amplitudes[a]); ++i)
+			{
+				for (j = 0; j < amplitudes[a]; ++j)
+				{
+					DvectorPushBack(dvector, &value);
+				}
+				for (j = 0; j < amplitudes[a]; ++j)
+				{
+					DvectorPopBack(dvector);
+				}
+			}
+			printf(" %12.1f", (double)(clock() - start) / CLOCKS_PER_SEC 
+															* 1e9 / OSC_OPS);
+			
+			DvectorDestroy(dvector);
+		}
+		
+		printf("\n");
+	}
+}
 
+/* one batch against a push per element, from an empty vector */
+static void BenchBulk(void)
+{
+	int *values = (int *)calloc(BENCH_BULK, sizeof(int));
+	dvector_t *dvector = NULL;
+	double result[2] = {0};
+	clock_t start = 0;
+	size_t i = 0;
+	
+	if (NULL == values)
+	{
+		return;
+	}
+	
+	dvector = DVectorCreate(1, sizeof(int));
+	start = clock();
+	for (i = 0; i < BENCH_BULK; ++i)
+	{
+		DvectorPushBack(dvector, &values[i]);
+	}
+	result[0] = (double)(clock() - start) / CLOCKS_PER_SEC * 1e3;
+	DvectorDestroy(dvector);
+	
+	dvector = DVectorCreate(1, sizeof(int));
+	start = clock();
+	DvectorPushBackMany(dvector, values, BENCH_BULK);
+	result[1] = (double)(clock() - start) / CLOCKS_PER_SEC * 1e3;
+	DvectorDestroy(dvector);
+	
+	printf("\n%d ints, ms: push back %.2f, push back many %.2f\n", 
+									BENCH_BULK, result[0], result[1]);
+	
+	free(values);
+}
+
+static void TestSmall(void)
+{
+	dvector_t *dvector = DVectorCreateSmall(4, sizeof(int));
+	int values[BULK_SIZE];
+	int ok = 1;
+	int i = 0;
+	
+	for (i = 0; i < BULK_SIZE; ++i)
+	{
+		values[i] = i;
+	}
+	
+	printf("\nSmall vector of 4 inline elements\n");
+	
+	DvectorPushBackMany(dvector, values, 4);
+	printf("Inline while 4 fit: capacity 4: %s\n", 
+	(4 == DvectorCapacity(dvector)) ? PASS : FAIL);
+	
+	DvectorPushBack(dvector, &values[4]);
+	DvectorInsertRange(dvector, 5, values + 5, 95);
+	for (i = 0; i < 100; ++i)
+	{
+		ok &= (*(int *)DvectorGetAccessToElement(dvector, i) == i);
+	}
+	printf("Spills on overflow: capacity 128: %s\n", 
+	(ok && 128 == DvectorCapacity(dvector)) ? PASS : FAIL);
+	
+	/* down to a quarter at every step, back inline at the end */
+	while (DvectorSize(dvector) > 1)
+	{
+		DvectorPopBack(dvector);
+	}
+	printf("Back inline: capacity 4: %s\n", 
+	(4 == DvectorCapacity(dvector) && 
+	 0 == *(int *)DvectorGetAccessToElement(dvector, 0)) ? PASS : FAIL);
+	
+	DvectorReserve(dvector, 16);
+	DvectorReserve(dvector, 2);
+	printf("Reserve never goes below inline: capacity 4: %s\n", 
+	(4 == DvectorCapacity(dvector)) ? PASS : FAIL);
+	
+	DvectorDestroy(dvector);
+}
+
+/* a million per-request scratch vectors of 2 to 8 pointers. allocations */
+/* are counted from the contract: a vector takes two (one when small),   */
+/* and every change of capacity one more                                 */
+static void BenchSmall(void)
+{
+	const char *names[] = {"regular", "small"};
+	dvector_t *dvector = NULL;
+	size_t allocations[2] = {0};
+	double result[2] = {0};
+	clock_t start = 0;
+	size_t capacity = 0;
+	size_t mode = 0;
+	size_t n = 0;
+	size_t i = 0;
+	size_t j = 0;
+	void *value = NULL;
+	
+	printf("\n%d scratch vectors of 2 to 8 elements\n", SCRATCH_VECTORS);
+	
+	for (mode = 0; mode < 2; ++mode)
+	{
+		srand(1);
+		start = clock();
+		for (i = 0; i < SCRATCH_VECTORS; ++i)
+		{
+			dvector = (0 == mode) ? DVectorCreate(4, sizeof(void *)) : 
+						DVectorCreateSmall(SCRATCH_INLINE, sizeof(void *));
+			allocations[mode] += 2 - mode;
+			capacity = DvectorCapacity(dvector);
+			
+			n = 2 + (size_t)rand() % 7;
+			for (j = 0; j < n; ++j)
+			{
+				value = &dvector;
+				DvectorPushBack(dvector, &value);
+				if (capacity != DvectorCapacity(dvector))
+				{
+					capacity = DvectorCapacity(dvector);
+					++allocations[mode];
+				}
+			}
+			
+			DvectorDestroy(dvector);
+		}
+		result[mode] = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / 
+															SCRATCH_VECTORS;
+	}
+	
+	for (mode = 0; mode < 2; ++mode)
+	{
+		printf("%-8s %8.1f ns per vector, %lu allocations\n", names[mode], 
+					result[mode], (unsigned long)allocations[mode]);
+	}
+	printf("allocations avoided: %lu\n", 
+				(unsigned long)(allocations[0] - allocations[1]));
+}
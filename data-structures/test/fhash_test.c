@@ -0,0 +1,354 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* malloc */
+#include <time.h> /* clock */
+
+#include "fhash.h" /* fhash_t */
+#include "hash.h" /* hash_t */
+
+#define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
+#define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
+
+#define BENCH_CAPACITY (1 << 16) /* slots / buckets used by the benchmark */
+#define BENCH_LOOPS 10 /* lookup passes averaged per measurement */
+
+/******************** FORWARD DECLARATIONS ********************/
+static int TestFlow(void);
+static int TestGrowAndRemove(void);
+static void BenchLoadFactors(size_t capacity);
+static double BenchChained(size_t *keys, size_t n, size_t capacity,
+                                                        double *miss_time);
+static double BenchFlat(size_t *keys, size_t n, size_t capacity,
+                                                        double *miss_time);
+static size_t HashFunc(const void *value);
+static size_t BadHashFunc(const void *value);
+static int CmpFunc(const void *a, const void *b);
+static int SumAction(void *value, void *param);
+
+int main(int argc, char *argv[])
+{
+    size_t capacity = (argc > 1) ? (size_t)atol(argv[1]) : BENCH_CAPACITY;
+    int status = TestFlow();
+
+    printf("FHash| TestFlow: %s\n", 0 == status ? PASS : FAIL);
+    if (0 != status)
+    {
+        printf("failed at check %d\n", status);
+        return (status);
+    }
+
+    status = TestGrowAndRemove();
+    printf("FHash| TestGrowAndRemove: %s\n", 0 == status ? PASS : FAIL);
+    if (0 != status)
+    {
+        printf("failed at check %d\n", status);
+        return (status);
+    }
+
+    BenchLoadFactors(capacity);
+
+    return (0);
+}
+
+/******************** TEST FUNCTIONS ********************/
+static int TestFlow(void)
+{
+    size_t values[] = {1, 2, 3, 17, 33, 49};
+    size_t missing = 100;
+    size_t sum = 0;
+    size_t i = 0;
+    fhash_t *hash = FHashCreate(HashFunc, CmpFunc, 4);
+
+    if (NULL == hash)
+    {
+        return (1);
+    }
+
+    if (!FHashIsEmpty(hash) || 0 != FHashSize(hash))
+    {
+        FHashDestroy(hash);
+        return (2);
+    }
+
+    for (i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+    {
+        if (SUCCESS != FHashInsert(hash, &values[i]))
+        {
+            FHashDestroy(hash);
+            return (3);
+        }
+    }
+
+    if (FHashIsEmpty(hash) || 6 != FHashSize(hash))
+    {
+        FHashDestroy(hash);
+        return (4);
+    }
+
+    for (i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+    {
+        if (&values[i] != FHashFind(hash, &values[i]))
+        {
+            FHashDestroy(hash);
+            return (5);
+        }
+    }
+
+    if (NULL != FHashFind(hash, &missing))
+    {
+        FHashDestroy(hash);
+        return (6);
+    }
+
+    FHashForEach(hash, SumAction, &sum);
+    if (105 != sum)
+    {
+        FHashDestroy(hash);
+        return (7);
+    }
+
+    FHashRemove(hash, &values[3]);
+    FHashRemove(hash, &missing);
+    if (5 != FHashSize(hash) || NULL != FHashFind(hash, &values[3]) ||
+        &values[4] != FHashFind(hash, &values[4]))
+    {
+        FHashDestroy(hash);
+        return (8);
+    }
+
+    FHashDestroy(hash);
+
+    return (0);
+}
+
+/* a hash that collides on purpose exercises long Robin Hood probe runs */
+static int TestGrowAndRemove(void)
+{
+    size_t n = 5000;
+    size_t i = 0;
+    size_t *keys = (size_t *)malloc(n * sizeof(size_t));
+    fhash_t *hash = FHashCreate(BadHashFunc, CmpFunc, 0);
+
+    if (NULL == keys || NULL == hash)
+    {
+        free(keys);
+        return (1);
+    }
+
+    for (i = 0; i < n; ++i)
+    {
+        keys[i] = i;
+        if (SUCCESS != FHashInsert(hash, &keys[i]))
+        {
+            FHashDestroy(hash);
+            free(keys);
+            return (2);
+        }
+    }
+
+    if (n != FHashSize(hash) || 15.0 / 16 < FHashLoadFactor(hash))
+    {
+        FHashDestroy(hash);
+        free(keys);
+        return (3);
+    }
+
+    for (i = 0; i < n; i += 2)
+    {
+        FHashRemove(hash, &keys[i]);
+    }
+
+    for (i = 0; i < n; ++i)
+    {
+        if ((i % 2 == 0) != (NULL == FHashFind(hash, &keys[i])))
+        {
+            FHashDestroy(hash);
+            free(keys);
+            return (4);
+        }
+    }
+
+    if (n / 2 != FHashSize(hash))
+    {
+        FHashDestroy(hash);
+        free(keys);
+        return (5);
+    }
+
+    FHashDestroy(hash);
+    free(keys);
+
+    return (0);
+}
+
+/******************** BENCHMARK ********************/
+static void BenchLoadFactors(size_t capacity)
+{
+    double load_factors[] = {0.25, 0.5, 0.75, 0.9};
+    double chained_hit = 0;
+    double chained_miss = 0;
+    double flat_hit = 0;
+    double flat_miss = 0;
+    size_t *keys = NULL;
+    size_t n = 0;
+    size_t i = 0;
+
+    keys = (size_t *)malloc(2 * capacity * sizeof(size_t));
+    if (NULL == keys)
+    {
+        return;
+    }
+
+    /* first half is inserted, second half is only used for missed lookups */
+    for (i = 0; i < 2 * capacity; ++i)
+    {
+        keys[i] = (size_t)rand() * (RAND_MAX + (size_t)1) + (size_t)rand();
+    }
+
+    printf("\nlookup benchmark, %lu buckets/slots, avg ns per lookup:\n",
+                                                        (unsigned long)capacity);
+    printf("%-6s %14s %14s %14s %14s\n", "load", "chained hit", "flat hit",
+                                                "chained miss", "flat miss");
+
+    for (i = 0; i < sizeof(load_factors) / sizeof(load_factors[0]); ++i)
+    {
+        n = (size_t)(load_factors[i] * capacity);
+        chained_hit = BenchChained(keys, n, capacity, &chained_miss);
+        flat_hit = BenchFlat(keys, n, capacity, &flat_miss);
+
+        printf("%-6.2f %14.2f %14.2f %14.2f %14.2f\n", load_factors[i],
+                            chained_hit, flat_hit, chained_miss, flat_miss);
+    }
+
+    free(keys);
+}
+
+static double BenchChained(size_t *keys, size_t n, size_t capacity,
+                                                        double *miss_time)
+{
+    hash_t *hash = HashCreate(HashFunc, CmpFunc, capacity);
+    clock_t start = 0;
+    double hit_time = 0;
+    size_t found = 0;
+    size_t loop = 0;
+    size_t i = 0;
+
+    for (i = 0; i < n; ++i)
+    {
+        HashInsert(hash, &keys[i]);
+    }
+
+    start = clock();
+    for (loop = 0; loop < BENCH_LOOPS; ++loop)
+    {
+        for (i = 0; i < n; ++i)
+        {
+            found += (NULL != HashFind(hash, &keys[i]));
+        }
+    }
+    hit_time = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 /
+                                                        (BENCH_LOOPS * n);
+
+    start = clock();
+    for (loop = 0; loop < BENCH_LOOPS; ++loop)
+    {
+        for (i = capacity; i < capacity + n; ++i)
+        {
+            found += (NULL != HashFind(hash, &keys[i]));
+        }
+    }
+    *miss_time = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 /
+                                                        (BENCH_LOOPS * n);
+
+    if (found < BENCH_LOOPS * n)
+    {
+        printf("chained table lost keys!\n");
+    }
+
+    HashDestroy(hash);
+
+    return (hit_time);
+}
+
+static double BenchFlat(size_t *keys, size_t n, size_t capacity,
+                                                        double *miss_time)
+{
+    fhash_t *hash = FHashCreate(HashFunc, CmpFunc, capacity);
+    clock_t start = 0;
+    double hit_time = 0;
+    size_t found = 0;
+    size_t loop = 0;
+    size_t i = 0;
+
+    for (i = 0; i < n; ++i)
+    {
+        FHashInsert(hash, &keys[i]);
+    }
+
+    start = clock();
+    for (loop = 0; loop < BENCH_LOOPS; ++loop)
+    {
+        for (i = 0; i < n; ++i)
+        {
+            found += (NULL != FHashFind(hash, &keys[i]));
+        }
+    }
+    hit_time = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 /
+                                                        (BENCH_LOOPS * n);
+
+    start = clock();
+    for (loop = 0; loop < BENCH_LOOPS; ++loop)
+    {
+        for (i = capacity; i < capacity + n; ++i)
+        {
+            found += (NULL != FHashFind(hash, &keys[i]));
+        }
+    }
+    *miss_time = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 /
+                                                        (BENCH_LOOPS * n);
+
+    if (found < BENCH_LOOPS * n)
+    {
+        printf("flat table lost keys!\n");
+    }
+
+    FHashDestroy(hash);
+
+    return (hit_time);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static size_t HashFunc(const void *value)
+{
+    size_t key = *(const size_t *)value;
+
+    key ^= key >> 33;
+    key *= 0xFF51AFD7UL;
+    key ^= key >> 29;
+
+    return (key);
+}
+
+static size_t BadHashFunc(const void *value)
+{
+    return (*(const size_t *)value % 7);
+}
+
+static int CmpFunc(const void *a, const void *b)
+{
+    size_t lhs = *(const size_t *)a;
+    size_t rhs = *(const size_t *)b;
+
+    return ((lhs > rhs) - (lhs < rhs));
+}
+
+static int SumAction(void *value, void *param)
+{
+    *(size_t *)param += *(size_t *)value;
+
+    return (SUCCESS);
+}
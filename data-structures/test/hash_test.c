@@ -14,21 +14,153 @@ Date: Mar 26, 2024
 #define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
 
 static void SpellCheck(const char *dictionaryPath);
+static int TestRehash(void);
+static int TestFindMany(void);
 
 size_t HashFunc(const void* value);
 int CompFunc(const void *a, const void *b);
 int CleanupFunc(void *data, void *param);
+size_t IntHashFunc(const void *value);
+int IntCompFunc(const void *a, const void *b);
 
 int main(int argc, char *argv[])
 {
     /* use user passed path if available, else default to the standard linux dict */
     const char *dict_path = (argc > 1) ? argv[1] : "/usr/share/dict/words";
+    int status = TestRehash();
+
+    printf("Hash| TestRehash: %s\n", 0 == status ? PASS : FAIL);
+    if (0 != status)
+    {
+        printf("failed at check %d\n", status);
+        return (status);
+    }
+
+    status = TestFindMany();
+    printf("Hash| TestFindMany: %s\n", 0 == status ? PASS : FAIL);
+    if (0 != status)
+    {
+        printf("failed at check %d\n", status);
+        return (status);
+    }
     
     SpellCheck(dict_path);
 
     return 0;
 }
 
+static int TestRehash(void)
+{
+    static int values[10000];
+    size_t n = sizeof(values) / sizeof(values[0]);
+    size_t i = 0;
+    hash_t *hash = HashCreate(IntHashFunc, IntCompFunc, 8);
+
+    if (NULL == hash)
+    {
+        return (1);
+    }
+
+    for (i = 0; i < n; ++i)
+    {
+        values[i] = (int)i;
+        if (SUCCESS != HashInsert(hash, &values[i]))
+        {
+            HashDestroy(hash);
+            return (2);
+        }
+
+        /* the table doubles as soon as it passes the max load factor */
+        if (HashLoadFactor(hash) > 1.0 || HashSize(hash) != i + 1)
+        {
+            HashDestroy(hash);
+            return (3);
+        }
+    }
+
+    /* lookups must see entries that still sit in the old bucket array */
+    for (i = 0; i < n; ++i)
+    {
+        if (&values[i] != HashFind(hash, &values[i]))
+        {
+            HashDestroy(hash);
+            return (4);
+        }
+    }
+
+    for (i = 0; i < n - 10; ++i)
+    {
+        HashRemove(hash, &values[i]);
+        if (HashSize(hash) != n - i - 1)
+        {
+            HashDestroy(hash);
+            return (5);
+        }
+    }
+
+    for (i = 0; i < n; ++i)
+    {
+        if ((i < n - 10) != (NULL == HashFind(hash, &values[i])))
+        {
+            HashDestroy(hash);
+            return (6);
+        }
+    }
+
+    /* the finds above finished migrating, so the table shrank back down */
+    if (HashLoadFactor(hash) < 0.125)
+    {
+        HashDestroy(hash);
+        return (7);
+    }
+
+    HashDestroy(hash);
+
+    return (0);
+}
+
+static int TestFindMany(void)
+{
+    static int values[1000];
+    static const void *keys[2000];
+    static void *found[2000];
+    static int missing[1000];
+    size_t n = sizeof(values) / sizeof(values[0]);
+    size_t i = 0;
+    hash_t *hash = HashCreate(IntHashFunc, IntCompFunc, 64);
+
+    if (NULL == hash)
+    {
+        return (1);
+    }
+
+    for (i = 0; i < n; ++i)
+    {
+        values[i] = (int)i;
+        missing[i] = (int)(n + i);
+        HashInsert(hash, &values[i]);
+
+        /* interleave hits and misses, some of them still in the old table */
+        keys[2 * i] = &values[i];
+        keys[2 * i + 1] = &missing[i];
+    }
+
+    HashFindMany(hash, keys, 2 * n, found);
+
+    for (i = 0; i < n; ++i)
+    {
+        if (&values[i] != found[2 * i] || NULL != found[2 * i + 1])
+        {
+            HashDestroy(hash);
+            return (2);
+        }
+    }
+
+    HashDestroy(hash);
+
+    return (0);
+}
+
 static void SpellCheck(const char *dictionaryPath) 
 {
     FILE *dictFile = fopen(dictionaryPath, "r");
@@ -115,3 +247,13 @@ int CleanupFunc(void *data, void *param)
     free(data);
     return SUCCESS; 
 }
+
+size_t IntHashFunc(const void *value)
+{
+    return ((size_t)*(const int *)value);
+}
+
+int IntCompFunc(const void *a, const void *b)
+{
+    return (*(const int *)a - *(const int *)b);
+}
@@ -4,13 +4,19 @@ Date: Mar 30, 2024
 */
 
 #include <stdio.h> /*printf*/
+#include <stdlib.h> /*rand*/
+#include <time.h> /*clock*/
 
 #include "heap.h" /*heap_t*/
 
 static status_t TestFlowHeap1();
 static status_t TestFlowHeap2();
 static status_t TestFlowHeap3();
+static status_t TestIndexedHeap();
+static status_t TestBatch();
+static void BenchBatch();
 static int CmpInts(const void *a, const void *b);
+static int CmpSizes(const void *a, const void *b);
 
 int main()
 {
@@ -48,6 +54,30 @@ int main()
         printf("test flow 3 SUCCESS!\n");
     }
 
+    status = TestIndexedHeap();
+
+    if (SUCCESS != status)
+    {
+        printf("indexed heap test failed!\n");
+    }
+    else
+    {
+        printf("indexed heap test SUCCESS!\n");
+    }
+
+    status = TestBatch();
+
+    if (SUCCESS != status)
+    {
+        printf("batch test failed!\n");
+    }
+    else
+    {
+        printf("batch test SUCCESS!\n");
+    }
+
+    BenchBatch();
+
     printf("exit with status = %d\n", status);
     return (0);
 }
@@ -299,6 +329,235 @@ static status_t TestFlowHeap1()
     return (SUCCESS);
 }
 
+#define INDEXED_SIZE 1000
+
+/* removes and re-keys random elements by handle, pops must stay in order */
+static status_t TestIndexedHeap()
+{
+    heap_t *heap = HeapCreateIndexed(CmpInts);
+    heap_handle_t handles[INDEXED_SIZE];
+    int keys[INDEXED_SIZE];
+    int removed[INDEXED_SIZE] = {0};
+    size_t expected_size = INDEXED_SIZE;
+    int prev = 0;
+    int i = 0;
+
+    if (!heap)
+    {
+        printf("line %d HeapCreateIndexed failed!\n", __LINE__);
+        return (FAILURE);
+    }
+
+    for (i = 0; i < INDEXED_SIZE; ++i)
+    {
+        keys[i] = rand() % INDEXED_SIZE;
+        handles[i] = HeapPushIndexed(heap, &keys[i]);
+        if (NULL == handles[i])
+        {
+            printf("line %d HeapPushIndexed failed!\n", __LINE__);
+            HeapDestroy(heap);
+            return (FAILURE);
+        }
+    }
+
+    for (i = 0; i < INDEXED_SIZE; i += 3)
+    {
+        if (&keys[i] != HeapRemoveHandle(heap, handles[i]))
+        {
+            printf("line %d HeapRemoveHandle failed!\n", __LINE__);
+            HeapDestroy(heap);
+            return (FAILURE);
+        }
+        removed[i] = 1;
+        --expected_size;
+    }
+
+    for (i = 1; i < INDEXED_SIZE; i += 3)
+    {
+        /* decrease key on one, increase key on the next */
+        keys[i] = (i % 2) ? keys[i] - INDEXED_SIZE : keys[i] + INDEXED_SIZE;
+        HeapUpdateHandle(heap, handles[i]);
+    }
+
+    if (expected_size != HeapSize(heap))
+    {
+        printf("line %d HeapSize failed! should be %lu but size = %lu\n",
+                __LINE__, expected_size, HeapSize(heap));
+        HeapDestroy(heap);
+        return (FAILURE);
+    }
+
+    prev = *(int *)HeapPeek(heap);
+    while (!HeapIsEmpty(heap))
+    {
+        i = (int *)HeapPeek(heap) - keys;
+        if (removed[i] || keys[i] < prev)
+        {
+            printf("line %d pop order failed at key %d!\n", __LINE__, keys[i]);
+            HeapDestroy(heap);
+            return (FAILURE);
+        }
+        prev = keys[i];
+        removed[i] = 1;
+        HeapPop(heap);
+    }
+
+    for (i = 0; i < INDEXED_SIZE; ++i)
+    {
+        if (!removed[i])
+        {
+            printf("line %d element %d was lost!\n", __LINE__, i);
+            HeapDestroy(heap);
+            return (FAILURE);
+        }
+    }
+
+    HeapDestroy(heap);
+    return (SUCCESS);
+}
+
+#define BATCH_SIZE 1000
+#define BATCH_CHUNK 64
+#define BENCH_SIZE 1000000
+
+static status_t TestBatch()
+{
+    heap_t *heap = HeapCreateFrom(NULL, 0, CmpInts);
+    int keys[BATCH_SIZE];
+    void *ptrs[BATCH_SIZE];
+    void *out[BATCH_CHUNK];
+    size_t popped = 0;
+    size_t total = 0;
+    int prev = -1;
+    size_t i = 0;
+
+    if (!heap || !HeapIsEmpty(heap))
+    {
+        printf("line %d HeapCreateFrom of nothing failed!\n", __LINE__);
+        return (FAILURE);
+    }
+    HeapDestroy(heap);
+
+    for (i = 0; i < BATCH_SIZE; ++i)
+    {
+        keys[i] = rand() % BATCH_SIZE;
+        ptrs[i] = &keys[i];
+    }
+
+    /* a heapified start, a batch small enough to sift up, then a batch */
+    /* large enough to rebuild the heap with                            */
+    heap = HeapCreateFrom(ptrs, 100, CmpInts);
+    if (!heap ||
+        SUCCESS != HeapPushMany(heap, ptrs + 100, 50) ||
+        SUCCESS != HeapPushMany(heap, ptrs + 150, BATCH_SIZE - 150))
+    {
+        printf("line %d HeapCreateFrom / HeapPushMany failed!\n", __LINE__);
+        if (heap)
+        {
+            HeapDestroy(heap);
+        }
+        return (FAILURE);
+    }
+
+    if (BATCH_SIZE != HeapSize(heap))
+    {
+        printf("line %d HeapSize failed! should be %d but size = %lu\n",
+                __LINE__, BATCH_SIZE, HeapSize(heap));
+        HeapDestroy(heap);
+        return (FAILURE);
+    }
+
+    do
+    {
+        popped = HeapPopMany(heap, out, BATCH_CHUNK);
+        for (i = 0; i < popped; ++i)
+        {
+            if (*(int *)out[i] < prev)
+            {
+                printf("line %d pop order failed at key %d!\n", __LINE__,
+                                                            *(int *)out[i]);
+                HeapDestroy(heap);
+                return (FAILURE);
+            }
+            prev = *(int *)out[i];
+        }
+        total += popped;
+    } while (BATCH_CHUNK == popped);
+
+    if (BATCH_SIZE != total || !HeapIsEmpty(heap) ||
+        0 != HeapPopMany(heap, out, BATCH_CHUNK))
+    {
+        printf("line %d HeapPopMany failed! popped %lu of %d\n", __LINE__,
+                                                        total, BATCH_SIZE);
+        HeapDestroy(heap);
+        return (FAILURE);
+    }
+
+    HeapDestroy(heap);
+    return (SUCCESS);
+}
+
+/* one by one against a single batch, for a queue filled from scratch */
+static void BenchBatch()
+{
+    size_t *keys = (size_t *)malloc(BENCH_SIZE * sizeof(size_t));
+    void **ptrs = (void **)malloc(BENCH_SIZE * sizeof(void *));
+    heap_t *heap = NULL;
+    clock_t start = 0;
+    double push = 0;
+    double push_many = 0;
+    double create_from = 0;
+    size_t i = 0;
+
+    if (!keys || !ptrs)
+    {
+        free(keys);
+        free(ptrs);
+        return;
+    }
+
+    for (i = 0; i < BENCH_SIZE; ++i)
+    {
+        keys[i] = (size_t)rand();
+        ptrs[i] = &keys[i];
+    }
+
+    heap = HeapCreate(CmpSizes);
+    start = clock();
+    for (i = 0; i < BENCH_SIZE; ++i)
+    {
+        HeapPush(heap, ptrs[i]);
+    }
+    push = (double)(clock() - start) / CLOCKS_PER_SEC;
+    HeapDestroy(heap);
+
+    heap = HeapCreate(CmpSizes);
+    start = clock();
+    HeapPushMany(heap, ptrs, BENCH_SIZE);
+    push_many = (double)(clock() - start) / CLOCKS_PER_SEC;
+    HeapDestroy(heap);
+
+    start = clock();
+    heap = HeapCreateFrom(ptrs, BENCH_SIZE, CmpSizes);
+    create_from = (double)(clock() - start) / CLOCKS_PER_SEC;
+    HeapDestroy(heap);
+
+    printf("%d elements, ns per element: HeapPush %.1f, HeapPushMany %.1f, "
+           "HeapCreateFrom %.1f\n", BENCH_SIZE, push * 1e9 / BENCH_SIZE,
+            push_many * 1e9 / BENCH_SIZE, create_from * 1e9 / BENCH_SIZE);
+
+    free(keys);
+    free(ptrs);
+}
+
+static int CmpSizes(const void *a, const void *b)
+{
+    size_t lhs = *(const size_t *)a;
+    size_t rhs = *(const size_t *)b;
+
+    return ((lhs > rhs) - (lhs < rhs));
+}
+
 static int CmpInts(const void *a, const void *b)
 {
     return (*(int*)a - *(int*)b);
@@ -0,0 +1,206 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* malloc */
+#include <time.h> /* clock */
+
+#include "pool.h" /* pool_t */
+
+#define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
+#define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
+
+#define BENCH_ELEMS 1000000 /* elements allocated by every benchmark round */
+#define BENCH_ELEM_SIZE 32 /* about the size of a dlist node */
+#define SLAB_ELEMS 4096
+
+/******************** FORWARD DECLARATIONS ********************/
+static int TestFlow(void);
+static void BenchAllocation(size_t n);
+static double ElapsedSec(clock_t start);
+
+/******************** TEST FUNCTIONS ********************/
+static int TestFlow(void)
+{
+    pool_t *pool = PoolCreate(sizeof(int), 3);
+    int *elems[10] = {NULL};
+    int *reused = NULL;
+    size_t i = 0;
+    size_t j = 0;
+
+    if (NULL == pool)
+    {
+        return (1);
+    }
+
+    /* more elements than a slab, to make the pool grow a few times */
+    for (i = 0; i < 10; ++i)
+    {
+        elems[i] = (int *)PoolAlloc(pool);
+        if (NULL == elems[i])
+        {
+            PoolDestroy(pool);
+            return (2);
+        }
+        *elems[i] = (int)i;
+    }
+
+    if (10 != PoolCount(pool))
+    {
+        PoolDestroy(pool);
+        return (3);
+    }
+
+    for (i = 0; i < 10; ++i)
+    {
+        for (j = i + 1; j < 10; ++j)
+        {
+            if (elems[i] == elems[j])
+            {
+                PoolDestroy(pool);
+                return (4);
+            }
+        }
+
+        if ((int)i != *elems[i] || 0 != (size_t)elems[i] % sizeof(void *))
+        {
+            PoolDestroy(pool);
+            return (5);
+        }
+    }
+
+    /* a freed element is the next one handed out */
+    PoolFree(pool, elems[4]);
+    reused = (int *)PoolAlloc(pool);
+    if (elems[4] != reused || 10 != PoolCount(pool))
+    {
+        PoolDestroy(pool);
+        return (6);
+    }
+
+    for (i = 0; i < 10; ++i)
+    {
+        PoolFree(pool, elems[i]);
+    }
+
+    if (0 != PoolCount(pool))
+    {
+        PoolDestroy(pool);
+        return (7);
+    }
+
+    PoolDestroy(pool);
+
+    return (0);
+}
+
+/******************** BENCHMARK ********************/
+static void BenchAllocation(size_t n)
+{
+    void **elems = (void **)malloc(n * sizeof(void *));
+    pool_t *pool = NULL;
+    clock_t start = 0;
+    double malloc_time = 0;
+    double pool_time = 0;
+    double malloc_churn = 0;
+    double pool_churn = 0;
+    size_t i = 0;
+
+    if (NULL == elems)
+    {
+        return;
+    }
+
+    /* fill then release everything, the pattern of build + destroy */
+    start = clock();
+    for (i = 0; i < n; ++i)
+    {
+        elems[i] = malloc(BENCH_ELEM_SIZE);
+    }
+    for (i = 0; i < n; ++i)
+    {
+        free(elems[i]);
+    }
+    malloc_time = ElapsedSec(start);
+
+    start = clock();
+    pool = PoolCreate(BENCH_ELEM_SIZE, SLAB_ELEMS);
+    for (i = 0; i < n; ++i)
+    {
+        elems[i] = PoolAlloc(pool);
+    }
+    PoolDestroy(pool);
+    pool_time = ElapsedSec(start);
+
+    /* steady state churn - free and reallocate every other element */
+    for (i = 0; i < n; ++i)
+    {
+        elems[i] = malloc(BENCH_ELEM_SIZE);
+    }
+    start = clock();
+    for (i = 0; i < n; i += 2)
+    {
+        free(elems[i]);
+        elems[i] = malloc(BENCH_ELEM_SIZE);
+    }
+    malloc_churn = ElapsedSec(start);
+    for (i = 0; i < n; ++i)
+    {
+        free(elems[i]);
+    }
+
+    pool = PoolCreate(BENCH_ELEM_SIZE, SLAB_ELEMS);
+    for (i = 0; i < n; ++i)
+    {
+        elems[i] = PoolAlloc(pool);
+    }
+    start = clock();
+    for (i = 0; i < n; i += 2)
+    {
+        PoolFree(pool, elems[i]);
+        elems[i] = PoolAlloc(pool);
+    }
+    pool_churn = ElapsedSec(start);
+    PoolDestroy(pool);
+
+    printf("\nallocation benchmark, %lu elements of %d bytes, Mallocs/s:\n",
+                                            (unsigned long)n, BENCH_ELEM_SIZE);
+    printf("%-20s %12s %12s\n", "", "malloc", "pool");
+    printf("%-20s %12.2f %12.2f\n", "alloc all + free", n / malloc_time / 1e6,
+                                                        n / pool_time / 1e6);
+    printf("%-20s %12.2f %12.2f\n", "free + realloc", n / 2 / malloc_churn /
+                                            1e6, n / 2 / pool_churn / 1e6);
+
+    free(elems);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static double ElapsedSec(clock_t start)
+{
+    double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    return (elapsed > 0 ? elapsed : 1.0 / CLOCKS_PER_SEC);
+}
+
+/******************** MAIN ********************/
+int main(int argc, char *argv[])
+{
+    size_t n = (argc > 1) ? (size_t)atol(argv[1]) : BENCH_ELEMS;
+    int test_status = TestFlow();
+
+    if (0 == test_status)
+    {
+        printf("Pool| ALL TESTS: %s\n", PASS);
+    }
+    else
+    {
+        printf("Pool| %s AT %d \n", FAIL, test_status);
+        return (test_status);
+    }
+
+    BenchAllocation(n);
+
+    return (0);
+}
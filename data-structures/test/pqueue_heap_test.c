@@ -267,11 +267,111 @@ int TestFlow()
 	return 0;
 }
 
+int TestHandles()
+{
+	pq_t *new_pq = PQCreateIndexed(CmpFunc);
+	int array[] = {5, 3, 2, 1, 7, 12, 8, 0, -6, -67, 172, 3, 9};
+	pq_handle_t handles[13];
+	size_t i = 0;
+	
+	for (i = 0; i < 13; ++i)
+	{
+		handles[i] = PQEnqueueIndexed(new_pq, &array[i]);
+		if (NULL == handles[i])
+		{
+			printf("Testing PQEnqueueIndexed: Should work, but failed.\n");
+			PQDestroy(new_pq);
+			return 31;
+		}
+	}
+	
+	if (&array[9] != PQEraseHandle(new_pq, handles[9]) || 
+		-6 != *(int *)PQPeek(new_pq) || 12 != PQCount(new_pq))
+	{
+		printf("Testing PQEraseHandle: "
+		"erasing the head, -6 should be next.\n");
+		PQDestroy(new_pq);
+		return 32;
+	}
+	
+	array[10] = -100;
+	PQUpdateHandle(new_pq, handles[10]);
+	if (&array[10] != PQDequeue(new_pq))
+	{
+		printf("Testing PQUpdateHandle: "
+		"172 turned into -100, should be dequeued first.\n");
+		PQDestroy(new_pq);
+		return 33;
+	}
+	
+	/* the plain functions keep working on an indexed queue */
+	if (0 != PQEnqueue(new_pq, &array[9]) || 
+		&array[9] != PQErase(new_pq, MatchFunc, &array[9]) || 
+		-6 != *(int *)PQDequeue(new_pq))
+	{
+		printf("Testing PQEnqueue & PQErase on an indexed queue: failed.\n");
+		PQDestroy(new_pq);
+		return 34;
+	}
+	
+	PQDestroy(new_pq);
+	
+	return 0;
+}
+
+int TestBatch()
+{
+	pq_t *new_pq = PQCreate(CmpFunc);
+	int array[] = {5, 3, 2, 1, 7, 12, 8, 0, -6, -67, 172, 3, 9};
+	int expected[] = {-67, -6, 0, 1, 2, 3, 3, 5, 7, 8, 9, 12, 172};
+	void *batch[13];
+	size_t i = 0;
+	
+	for (i = 0; i < 13; ++i)
+	{
+		batch[i] = &array[i];
+	}
+	
+	if (0 != PQEnqueueMany(new_pq, batch, 4) || 
+		0 != PQEnqueueMany(new_pq, batch + 4, 9) || 13 != PQCount(new_pq))
+	{
+		printf("Testing PQEnqueueMany: "
+		"13 elements in two batches, should work, but failed.\n");
+		PQDestroy(new_pq);
+		return 35;
+	}
+	
+	for (i = 0; i < 13; ++i)
+	{
+		if (expected[i] != *(int *)PQDequeue(new_pq))
+		{
+			printf("Testing PQDequeue after PQEnqueueMany: "
+			"should be %d, but result is different.\n", expected[i]);
+			PQDestroy(new_pq);
+			return 36;
+		}
+	}
+	
+	PQDestroy(new_pq);
+	
+	return 0;
+}
+
 /******************** MAIN ********************/
 int main()
 {
 	int test_status = TestFlow();
 	
+	if (0 == test_status)
+	{
+		test_status = TestHandles();
+	}
+	
+	if (0 == test_status)
+	{
+		test_status = TestBatch();
+	}
+	
 	if(test_status == 0)
 	{
 		printf("PQ| ALL TESTS: %s\n", PASS);
@@ -0,0 +1,279 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
+#define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* rand */
+
+#include "pqueue_pairing.h" /* pq_t */
+
+#define TEST_SIZE 2000
+
+/**************** FORWARD DECLARATIONS ****************/
+static int TestFlow(void);
+static int TestErase(void);
+static int TestHandles(void);
+static int DrainInOrder(pq_t *pq, int *keys, int *removed);
+static int CmpFunc(const void *data, const void *param);
+static int MatchFunc(const void *data, void *param);
+
+/******************** MAIN ********************/
+int main(void)
+{
+	int test_status = TestFlow();
+
+	if (0 == test_status)
+	{
+		test_status = TestErase();
+	}
+
+	if (0 == test_status)
+	{
+		test_status = TestHandles();
+	}
+
+	if (0 == test_status)
+	{
+		printf("PQ Pairing| ALL TESTS: %s\n", PASS);
+	}
+	else
+	{
+		printf("PQ Pairing| %s AT %d \n", FAIL, test_status);
+	}
+
+	return (test_status);
+}
+
+/******************** TESTS ********************/
+static int TestFlow(void)
+{
+	pq_t *pq = PQCreate(CmpFunc);
+	int keys[TEST_SIZE];
+	int removed[TEST_SIZE] = {0};
+	int *top = NULL;
+	int prev = -1;
+	int i = 0;
+	int status = 0;
+
+	if (NULL == pq || !PQIsEmpty(pq) || NULL != PQPeek(pq) ||
+		NULL != PQDequeue(pq))
+	{
+		return (1);
+	}
+
+	for (i = 0; i < TEST_SIZE; ++i)
+	{
+		keys[i] = rand() % TEST_SIZE;
+		if (0 != PQEnqueue(pq, &keys[i]))
+		{
+			status = 2;
+		}
+	}
+
+	if (0 == status && TEST_SIZE != PQCount(pq))
+	{
+		status = 3;
+	}
+
+	/* dequeue half, then enqueue them again ahead of the rest */
+	for (i = 0; i < TEST_SIZE / 2 && 0 == status; ++i)
+	{
+		top = (int *)PQPeek(pq);
+		if (top != PQDequeue(pq) || *top < prev)
+		{
+			status = 4;
+		}
+		prev = *top;
+		removed[top - keys] = 1;
+	}
+
+	for (i = 0; i < TEST_SIZE && 0 == status; ++i)
+	{
+		if (removed[i])
+		{
+			keys[i] -= TEST_SIZE;
+			removed[i] = 0;
+			PQEnqueue(pq, &keys[i]);
+		}
+	}
+
+	if (0 == status && 0 != DrainInOrder(pq, keys, removed))
+	{
+		status = 5;
+	}
+
+	PQClear(pq);
+	PQDestroy(pq);
+
+	return (status);
+}
+
+static int TestErase(void)
+{
+	pq_t *pq = PQCreate(CmpFunc);
+	int keys[TEST_SIZE];
+	int removed[TEST_SIZE] = {0};
+	int missing = -1;
+	int i = 0;
+
+	for (i = 0; i < TEST_SIZE; ++i)
+	{
+		keys[i] = i;
+		PQEnqueue(pq, &keys[i]);
+	}
+
+	/* a dequeue first, so there is a tree to search below the root */
+	if (&keys[0] != PQDequeue(pq))
+	{
+		PQDestroy(pq);
+		return (11);
+	}
+	removed[0] = 1;
+
+	for (i = 1; i < TEST_SIZE; i += 3)
+	{
+		if (&keys[i] != PQErase(pq, MatchFunc, &keys[i]))
+		{
+			PQDestroy(pq);
+			return (12);
+		}
+		removed[i] = 1;
+	}
+
+	if (NULL != PQErase(pq, MatchFunc, &missing) ||
+		0 != DrainInOrder(pq, keys, removed))
+	{
+		PQDestroy(pq);
+		return (13);
+	}
+
+	for (i = 0; i < TEST_SIZE; ++i)
+	{
+		PQEnqueue(pq, &keys[i]);
+	}
+	PQDequeue(pq);
+	PQClear(pq);
+
+	if (!PQIsEmpty(pq) || 0 != PQCount(pq))
+	{
+		PQDestroy(pq);
+		return (14);
+	}
+
+	PQDestroy(pq);
+
+	return (0);
+}
+
+static int TestHandles(void)
+{
+	pq_t *pq = PQCreateIndexed(CmpFunc);
+	pq_handle_t handles[TEST_SIZE];
+	int keys[TEST_SIZE];
+	int removed[TEST_SIZE] = {0};
+	int *top = NULL;
+	int i = 0;
+	int status = 0;
+
+	for (i = 0; i < TEST_SIZE; ++i)
+	{
+		keys[i] = rand() % TEST_SIZE;
+		handles[i] = PQEnqueueIndexed(pq, &keys[i]);
+		if (NULL == handles[i])
+		{
+			PQDestroy(pq);
+			return (21);
+		}
+	}
+
+	/* builds some depth below the root before changing keys */
+	for (i = 0; i < 10; ++i)
+	{
+		top = (int *)PQDequeue(pq);
+		removed[top - keys] = 1;
+	}
+
+	for (i = 0; i < TEST_SIZE && 0 == status; i += 5)
+	{
+		if (removed[i])
+		{
+			continue;
+		}
+
+		if (&keys[i] != PQEraseHandle(pq, handles[i]))
+		{
+			status = 22;
+		}
+		removed[i] = 1;
+	}
+
+	for (i = 1; i < TEST_SIZE; i += 2)
+	{
+		if (removed[i])
+		{
+			continue;
+		}
+
+		/* decrease the key on one, increase it on the next */
+		keys[i] += (i % 4 == 1) ? -TEST_SIZE : TEST_SIZE;
+		PQUpdateHandle(pq, handles[i]);
+	}
+
+	if (0 == status && 0 != DrainInOrder(pq, keys, removed))
+	{
+		status = 23;
+	}
+
+	PQDestroy(pq);
+
+	return (status);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+/* dequeues everything, checks the order and that nothing was lost */
+static int DrainInOrder(pq_t *pq, int *keys, int *removed)
+{
+	int prev = 0;
+	int *top = NULL;
+	int i = 0;
+
+	if (!PQIsEmpty(pq))
+	{
+		prev = *(int *)PQPeek(pq);
+	}
+
+	while (!PQIsEmpty(pq))
+	{
+		top = (int *)PQDequeue(pq);
+		if (*top < prev || removed[top - keys])
+		{
+			return (1);
+		}
+		prev = *top;
+		removed[top - keys] = 1;
+	}
+
+	for (i = 0; i < TEST_SIZE; ++i)
+	{
+		if (!removed[i])
+		{
+			return (2);
+		}
+	}
+
+	return (0);
+}
+
+static int CmpFunc(const void *data, const void *param)
+{
+	return (*(int *)data - *(int *)param);
+}
+
+static int MatchFunc(const void *data, void *param)
+{
+	return (*(int *)data == *(int *)param);
+}
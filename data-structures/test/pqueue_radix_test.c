@@ -0,0 +1,507 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Build: make TARGET=pqueue && make TARGET=pqueue_heap &&
+       make TARGET=pqueue_pairing && make TARGET=pqueue_radix AF=-ldl
+Run:   ./pqueue_radix.out       (tests, then benchmark if they all pass)
+       ./pqueue_radix.out bench (benchmark only)
+
+The benchmark loads every priority queue backend that was built with
+dlopen and runs the same trace against each: fill, hold (dequeue the head
+and enqueue it again further on, the way timers are re-armed), erase by
+match, and for the backends with handles a Dijkstra-like run of
+dequeues mixed with decrease-key.
+*/
+
+#define _GNU_SOURCE /* RTLD_DEEPBIND */
+
+#define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
+#define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* rand */
+#include <string.h> /* strcmp */
+#include <time.h> /* clock */
+
+#include "bench_lib.h" /* BenchLibOpen */
+#include "pqueue_radix.h" /* pq_t */
+
+#define TEST_SIZE 2000
+#define HOLD_OPS 1000000
+#define ERASE_OPS 100
+#define DECREASES_PER_POP 4
+
+/******************** TYPES ********************/
+typedef struct item
+{
+	size_t key;
+	size_t pos; /* index among the queued items, decrease-key run only */
+} item_t;
+
+typedef int (*cmp_func_t)(const void *data, const void *param);
+
+typedef struct backend
+{
+	const char *name;
+	const char *lib;
+	int keyed; /* created with a key function instead of a compare one */
+	void *handle;
+	pq_t *(*create_cmp)(cmp_func_t cmp_func);
+	pq_t *(*create_key)(pq_key_func_t key_func);
+	pq_t *(*create_indexed)(cmp_func_t cmp_func);
+	void (*destroy)(pq_t *pq);
+	int (*enqueue)(pq_t *pq, void *data);
+	void *(*dequeue)(pq_t *pq);
+	void *(*erase)(pq_t *pq, pq_match_func_t match_func, void *param);
+	void *(*enqueue_indexed)(pq_t *pq, void *data);
+	void (*update_handle)(pq_t *pq, void *handle);
+} backend_t;
+
+/**************** FORWARD DECLARATIONS ****************/
+static int TestFlow(void);
+static int TestErase(void);
+static int TestClear(void);
+static int BenchBackends(void);
+static int LoadBackend(backend_t *backend);
+static pq_t *CreateQueue(const backend_t *backend);
+static void BenchTrace(const backend_t *backend, item_t *items, size_t n,
+														double result[3]);
+static double BenchDecrease(const backend_t *backend, item_t *items, size_t n);
+static size_t KeyFunc(const void *data);
+static int CmpFunc(const void *data, const void *param);
+static int MatchFunc(const void *data, void *param);
+static size_t RandKey(void);
+
+/******************** MAIN ********************/
+int main(int argc, char *argv[])
+{
+	int test_status = 0;
+
+	if (argc > 1 && 0 == strcmp(argv[1], "bench"))
+	{
+		return (BenchBackends());
+	}
+
+	test_status = TestFlow();
+
+	if (0 == test_status)
+	{
+		test_status = TestErase();
+	}
+
+	if (0 == test_status)
+	{
+		test_status = TestClear();
+	}
+
+	if (0 == test_status)
+	{
+		printf("PQ Radix| ALL TESTS: %s\n", PASS);
+	}
+	else
+	{
+		printf("PQ Radix| %s AT %d \n", FAIL, test_status);
+
+		return (test_status);
+	}
+
+	return (BenchBackends());
+}
+
+/******************** TESTS ********************/
+static int TestFlow(void)
+{
+	pq_t *pq = PQCreate(KeyFunc);
+	item_t items[TEST_SIZE];
+	item_t *top = NULL;
+	size_t prev = 0;
+	size_t i = 0;
+	int status = 0;
+
+	if (NULL == pq || !PQIsEmpty(pq) || NULL != PQPeek(pq) ||
+		NULL != PQDequeue(pq))
+	{
+		return (1);
+	}
+
+	for (i = 0; i < TEST_SIZE; ++i)
+	{
+		items[i].key = (size_t)rand() % TEST_SIZE;
+		if (0 != PQEnqueue(pq, &items[i]))
+		{
+			status = 2;
+		}
+	}
+
+	if (0 == status && TEST_SIZE != PQCount(pq))
+	{
+		status = 3;
+	}
+
+	/* hold: every dequeued item comes back later, never before the head */
+	for (i = 0; i < 10 * TEST_SIZE && 0 == status; ++i)
+	{
+		top = (item_t *)PQPeek(pq);
+		if (top != PQDequeue(pq) || top->key < prev)
+		{
+			status = 4;
+		}
+		prev = top->key;
+
+		top->key += (size_t)rand() % (4 * TEST_SIZE);
+		PQEnqueue(pq, top);
+	}
+
+	for (i = 0; i < TEST_SIZE && 0 == status; ++i)
+	{
+		top = (item_t *)PQDequeue(pq);
+		if (NULL == top || top->key < prev)
+		{
+			status = 5;
+		}
+		prev = top->key;
+	}
+
+	if (0 == status && !PQIsEmpty(pq))
+	{
+		status = 6;
+	}
+
+	PQDestroy(pq);
+
+	return (status);
+}
+
+static int TestErase(void)
+{
+	pq_t *pq = PQCreate(KeyFunc);
+	item_t items[TEST_SIZE];
+	item_t missing = {0, 0};
+	item_t *top = NULL;
+	size_t prev = 0;
+	size_t erased = 0;
+	size_t i = 0;
+
+	for (i = 0; i < TEST_SIZE; ++i)
+	{
+		items[i].key = TEST_SIZE - i;
+		PQEnqueue(pq, &items[i]);
+	}
+
+	/* the first dequeue spreads the keys over the lower buckets */
+	if (&items[TEST_SIZE - 1] != PQDequeue(pq))
+	{
+		PQDestroy(pq);
+		return (11);
+	}
+
+	for (i = 0; i < TEST_SIZE - 1; i += 3)
+	{
+		if (&items[i] != PQErase(pq, MatchFunc, &items[i]))
+		{
+			PQDestroy(pq);
+			return (12);
+		}
+		++erased;
+	}
+
+	if (NULL != PQErase(pq, MatchFunc, &missing) ||
+		TEST_SIZE - 1 - erased != PQCount(pq))
+	{
+		PQDestroy(pq);
+		return (13);
+	}
+
+	while (!PQIsEmpty(pq))
+	{
+		top = (item_t *)PQDequeue(pq);
+		if (top->key < prev || 0 == (top - items) % 3)
+		{
+			PQDestroy(pq);
+			return (14);
+		}
+		prev = top->key;
+	}
+
+	PQDestroy(pq);
+
+	return (0);
+}
+
+static int TestClear(void)
+{
+	pq_t *pq = PQCreate(KeyFunc);
+	item_t items[3] = {{100, 0}, {200, 0}, {5, 0}};
+	int status = 0;
+
+	PQEnqueue(pq, &items[0]);
+	PQEnqueue(pq, &items[1]);
+	PQDequeue(pq);
+	PQClear(pq);
+
+	/* 5 is below the last dequeued key, allowed only after a clear */
+	if (!PQIsEmpty(pq) || 0 != PQEnqueue(pq, &items[2]) ||
+		&items[2] != PQPeek(pq) || &items[2] != PQDequeue(pq))
+	{
+		status = 21;
+	}
+
+	PQDestroy(pq);
+
+	return (status);
+}
+
+/******************** BENCHMARK ********************/
+static int LoadBackend(backend_t *backend)
+{
+	void *lib = BenchLibOpen(backend->lib);
+	void **create = backend->keyed ? (void **)&backend->create_key :
+									 (void **)&backend->create_cmp;
+
+	if (NULL == lib ||
+		0 != BenchLibSym(lib, "PQCreate", create) ||
+		0 != BenchLibSym(lib, "PQDestroy", (void **)&backend->destroy) ||
+		0 != BenchLibSym(lib, "PQEnqueue", (void **)&backend->enqueue) ||
+		0 != BenchLibSym(lib, "PQDequeue", (void **)&backend->dequeue) ||
+		0 != BenchLibSym(lib, "PQErase", (void **)&backend->erase))
+	{
+		if (NULL != lib)
+		{
+			printf("%s is incomplete, skipped\n", backend->lib);
+		}
+		BenchLibClose(lib);
+		return (1);
+	}
+
+	/* only the backends with handles have these */
+	BenchLibSym(lib, "PQCreateIndexed", (void **)&backend->create_indexed);
+	BenchLibSym(lib, "PQEnqueueIndexed", (void **)&backend->enqueue_indexed);
+	BenchLibSym(lib, "PQUpdateHandle", (void **)&backend->update_handle);
+
+	backend->handle = lib;
+
+	return (0);
+}
+
+static int BenchBackends(void)
+{
+	backend_t backends[] =
+	{
+		{"skip list", "./libpqueue.so", 0, NULL, NULL, NULL, NULL, NULL, NULL,
+												NULL, NULL, NULL, NULL},
+		{"binary heap", "./libpqueue_heap.so", 0, NULL, NULL, NULL, NULL, NULL,
+										NULL, NULL, NULL, NULL, NULL},
+		{"pairing heap", "./libpqueue_pairing.so", 0, NULL, NULL, NULL, NULL,
+									NULL, NULL, NULL, NULL, NULL, NULL},
+		{"radix heap", "./libpqueue_radix.so", 1, NULL, NULL, NULL, NULL, NULL,
+										NULL, NULL, NULL, NULL, NULL}
+	};
+	size_t num_backends = sizeof(backends) / sizeof(backends[0]);
+	size_t sizes[] = {1000, 10000, 100000, 1000000};
+	size_t max_size = sizes[sizeof(sizes) / sizeof(sizes[0]) - 1];
+	item_t *items = (item_t *)malloc(max_size * sizeof(item_t));
+	double result[3] = {0};
+	double decrease = 0;
+	size_t s = 0;
+	size_t b = 0;
+
+	if (NULL == items)
+	{
+		return (1);
+	}
+
+	for (b = 0; b < num_backends; ++b)
+	{
+		LoadBackend(&backends[b]);
+	}
+
+	printf("\npriority queue benchmark, ns per operation");
+	printf(" (hold: %d dequeue + enqueue pairs, erase: %d by match,\n",
+														HOLD_OPS, ERASE_OPS);
+	printf("decrease: a dequeue and %d decrease-keys until empty)\n",
+														DECREASES_PER_POP);
+	printf("%-9s %-14s %10s %10s %12s %10s\n", "elements", "backend",
+								"enqueue", "hold", "erase", "decrease");
+
+	for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+	{
+		for (b = 0; b < num_backends; ++b)
+		{
+			if (NULL == backends[b].handle)
+			{
+				continue;
+			}
+
+			/* the same seed, the same keys and the same trace for each */
+			srand(1);
+			BenchTrace(&backends[b], items, sizes[s], result);
+			printf("%-9lu %-14s %10.1f %10.1f %12.1f ",
+					(unsigned long)sizes[s], backends[b].name, result[0],
+													result[1], result[2]);
+
+			if (NULL == backends[b].update_handle)
+			{
+				printf("%10s\n", "-");
+				continue;
+			}
+
+			srand(1);
+			decrease = BenchDecrease(&backends[b], items, sizes[s]);
+			printf("%10.1f\n", decrease);
+		}
+	}
+
+	for (b = 0; b < num_backends; ++b)
+	{
+		BenchLibClose(backends[b].handle);
+	}
+
+	free(items);
+
+	return (0);
+}
+
+static pq_t *CreateQueue(const backend_t *backend)
+{
+	return (backend->keyed ? backend->create_key(KeyFunc) :
+											backend->create_cmp(CmpFunc));
+}
+
+/* result: ns per fill enqueue, per hold pair and per erase */
+static void BenchTrace(const backend_t *backend, item_t *items, size_t n,
+														double result[3])
+{
+	pq_t *pq = CreateQueue(backend);
+	item_t *top = NULL;
+	clock_t start = 0;
+	clock_t erase_time = 0;
+	size_t now = 0;
+	size_t i = 0;
+
+	if (NULL == pq)
+	{
+		return;
+	}
+
+	for (i = 0; i < n; ++i)
+	{
+		items[i].key = RandKey() % (4 * n);
+	}
+
+	start = clock();
+	for (i = 0; i < n; ++i)
+	{
+		backend->enqueue(pq, &items[i]);
+	}
+	result[0] = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / n;
+
+	start = clock();
+	for (i = 0; i < HOLD_OPS; ++i)
+	{
+		top = (item_t *)backend->dequeue(pq);
+		now = top->key;
+		top->key = now + 1 + RandKey() % (4 * n);
+		backend->enqueue(pq, top);
+	}
+	result[1] = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / HOLD_OPS;
+
+	/* every item is queued, the erased one is re-armed to keep n queued */
+	for (i = 0; i < ERASE_OPS; ++i)
+	{
+		top = &items[RandKey() % n];
+
+		start = clock();
+		backend->erase(pq, MatchFunc, top);
+		erase_time += clock() - start;
+
+		top->key = now + 1 + RandKey() % (4 * n);
+		backend->enqueue(pq, top);
+	}
+	result[2] = (double)erase_time / CLOCKS_PER_SEC * 1e9 / ERASE_OPS;
+
+	backend->destroy(pq);
+}
+
+/* ns per operation - a dequeue or a decrease-key */
+static double BenchDecrease(const backend_t *backend, item_t *items, size_t n)
+{
+	pq_t *pq = backend->create_indexed(CmpFunc);
+	void **handles = (void **)malloc(n * sizeof(void *));
+	item_t **queued = (item_t **)malloc(n * sizeof(item_t *));
+	item_t *top = NULL;
+	item_t *item = NULL;
+	size_t count = n;
+	size_t ops = 0;
+	size_t i = 0;
+	clock_t start = 0;
+
+	if (NULL == pq || NULL == handles || NULL == queued)
+	{
+		free(handles);
+		free(queued);
+		if (NULL != pq)
+		{
+			backend->destroy(pq);
+		}
+		return (0);
+	}
+
+	for (i = 0; i < n; ++i)
+	{
+		items[i].key = RandKey() % (4 * n);
+		items[i].pos = i;
+		queued[i] = &items[i];
+		handles[i] = backend->enqueue_indexed(pq, &items[i]);
+	}
+
+	start = clock();
+	while (0 < count)
+	{
+		top = (item_t *)backend->dequeue(pq);
+		++ops;
+
+		/* swap-remove from the queued set */
+		--count;
+		queued[top->pos] = queued[count];
+		queued[top->pos]->pos = top->pos;
+
+		for (i = 0; i < DECREASES_PER_POP && 0 < count; ++i)
+		{
+			item = queued[RandKey() % count];
+			item->key = top->key + (item->key - top->key) / 2;
+			backend->update_handle(pq, handles[item - items]);
+			++ops;
+		}
+	}
+
+	backend->destroy(pq);
+	free(handles);
+	free(queued);
+
+	return ((double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / ops);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static size_t KeyFunc(const void *data)
+{
+	return (((const item_t *)data)->key);
+}
+
+static int CmpFunc(const void *data, const void *param)
+{
+	size_t lhs = ((const item_t *)data)->key;
+	size_t rhs = ((const item_t *)param)->key;
+
+	return ((lhs > rhs) - (lhs < rhs));
+}
+
+static int MatchFunc(const void *data, void *param)
+{
+	return (data == param);
+}
+
+static size_t RandKey(void)
+{
+	return ((size_t)rand() * ((size_t)RAND_MAX + 1) + (size_t)rand());
+}
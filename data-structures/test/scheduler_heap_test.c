@@ -17,6 +17,8 @@ Date: Mar 6, 2024
 
 #define UNUSED(x) (void)(x)
 
+#define SEC (1000000000UL) /* intervals are in nanoseconds */
+
 int was_errors = 0;
 
 char string[100] = {0};
@@ -204,23 +206,23 @@ int main()
 	
 	printf(SUB_HEAD"                     adding tasks                    "REG);
 	
-	uid2 = SchedAddTaskTEST(scheduler, 9, PrintC, string, PsuedoClear, NULL);
+	uid2 = SchedAddTaskTEST(scheduler, 9 * SEC, PrintC, string, PsuedoClear, NULL);
 	
-	uid4 = SchedAddTaskTEST(scheduler, 5, PrintS, string, PsuedoClear, NULL);
+	uid4 = SchedAddTaskTEST(scheduler, 5 * SEC, PrintS, string, PsuedoClear, NULL);
 	
-	uid5 = SchedAddTaskTEST(scheduler, 6, PrintU, string, PsuedoClear, NULL);
+	uid5 = SchedAddTaskTEST(scheduler, 6 * SEC, PrintU, string, PsuedoClear, NULL);
 	
-	uid6 = SchedAddTaskTEST(scheduler, 7, PrintC, string, PsuedoClear, NULL);
+	uid6 = SchedAddTaskTEST(scheduler, 7 * SEC, PrintC, string, PsuedoClear, NULL);
 	
-	uid7 = SchedAddTaskTEST(scheduler, 2, GhostFunc, string, PsuedoClear, NULL);
+	uid7 = SchedAddTaskTEST(scheduler, 2 * SEC, GhostFunc, string, PsuedoClear, NULL);
 	
-	uid11 = SchedAddTaskTEST(scheduler, 14, PrintS, string, PsuedoClear, NULL);
+	uid11 = SchedAddTaskTEST(scheduler, 14 * SEC, PrintS, string, PsuedoClear, NULL);
 
-	uid8 = SchedAddTaskTEST(scheduler, 16, GhostFunc, string, PsuedoClear, NULL);
+	uid8 = SchedAddTaskTEST(scheduler, 16 * SEC, GhostFunc, string, PsuedoClear, NULL);
 	
-	uid9 = SchedAddTaskTEST(scheduler, 11, PrintE, string, PsuedoClear, NULL);
+	uid9 = SchedAddTaskTEST(scheduler, 11 * SEC, PrintE, string, PsuedoClear, NULL);
 	
-	uid10 = SchedAddTaskTEST(scheduler, 12, PrintS, string, PsuedoClear, NULL);
+	uid10 = SchedAddTaskTEST(scheduler, 12 * SEC, PrintS, string, PsuedoClear, NULL);
 
 	printf(SUB_HEAD"      removing tasks (if failed - you'll know)       "REG"\n");
 	if (ERROR == SchedRemoveTask(scheduler, uid7))
@@ -278,27 +280,27 @@ int main()
 	
 	printf(SUB_HEAD"                    adding tasks                     "REG);
 	
-	uid1 = SchedAddTaskTEST(scheduler, 20, StopFunc, scheduler, PsuedoClear, NULL);
+	uid1 = SchedAddTaskTEST(scheduler, 20 * SEC, StopFunc, scheduler, PsuedoClear, NULL);
 	
-	uid2 = SchedAddTaskTEST(scheduler, 9, PrintC, string, PsuedoClear, NULL);
+	uid2 = SchedAddTaskTEST(scheduler, 9 * SEC, PrintC, string, PsuedoClear, NULL);
 	
-	uid3 = SchedAddTaskTEST(scheduler, 6, RepFunc, string, PsuedoClear, NULL);
+	uid3 = SchedAddTaskTEST(scheduler, 6 * SEC, RepFunc, string, PsuedoClear, NULL);
 	
-	uid4 = SchedAddTaskTEST(scheduler, 5, PrintS, string, PsuedoClear, NULL);
+	uid4 = SchedAddTaskTEST(scheduler, 5 * SEC, PrintS, string, PsuedoClear, NULL);
 	
-	uid11 = SchedAddTaskTEST(scheduler, 13, PrintS, string, PsuedoClear, NULL);
+	uid11 = SchedAddTaskTEST(scheduler, 13 * SEC, PrintS, string, PsuedoClear, NULL);
 	
-	uid5 = SchedAddTaskTEST(scheduler, 6, PrintU, string, PsuedoClear, NULL);
+	uid5 = SchedAddTaskTEST(scheduler, 6 * SEC, PrintU, string, PsuedoClear, NULL);
 	
-	uid6 = SchedAddTaskTEST(scheduler, 7, PrintC, string, PsuedoClear, NULL);
+	uid6 = SchedAddTaskTEST(scheduler, 7 * SEC, PrintC, string, PsuedoClear, NULL);
 	
-	uid10 = SchedAddTaskTEST(scheduler, 10, PrintE, string, PsuedoClear, NULL);
+	uid10 = SchedAddTaskTEST(scheduler, 10 * SEC, PrintE, string, PsuedoClear, NULL);
 	
-	uid7 = SchedAddTaskTEST(scheduler, 2, GhostFunc, string, PsuedoClear, NULL);
+	uid7 = SchedAddTaskTEST(scheduler, 2 * SEC, GhostFunc, string, PsuedoClear, NULL);
 
-	uid8 = SchedAddTaskTEST(scheduler, 15, GhostFunc, string, PsuedoClear, NULL);
+	uid8 = SchedAddTaskTEST(scheduler, 15 * SEC, GhostFunc, string, PsuedoClear, NULL);
 	
-	uid12 = SchedAddTaskTEST(scheduler, 11, PrintS, string, PsuedoClear, NULL);
+	uid12 = SchedAddTaskTEST(scheduler, 11 * SEC, PrintS, string, PsuedoClear, NULL);
 
 	printf(SUB_HEAD"       removing tasks (if failed - you'll know)      "REG"\n");
 	SchedRemoveTask(scheduler, uid7);
@@ -354,12 +356,12 @@ int main()
 	{
 		SchedClear(scheduler);
 		
-		SchedAddTask(scheduler, 1, GoodJob_1, &some_var, PsuedoClear, NULL);
-		SchedAddTask(scheduler, 2, GoodJob_2, &some_var, PsuedoClear, NULL);
-		SchedAddTask(scheduler, 3, GoodJob_3, &some_var, PsuedoClear, NULL);
-		SchedAddTask(scheduler, 4, GoodJob_4, &some_var, PsuedoClear, NULL);
-		SchedAddTask(scheduler, 5, GoodJob_5, &some_var, PsuedoClear, NULL);
-		SchedAddTask(scheduler, 6, GoodJob_6, &some_var, PsuedoClear, NULL);
+		SchedAddTask(scheduler, 1 * SEC, GoodJob_1, &some_var, PsuedoClear, NULL);
+		SchedAddTask(scheduler, 2 * SEC, GoodJob_2, &some_var, PsuedoClear, NULL);
+		SchedAddTask(scheduler, 3 * SEC, GoodJob_3, &some_var, PsuedoClear, NULL);
+		SchedAddTask(scheduler, 4 * SEC, GoodJob_4, &some_var, PsuedoClear, NULL);
+		SchedAddTask(scheduler, 5 * SEC, GoodJob_5, &some_var, PsuedoClear, NULL);
+		SchedAddTask(scheduler, 6 * SEC, GoodJob_6, &some_var, PsuedoClear, NULL);
 
 		SchedRun(scheduler);
 	}
@@ -475,15 +477,15 @@ size_t SchedClearTEST(void)
 	/* trying to clear a brand new scheduler */
 	SchedClear(scheduler);
 	
-	SchedAddTask(scheduler, 16, StopFunc, scheduler, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 9, PrintE, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 6, RepFunc, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 5, PrintS, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 7, PrintU, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 7, PrintC, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 2, GhostFunc, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 12, GhostFunc, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 11, PrintE, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 16 * SEC, StopFunc, scheduler, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 9 * SEC, PrintE, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 6 * SEC, RepFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 5 * SEC, PrintS, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 7 * SEC, PrintU, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 7 * SEC, PrintC, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 2 * SEC, GhostFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 12 * SEC, GhostFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 11 * SEC, PrintE, &some_var, PsuedoClear, NULL);
 
 
 	if (9 != SchedSize(scheduler))
@@ -525,18 +527,18 @@ size_t SchedClearTEST(void)
 		++error_count;
 	}
 	
-	SchedAddTask(scheduler, 4, SilentStopFunc, scheduler, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 3, SilentFunc, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 1, SilentRepFunc, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 5, SilentFunc, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 2, SilentFunc, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 1, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 4 * SEC, SilentStopFunc, scheduler, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 3 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 1 * SEC, SilentRepFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 5 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 2 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 1 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
 	
 	first_uid = SchedAddTask(scheduler, 0, GhostFunc, &some_var, PsuedoClear, NULL);
-	mid_uid = SchedAddTask(scheduler, 3, GhostFunc, &some_var, PsuedoClear, NULL);
-	last_uid = SchedAddTask(scheduler, 6, GhostFunc, &some_var, PsuedoClear, NULL);
+	mid_uid = SchedAddTask(scheduler, 3 * SEC, GhostFunc, &some_var, PsuedoClear, NULL);
+	last_uid = SchedAddTask(scheduler, 6 * SEC, GhostFunc, &some_var, PsuedoClear, NULL);
 	
-	SchedAddTask(scheduler, 5, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 5 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
 
 	SchedRemoveTask(scheduler, first_uid);
 	SchedRemoveTask(scheduler, mid_uid);
@@ -587,18 +589,18 @@ size_t SchedRemoveTaskTEST(void)
 	printf("\n"HEAD"        Edge cases for 'SchedRemoveTask'         "REG);
 
 
-	SchedAddTask(scheduler, 4, SilentStopFunc, scheduler, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 3, SilentFunc, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 1, SilentRepFunc, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 5, SilentFunc, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 2, SilentFunc, &some_var, PsuedoClear, NULL);
-	SchedAddTask(scheduler, 1, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 4 * SEC, SilentStopFunc, scheduler, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 3 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 1 * SEC, SilentRepFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 5 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 2 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 1 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
 	
 	first_uid = SchedAddTask(scheduler, 0, GhostFunc, &some_var, PsuedoClear, NULL);
-	mid_uid = SchedAddTask(scheduler, 3, GhostFunc, &some_var, PsuedoClear, NULL);
-	last_uid = SchedAddTask(scheduler, 6, GhostFunc, &some_var, PsuedoClear, NULL);
+	mid_uid = SchedAddTask(scheduler, 3 * SEC, GhostFunc, &some_var, PsuedoClear, NULL);
+	last_uid = SchedAddTask(scheduler, 6 * SEC, GhostFunc, &some_var, PsuedoClear, NULL);
 	
-	SchedAddTask(scheduler, 5, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 5 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
 	
 
 	if (10 != SchedSize(scheduler))
@@ -700,8 +702,8 @@ size_t ParamCleanupTEST(void)
     printf("\n"HEAD"              Clean Func Functionality              "REG);
 
     first_uid = SchedAddTask(scheduler, 0, GhostFunc, &first_struct, CleanChangeParam, &first_struct);
-    mid_uid = SchedAddTask(scheduler, 3, SilentStopFunc, scheduler, CleanChangeParam, &mid_struct);
-    last_uid = SchedAddTask(scheduler, 6, GhostFunc, &last_struct, CleanChangeParam, &last_struct);
+    mid_uid = SchedAddTask(scheduler, 3 * SEC, SilentStopFunc, scheduler, CleanChangeParam, &mid_struct);
+    last_uid = SchedAddTask(scheduler, 6 * SEC, GhostFunc, &last_struct, CleanChangeParam, &last_struct);
 
     SchedRemoveTask(scheduler, first_uid);
     SchedRun(scheduler);
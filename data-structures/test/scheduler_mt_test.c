@@ -0,0 +1,444 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Build: make TARGET=scheduler_mt AF=-pthread
+Run:   ./scheduler_mt.out [max_workers]
+*/
+
+#define _POSIX_C_SOURCE 200112L /* nanosleep, sysconf */
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* atol */
+#include <string.h> /* strcat */
+#include <pthread.h> /* pthread_mutex_t */
+#include <time.h> /* nanosleep */
+#include <unistd.h> /* sysconf */
+
+#include "scheduler_mt.h" /* scheduler_t */
+#include "task.h" /* TaskTimeNow */
+
+#define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
+#define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
+
+#define MS (1000000UL) /* intervals are in nanoseconds */
+#define SLOW_TASK_MS 300
+#define QUICK_TASKS 10
+#define BENCH_TASKS 256
+#define BENCH_TASK_MS 2
+
+/******************** TYPEDEFS ********************/
+typedef struct probe
+{
+    size_t due;
+    size_t fired;
+} probe_t;
+
+typedef struct counter
+{
+    size_t count;
+    size_t limit;
+} counter_t;
+
+typedef struct canceller
+{
+    scheduler_t *sched;
+    ilrd_uid_t victim;
+    int status;
+} canceller_t;
+
+/******************** GLOBALS ********************/
+static pthread_mutex_t g_string_lock = PTHREAD_MUTEX_INITIALIZER;
+static char g_string[100] = {0};
+static size_t g_ghost_runs = 0;
+
+/******************** FORWARD DECLARATIONS ********************/
+static int TestFlow(void);
+static int TestSlowTask(void);
+static int TestRepeat(void);
+static int TestRemoveRunning(void);
+static int TestStopAndClear(void);
+static void BenchWorkers(size_t max_workers);
+static int AppendAction(void *letter);
+static int SlowAction(void *param);
+static int ProbeAction(void *probe);
+static int CountAction(void *counter);
+static int SleepRepeatAction(void *counter);
+static int CancelAction(void *canceller);
+static int StopAction(void *sched);
+static int ClearAction(void *sched);
+static int GhostAction(void *param);
+static int WorkAction(void *param);
+static void SleepMs(size_t ms);
+
+int main(int argc, char *argv[])
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t max_workers = (argc > 1) ? (size_t)atol(argv[1]) :
+                                                (size_t)(cpus > 0 ? cpus : 1);
+    int status = 0;
+
+    status = TestFlow();
+    printf("SchedMT| TestFlow: %s\n", 0 == status ? PASS : FAIL);
+    if (0 != status)
+    {
+        printf("failed at check %d\n", status);
+        return (status);
+    }
+
+    status = TestSlowTask();
+    printf("SchedMT| TestSlowTask: %s\n", 0 == status ? PASS : FAIL);
+    if (0 != status)
+    {
+        printf("failed at check %d\n", status);
+        return (status);
+    }
+
+    status = TestRepeat();
+    printf("SchedMT| TestRepeat: %s\n", 0 == status ? PASS : FAIL);
+    if (0 != status)
+    {
+        printf("failed at check %d\n", status);
+        return (status);
+    }
+
+    status = TestRemoveRunning();
+    printf("SchedMT| TestRemoveRunning: %s\n", 0 == status ? PASS : FAIL);
+    if (0 != status)
+    {
+        printf("failed at check %d\n", status);
+        return (status);
+    }
+
+    status = TestStopAndClear();
+    printf("SchedMT| TestStopAndClear: %s\n", 0 == status ? PASS : FAIL);
+    if (0 != status)
+    {
+        printf("failed at check %d\n", status);
+        return (status);
+    }
+
+    BenchWorkers(max_workers);
+
+    return (0);
+}
+
+/******************** TEST FUNCTIONS ********************/
+/* a single worker runs the tasks one at a time, in the order they are due */
+static int TestFlow(void)
+{
+    static char letters[] = "SUCE";
+    scheduler_t *sched = SchedCreateWorkers(1);
+    ilrd_uid_t ghost = bad_uid;
+    size_t i = 0;
+
+    if (NULL == sched)
+    {
+        return (1);
+    }
+
+    g_string[0] = '\0';
+    for (i = 4; 0 < i; --i)
+    {
+        SchedAddTask(sched, i * 10 * MS, AppendAction, &letters[i - 1],
+                                                                NULL, NULL);
+    }
+    ghost = SchedAddTask(sched, 25 * MS, GhostAction, NULL, NULL, NULL);
+
+    if (5 != SchedSize(sched) || SchedIsEmpty(sched))
+    {
+        SchedDestroy(sched);
+        return (2);
+    }
+
+    if (SUCCESS != SchedRemoveTask(sched, ghost) ||
+        ERROR != SchedRemoveTask(sched, ghost))
+    {
+        SchedDestroy(sched);
+        return (3);
+    }
+
+    if (SUCCESS != SchedRun(sched) || 0 != strcmp(g_string, "SUCE") ||
+        !SchedIsEmpty(sched))
+    {
+        SchedDestroy(sched);
+        return (4);
+    }
+
+    SchedDestroy(sched);
+
+    return (0 == g_ghost_runs ? 0 : 5);
+}
+
+/* a task stuck on one worker does not hold back the tasks due after it */
+static int TestSlowTask(void)
+{
+    probe_t probes[QUICK_TASKS];
+    scheduler_t *sched = SchedCreateWorkers(4);
+    size_t now = TaskTimeNow();
+    size_t i = 0;
+    int status = 0;
+
+    if (NULL == sched)
+    {
+        return (1);
+    }
+
+    SchedAddTask(sched, 10 * MS, SlowAction, NULL, NULL, NULL);
+    for (i = 0; i < QUICK_TASKS; ++i)
+    {
+        probes[i].due = now + (20 + 10 * i) * MS;
+        probes[i].fired = 0;
+        SchedAddTask(sched, probes[i].due - TaskTimeNow(), ProbeAction,
+                                                    &probes[i], NULL, NULL);
+    }
+
+    SchedRun(sched);
+
+    for (i = 0; i < QUICK_TASKS && 0 == status; ++i)
+    {
+        if (probes[i].fired < probes[i].due ||
+            probes[i].fired - probes[i].due > SLOW_TASK_MS / 3 * MS)
+        {
+            status = 2;
+        }
+    }
+
+    SchedDestroy(sched);
+
+    return (status);
+}
+
+static int TestRepeat(void)
+{
+    counter_t counters[8];
+    scheduler_t *sched = SchedCreateWorkers(3);
+    size_t i = 0;
+    int status = 0;
+
+    if (NULL == sched)
+    {
+        return (1);
+    }
+
+    for (i = 0; i < 8; ++i)
+    {
+        counters[i].count = 0;
+        counters[i].limit = 5 + i;
+        SchedAddTask(sched, i * MS, CountAction, &counters[i], NULL, NULL);
+    }
+
+    if (SUCCESS != SchedRun(sched) || !SchedIsEmpty(sched))
+    {
+        status = 2;
+    }
+
+    for (i = 0; i < 8 && 0 == status; ++i)
+    {
+        if (counters[i].count != counters[i].limit)
+        {
+            status = 3;
+        }
+    }
+
+    SchedDestroy(sched);
+
+    return (status);
+}
+
+/* the repeating task is removed by another task while it is running */
+static int TestRemoveRunning(void)
+{
+    counter_t counter = {0, 1000};
+    canceller_t canceller;
+    scheduler_t *sched = SchedCreateWorkers(2);
+
+    if (NULL == sched)
+    {
+        return (1);
+    }
+
+    canceller.sched = sched;
+    canceller.status = ERROR;
+    canceller.victim = SchedAddTask(sched, 0, SleepRepeatAction, &counter,
+                                                                NULL, NULL);
+    SchedAddTask(sched, 20 * MS, CancelAction, &canceller, NULL, NULL);
+
+    if (SUCCESS != SchedRun(sched) || SUCCESS != canceller.status ||
+        !SchedIsEmpty(sched) || 1 != counter.count)
+    {
+        SchedDestroy(sched);
+        return (2);
+    }
+
+    SchedDestroy(sched);
+
+    return (0);
+}
+
+static int TestStopAndClear(void)
+{
+    scheduler_t *sched = SchedCreateWorkers(2);
+    size_t ghosts = g_ghost_runs;
+
+    if (NULL == sched)
+    {
+        return (1);
+    }
+
+    SchedAddTask(sched, 10 * MS, StopAction, sched, NULL, NULL);
+    SchedAddTask(sched, 1000 * MS, GhostAction, NULL, NULL, NULL);
+    SchedAddTask(sched, 2000 * MS, GhostAction, NULL, NULL, NULL);
+
+    if (STOP != SchedRun(sched) || 2 != SchedSize(sched))
+    {
+        SchedDestroy(sched);
+        return (2);
+    }
+
+    SchedAddTask(sched, 10 * MS, ClearAction, sched, NULL, NULL);
+
+    if (SUCCESS != SchedRun(sched) || !SchedIsEmpty(sched) ||
+        ghosts != g_ghost_runs)
+    {
+        SchedDestroy(sched);
+        return (3);
+    }
+
+    SchedDestroy(sched);
+
+    return (0);
+}
+
+/******************** BENCHMARK ********************/
+static void BenchWorkers(size_t max_workers)
+{
+    scheduler_t *sched = NULL;
+    size_t workers = 0;
+    size_t start = 0;
+    size_t i = 0;
+    double elapsed = 0;
+
+    printf("\n%d tasks of %d ms each, all due at once:\n", BENCH_TASKS,
+                                                                BENCH_TASK_MS);
+    printf("%-8s %12s %12s\n", "workers", "total ms", "speedup");
+
+    for (workers = 1; workers <= max_workers; workers *= 2)
+    {
+        sched = SchedCreateWorkers(workers);
+        if (NULL == sched)
+        {
+            return;
+        }
+
+        for (i = 0; i < BENCH_TASKS; ++i)
+        {
+            SchedAddTask(sched, 0, WorkAction, NULL, NULL, NULL);
+        }
+
+        start = TaskTimeNow();
+        SchedRun(sched);
+        elapsed = (double)(TaskTimeNow() - start) / MS;
+
+        printf("%-8lu %12.1f %12.2f\n", (unsigned long)workers, elapsed,
+                                    (double)BENCH_TASKS * BENCH_TASK_MS / elapsed);
+
+        SchedDestroy(sched);
+    }
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static int AppendAction(void *letter)
+{
+    char str[2] = {0};
+
+    str[0] = *(char *)letter;
+
+    pthread_mutex_lock(&g_string_lock);
+    strcat(g_string, str);
+    pthread_mutex_unlock(&g_string_lock);
+
+    return (SUCCESS);
+}
+
+static int SlowAction(void *param)
+{
+    (void)param;
+    SleepMs(SLOW_TASK_MS);
+
+    return (SUCCESS);
+}
+
+static int ProbeAction(void *probe)
+{
+    ((probe_t *)probe)->fired = TaskTimeNow();
+
+    return (SUCCESS);
+}
+
+static int CountAction(void *counter)
+{
+    counter_t *count = (counter_t *)counter;
+
+    ++count->count;
+
+    return (count->count < count->limit ? REPEAT : SUCCESS);
+}
+
+static int SleepRepeatAction(void *counter)
+{
+    ++((counter_t *)counter)->count;
+    SleepMs(100);
+
+    return (REPEAT);
+}
+
+static int CancelAction(void *canceller)
+{
+    canceller_t *cancel = (canceller_t *)canceller;
+
+    cancel->status = SchedRemoveTask(cancel->sched, cancel->victim);
+
+    return (SUCCESS);
+}
+
+static int StopAction(void *sched)
+{
+    SchedStop((scheduler_t *)sched);
+
+    return (STOP);
+}
+
+static int ClearAction(void *sched)
+{
+    SchedClear((scheduler_t *)sched);
+
+    return (SUCCESS);
+}
+
+static int GhostAction(void *param)
+{
+    (void)param;
+    __atomic_fetch_add(&g_ghost_runs, 1, __ATOMIC_RELAXED);
+
+    return (SUCCESS);
+}
+
+/* stands in for a task that blocks, e.g. on I/O */
+static int WorkAction(void *param)
+{
+    (void)param;
+    SleepMs(BENCH_TASK_MS);
+
+    return (SUCCESS);
+}
+
+static void SleepMs(size_t ms)
+{
+    struct timespec duration;
+
+    duration.tv_sec = (time_t)(ms / 1000);
+    duration.tv_nsec = (long)(ms % 1000 * MS);
+
+    nanosleep(&duration, NULL);
+}
@@ -0,0 +1,1121 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Build: make TARGET=scheduler && make TARGET=scheduler_heap &&
+       make TARGET=scheduler_wheel AF=-ldl
+Run:   ./scheduler_wheel.out                  (tests, then benchmark)
+       ./scheduler_wheel.out bench [list_max] (benchmark only)
+
+The benchmark loads every backend that was built with dlopen, the
+list backend (a skip list, see srtlist_skip.h) only up to list_max tasks.
+*/
+
+#define _GNU_SOURCE /* RTLD_DEEPBIND */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h> /* clock */
+
+#include "bench_lib.h" /* BenchLibOpen */
+#include "scheduler_wheel.h"
+#include "task.h" /* TaskTimeNow */
+
+#define GOOD "\033[1;30m\033[102m"
+#define BAD "\033[1;37m\033[41m"
+#define REG "\033[1;0m""\n"
+#define HEAD "\033[1;30m\033[47m"
+#define SUB_HEAD "\033[1;30m\033[43m"
+
+#define UNUSED(x) (void)(x)
+
+#define SEC (1000000000UL) /* intervals are in nanoseconds */
+
+#define LIST_MAX_TASKS ((size_t)-1) /* no cap by default, adds are O(log n) */
+#define CANCEL_SAMPLE (100) /* cancels timed, linear scans in list and heap */
+#define MAX_INTERVAL (1 << 21) /* seconds, spreads tasks over all wheel levels */
+#define LATENCY_TASKS (2000)
+#define LATENCY_WINDOW (2 * SEC) /* the latency tasks are spread over it */
+
+typedef struct backend
+{
+	const char *name;
+	const char *lib;
+	size_t max_tasks;
+	void *handle;
+	scheduler_t *(*create)(void);
+	void (*destroy)(scheduler_t *sched);
+	ilrd_uid_t (*add)(scheduler_t *sched, size_t interval, 
+					  action_func_t action, void *action_param, 
+					  cleanup_func_t cleanup_func, void *cleanup_param);
+	int (*remove)(scheduler_t *sched, ilrd_uid_t task_id);
+	int (*run)(scheduler_t *sched);
+} backend_t;
+
+int was_errors = 0;
+
+char string[100] = {0};
+
+scheduler_t *SchedCreateTEST(void);
+
+ilrd_uid_t SchedAddTaskTEST(scheduler_t *sched, 
+                        size_t interval, 
+                        action_func_t action, 
+                        void *action_param, 
+                        cleanup_func_t cleanup_func, 
+                        void *cleanup_param);
+
+size_t SchedClearTEST(void);
+
+size_t SchedRemoveTaskTEST(void);
+
+size_t ParamCleanupTEST(void);
+
+size_t ManyTasksTEST(void);
+
+int BenchBackends(size_t list_max);
+
+static int LoadBackend(backend_t *backend);
+
+static void BenchBackend(backend_t *backend, size_t n, double result[3]);
+
+static void BenchLatency(backend_t *backend);
+
+/***********************************************************/
+
+void PsuedoClear(void *action_param)
+{
+	UNUSED(action_param);
+}
+
+int PrintS(void *params)
+{
+	UNUSED(params);
+	
+	printf("S\n");
+	strcat((char *) params, "S");
+	
+	return SUCCESS;
+}
+
+int PrintU(void *params)
+
+{
+	UNUSED(params);
+	
+	printf("U\n");
+    strcat((char *) params, "U");
+	
+	return SUCCESS;
+}
+
+int PrintC(void *params)
+{
+	UNUSED(params);
+	
+	printf("C\n");
+    strcat((char *) params, "C");
+	
+	return SUCCESS;
+}
+
+int PrintE(void *params)
+{
+	UNUSED(params);
+	
+	printf("E\n");
+    strcat((char *) params, "E");
+	
+	return SUCCESS;
+}
+
+int RepFunc(void *params)
+{
+	UNUSED(params);
+	
+	printf("[Repeat]\n");
+    strcat((char *) params, "[Repeat]");
+
+	return REPEAT;
+}
+
+int StopFunc(void *scheduler)
+{
+    SchedStop((scheduler_t *) scheduler);
+	return STOP;
+}
+
+int GhostFunc(void *params)
+{
+	UNUSED(params);
+	
+	printf(BAD"you shouldn't see me. removal error."REG);
+	strcat((char *) params, "*");
+	
+	was_errors = 1;
+	
+	return SUCCESS;
+}
+
+int SilentFunc(void *params)
+{
+	UNUSED(params);
+	return SUCCESS;
+}
+
+int SilentStopFunc(void *scheduler)
+{
+	SchedStop((scheduler_t *) scheduler);
+	return STOP;
+}
+
+int SilentRepFunc(void *params)
+{
+	UNUSED(params);
+	return REPEAT;
+}
+
+int GoodJob_1(void *params)
+{
+	UNUSED(params);
+	printf("░██████╗░░█████╗░░█████╗░██████╗░  ░░░░░██╗░█████╗░██████╗░██╗\n");
+	return SUCCESS;
+}
+
+int GoodJob_2(void *params)
+{
+	UNUSED(params);
+	printf("██╔════╝░██╔══██╗██╔══██╗██╔══██╗  ░░░░░██║██╔══██╗██╔══██╗██║\n");
+	return SUCCESS;
+}
+
+int GoodJob_3(void *params)
+{
+	UNUSED(params);
+	printf("██║░░██╗░██║░░██║██║░░██║██║░░██║  ░░░░░██║██║░░██║██████╦╝██║\n");
+	return SUCCESS;
+}
+
+int GoodJob_4(void *params)
+{
+	UNUSED(params);
+	printf("██║░░╚██╗██║░░██║██║░░██║██║░░██║  ██╗░░██║██║░░██║██╔══██╗╚═╝\n");
+	return SUCCESS;
+}
+
+
+int GoodJob_5(void *params)
+{
+	UNUSED(params);
+	printf("╚██████╔╝╚█████╔╝╚█████╔╝██████╔╝  ╚█████╔╝╚█████╔╝██████╦╝██╗\n");
+	return SUCCESS;
+}
+
+int GoodJob_6(void *params)
+{
+	UNUSED(params);
+	printf("░╚═════╝░░╚════╝░░╚════╝░╚═════╝░  ░╚════╝░░╚════╝░╚═════╝░╚═╝\n\n");
+	return SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+	int some_var = 1;
+	
+	ilrd_uid_t uid1 = {0};
+	ilrd_uid_t uid2 = {0};
+	ilrd_uid_t uid3 = {0};
+	ilrd_uid_t uid4 = {0};
+	ilrd_uid_t uid5 = {0};
+	ilrd_uid_t uid6 = {0};
+	ilrd_uid_t uid7 = {0};
+	ilrd_uid_t uid8 = {0};
+	ilrd_uid_t uid9 = {0};
+	ilrd_uid_t uid10 = {0};
+	ilrd_uid_t uid11 = {0};
+	ilrd_uid_t uid12 = {0};
+		
+	scheduler_t *scheduler = NULL;
+	size_t list_max = (argc > 2) ? (size_t)atol(argv[2]) : LIST_MAX_TASKS;
+
+	if (argc > 1 && 0 == strcmp("bench", argv[1]))
+	{
+		return (BenchBackends(list_max));
+	}
+
+	UNUSED(uid1);UNUSED(uid2);UNUSED(uid3);UNUSED(uid4);UNUSED(uid5);UNUSED(uid6);
+	UNUSED(uid7);UNUSED(uid8);UNUSED(uid9);UNUSED(uid10);UNUSED(uid11);UNUSED(uid12);
+	
+	printf("\n"HEAD"     Flow Test (utilizes most of the functions)      "REG);
+	printf    (HEAD"    (without repeating and stop-signaling tasks)     "REG);
+
+	printf(SUB_HEAD"                 creating a new list                 "REG);
+	scheduler = SchedCreateTEST();
+	
+	printf(SUB_HEAD"                     adding tasks                    "REG);
+	
+	uid2 = SchedAddTaskTEST(scheduler, 9 * SEC, PrintC, string, PsuedoClear, NULL);
+	
+	uid4 = SchedAddTaskTEST(scheduler, 5 * SEC, PrintS, string, PsuedoClear, NULL);
+	
+	uid5 = SchedAddTaskTEST(scheduler, 7 * SEC, PrintU, string, PsuedoClear, NULL);
+	
+	uid6 = SchedAddTaskTEST(scheduler, 7 * SEC, PrintC, string, PsuedoClear, NULL);
+	
+	uid7 = SchedAddTaskTEST(scheduler, 2 * SEC, GhostFunc, string, PsuedoClear, NULL);
+	
+	uid11 = SchedAddTaskTEST(scheduler, 14 * SEC, PrintS, string, PsuedoClear, NULL);
+
+	uid8 = SchedAddTaskTEST(scheduler, 16 * SEC, GhostFunc, string, PsuedoClear, NULL);
+	
+	uid9 = SchedAddTaskTEST(scheduler, 11 * SEC, PrintE, string, PsuedoClear, NULL);
+	
+	uid10 = SchedAddTaskTEST(scheduler, 12 * SEC, PrintS, string, PsuedoClear, NULL);
+
+	printf(SUB_HEAD"      removing tasks (if failed - you'll know)       "REG"\n");
+	SchedRemoveTask(scheduler, uid7);
+	SchedRemoveTask(scheduler, uid8);
+	
+	printf(SUB_HEAD"                    veryfing size                    "REG);
+	if (0 == SchedIsEmpty(scheduler) && 7 == SchedSize(scheduler))
+	{
+		printf(GOOD"SUCCESS"REG);
+	}
+	else
+	{
+		printf(BAD"FAILURE"REG);
+		was_errors = 1;
+	}
+	
+	printf(SUB_HEAD"                  running scheduler                  "REG);
+	printf(SUB_HEAD"          should print \"SUCCESS\" vertically          "REG);
+	SchedRun(scheduler);
+	
+	printf(SUB_HEAD"                veryfing print output                "REG);
+	if (0 == strcmp("SUCCESS", string))
+	{
+		printf(GOOD"SUCCESS"REG);
+	}
+	else
+	{
+		printf(BAD"FAILURE"REG);
+		was_errors = 1;
+	}
+	
+	printf(SUB_HEAD"                    veryfing size                    "REG);
+	if (1 == SchedIsEmpty(scheduler) && 0 == SchedSize(scheduler))
+	{
+		printf(GOOD"SUCCESS"REG);
+	}
+	else
+	{
+		printf(BAD"FAILURE"REG);
+		was_errors = 1;
+	}
+	
+
+	
+	printf("\n"HEAD"      Flow Test (utilizes most of the functions)     "REG);
+	printf    (HEAD"  (with a repeating task and a stop-signaling task)  "REG);
+	
+	printf(SUB_HEAD"                    adding tasks                     "REG);
+	
+	uid1 = SchedAddTaskTEST(scheduler, 20 * SEC, StopFunc, scheduler, PsuedoClear, NULL);
+	
+	uid2 = SchedAddTaskTEST(scheduler, 9 * SEC, PrintC, string, PsuedoClear, NULL);
+	
+	uid3 = SchedAddTaskTEST(scheduler, 6 * SEC, RepFunc, string, PsuedoClear, NULL);
+	
+	uid4 = SchedAddTaskTEST(scheduler, 5 * SEC, PrintS, string, PsuedoClear, NULL);
+	
+	uid11 = SchedAddTaskTEST(scheduler, 13 * SEC, PrintS, string, PsuedoClear, NULL);
+	
+	uid5 = SchedAddTaskTEST(scheduler, 7 * SEC, PrintU, string, PsuedoClear, NULL);
+	
+	uid6 = SchedAddTaskTEST(scheduler, 7 * SEC, PrintC, string, PsuedoClear, NULL);
+	
+	uid10 = SchedAddTaskTEST(scheduler, 9 * SEC, PrintE, string, PsuedoClear, NULL);
+	
+	uid7 = SchedAddTaskTEST(scheduler, 2 * SEC, GhostFunc, string, PsuedoClear, NULL);
+
+	uid8 = SchedAddTaskTEST(scheduler, 15 * SEC, GhostFunc, string, PsuedoClear, NULL);
+	
+	uid12 = SchedAddTaskTEST(scheduler, 11 * SEC, PrintS, string, PsuedoClear, NULL);
+
+	printf(SUB_HEAD"       removing tasks (if failed - you'll know)      "REG"\n");
+	SchedRemoveTask(scheduler, uid7);
+	SchedRemoveTask(scheduler, uid8);
+	
+	printf(SUB_HEAD"                    veryfing size                    "REG);
+	if (0 == SchedIsEmpty(scheduler) && 9 == SchedSize(scheduler))
+	{
+		printf(GOOD"SUCCESS"REG);
+	}
+	else
+	{
+		printf(BAD"FAILURE"REG);
+		was_errors = 1;
+	}
+	
+	printf(SUB_HEAD"                  running scheduler                  "REG);
+	printf(SUB_HEAD"    should print the following string vertically:    "REG);
+	printf(SUB_HEAD"           S[Repeat]UCCES[Repeat]S[Repeat]           "REG);
+	
+	SchedRun(scheduler);
+
+	printf(SUB_HEAD"                veryfing print output                "REG);
+	if (0 == strcmp("SUCCESSS[Repeat]UCCES[Repeat]S[Repeat]", string))
+	{
+		printf(GOOD"SUCCESS"REG);
+	}
+	else
+	{
+		printf(BAD"FAILURE"REG);
+		was_errors = 1;
+	}
+
+	printf(SUB_HEAD"                    veryfing size                    "REG);
+	if (0 == SchedIsEmpty(scheduler) && 1 == SchedSize(scheduler))
+	{
+		printf(GOOD"SUCCESS"REG);
+	}
+	else
+	{
+		printf(BAD"FAILURE"REG);
+		was_errors = 1;
+	}
+	
+	
+	was_errors += SchedRemoveTaskTEST();
+	
+	was_errors += SchedClearTEST();
+
+    was_errors += ParamCleanupTEST();
+
+    was_errors += ManyTasksTEST();
+	
+	if (0 == was_errors)
+	{
+		SchedClear(scheduler);
+		
+		SchedAddTask(scheduler, 1 * SEC, GoodJob_1, &some_var, PsuedoClear, NULL);
+		SchedAddTask(scheduler, 2 * SEC, GoodJob_2, &some_var, PsuedoClear, NULL);
+		SchedAddTask(scheduler, 3 * SEC, GoodJob_3, &some_var, PsuedoClear, NULL);
+		SchedAddTask(scheduler, 4 * SEC, GoodJob_4, &some_var, PsuedoClear, NULL);
+		SchedAddTask(scheduler, 5 * SEC, GoodJob_5, &some_var, PsuedoClear, NULL);
+		SchedAddTask(scheduler, 6 * SEC, GoodJob_6, &some_var, PsuedoClear, NULL);
+
+		SchedRun(scheduler);
+	}
+	
+	SchedDestroy(scheduler);
+	
+	if (0 != was_errors)
+	{
+		return 1;
+	}
+	
+	return (BenchBackends(list_max));
+}
+
+scheduler_t *SchedCreateTEST(void)
+{
+	size_t error_count = 0;
+	
+	scheduler_t *scheduler = SchedCreate();
+	
+	if (NULL == scheduler)
+	{
+		printf(BAD"allocation failed"REG);
+		++error_count;
+	}
+
+	
+	if (0 == SchedIsEmpty(scheduler))
+	{
+		printf(BAD"new scheduler isn't empty"REG);
+		++error_count;
+	}
+	
+	if (0 != SchedSize(scheduler))
+	{
+		printf(BAD"new scheduler size isn't 0"REG);
+		++error_count;
+	}
+	
+	if (0 == error_count)
+	{
+		printf(GOOD"SUCCESS"REG);
+	}
+
+	else 
+	{
+		printf(BAD"FAILURE. %lu errors was found"REG, error_count);
+		was_errors = 1;
+	}
+	
+	return scheduler;
+}
+
+
+ilrd_uid_t SchedAddTaskTEST(scheduler_t *sched, 
+                        size_t interval, 
+                        action_func_t action, 
+                        void *action_param, 
+                        cleanup_func_t cleanup_func, 
+                        void *cleanup_param)
+{
+	size_t error_count = 0;
+	
+	size_t old_scheduler_size = SchedSize(sched);
+	
+	ilrd_uid_t uid = {0};	
+
+	uid = SchedAddTask(sched, interval, action, action_param, 
+					   cleanup_func, cleanup_param);
+	
+	if (1 == UIDIsEqual(uid, bad_uid))
+	{
+		printf(BAD"uid == bad_uid\n");
+		return uid;
+	}
+	
+	if (1 == SchedIsEmpty(sched))
+	{
+		printf(BAD"scheduler is empty after adding test"REG);
+		++error_count;
+	}
+	
+	if (old_scheduler_size + 1 != SchedSize(sched))
+	{
+		printf(BAD"scheduler size is incorrect"REG);
+		++error_count;
+	}
+	
+	if (0 == error_count)
+	{
+		printf(GOOD"SUCCESS"REG);
+	}
+	
+	else 
+	{
+		printf(BAD"FAILURE. %lu errors was found"REG, error_count);
+		was_errors = 1;
+	}
+	
+	return uid;
+}
+
+
+size_t SchedClearTEST(void)
+{
+	size_t error_count = 0;
+	
+	scheduler_t *scheduler = SchedCreate();
+	
+	int some_var = 1;
+	
+	ilrd_uid_t first_uid = {0};
+	ilrd_uid_t mid_uid = {0};
+	ilrd_uid_t last_uid = {0};
+	
+	printf("\n"HEAD"           Edge cases for 'SchedClear'           "REG);
+
+	/* trying to clear a brand new scheduler */
+	SchedClear(scheduler);
+	
+	SchedAddTask(scheduler, 16 * SEC, StopFunc, scheduler, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 9 * SEC, PrintE, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 6 * SEC, RepFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 5 * SEC, PrintS, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 7 * SEC, PrintU, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 7 * SEC, PrintC, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 2 * SEC, GhostFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 12 * SEC, GhostFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 11 * SEC, PrintE, &some_var, PsuedoClear, NULL);
+
+
+	if (9 != SchedSize(scheduler))
+	{
+		printf(BAD"error inserting tasks"REG);
+		++error_count;
+	}
+	
+	SchedClear(scheduler);
+
+
+	if (0 == SchedIsEmpty(scheduler))
+	{
+		printf(BAD"scheduler isn't empty after Clear"REG);
+		++error_count;
+	}
+	
+	if (0 != SchedSize(scheduler))
+	{
+		printf(BAD"scheduler size isn't 0 after Clear"REG);
+		++error_count;
+	}
+
+	if (0 == error_count)
+	{	
+		/* trying to clear an empty scheduler */
+		SchedClear(scheduler);
+	}
+	
+	if (0 == SchedIsEmpty(scheduler))
+	{
+		printf(BAD"scheduler isn't empty after Clear"REG);
+		++error_count;
+	}
+	
+	if (0 != SchedSize(scheduler))
+	{
+		printf(BAD"scheduler size isn't 0 Clear"REG);
+		++error_count;
+	}
+	
+	SchedAddTask(scheduler, 4 * SEC, SilentStopFunc, scheduler, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 3 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 1 * SEC, SilentRepFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 5 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 2 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 1 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	
+	first_uid = SchedAddTask(scheduler, 0, GhostFunc, &some_var, PsuedoClear, NULL);
+	mid_uid = SchedAddTask(scheduler, 3 * SEC, GhostFunc, &some_var, PsuedoClear, NULL);
+	last_uid = SchedAddTask(scheduler, 6 * SEC, GhostFunc, &some_var, PsuedoClear, NULL);
+	
+	SchedAddTask(scheduler, 5 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+
+	SchedRemoveTask(scheduler, first_uid);
+	SchedRemoveTask(scheduler, mid_uid);
+	SchedRemoveTask(scheduler, last_uid);
+	
+	if (7 != SchedSize(scheduler))
+	{
+		printf(BAD"error inserting tasks"REG);
+		++error_count;
+	}
+	
+	SchedRun(scheduler);
+	
+	if (0 == error_count)
+	{
+		printf(GOOD"SUCCESS"REG"\n");
+	}
+	else 
+	{
+		printf(BAD"FAILURE. %lu errors was found"REG, error_count);
+		was_errors = 1;
+	}
+	
+	SchedDestroy(scheduler);
+
+    return error_count;
+}
+
+
+size_t SchedRemoveTaskTEST(void)
+{
+	size_t error_count = 0;
+	
+	
+	size_t old_scheduler_size = 0;
+	
+	scheduler_t *scheduler = SchedCreate();
+	
+	ilrd_uid_t first_uid = {0};
+	ilrd_uid_t mid_uid = {0};
+	ilrd_uid_t last_uid = {0};
+
+	ilrd_uid_t dummy_uid = UIDGenerate();
+	ilrd_uid_t blank_uid = {0};
+	
+	int some_var = 1;
+	
+	printf("\n"HEAD"        Edge cases for 'SchedRemoveTask'         "REG);
+
+
+	SchedAddTask(scheduler, 4 * SEC, SilentStopFunc, scheduler, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 3 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 1 * SEC, SilentRepFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 5 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 2 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	SchedAddTask(scheduler, 1 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	
+	first_uid = SchedAddTask(scheduler, 0, GhostFunc, &some_var, PsuedoClear, NULL);
+	mid_uid = SchedAddTask(scheduler, 3 * SEC, GhostFunc, &some_var, PsuedoClear, NULL);
+	last_uid = SchedAddTask(scheduler, 6 * SEC, GhostFunc, &some_var, PsuedoClear, NULL);
+	
+	SchedAddTask(scheduler, 5 * SEC, SilentFunc, &some_var, PsuedoClear, NULL);
+	
+
+	if (10 != SchedSize(scheduler))
+	{
+		printf(BAD"error inserting tasks"REG);
+		++error_count;
+	}
+	
+	old_scheduler_size = SchedSize(scheduler);
+	SchedRemoveTask(scheduler, mid_uid);
+
+	if (old_scheduler_size != SchedSize(scheduler) + 1)
+	{
+		printf(BAD"error removing tasks from the middle"REG);
+		++error_count;
+	}
+	
+	old_scheduler_size = SchedSize(scheduler);
+	SchedRemoveTask(scheduler, last_uid);
+	
+	if (old_scheduler_size != SchedSize(scheduler) + 1)
+	{
+		printf(BAD"error removing the last task"REG);
+		++error_count;
+	}
+	
+	old_scheduler_size = SchedSize(scheduler);
+	SchedRemoveTask(scheduler, first_uid);
+	
+	if (old_scheduler_size != SchedSize(scheduler) + 1)
+	{
+		printf(BAD"error removing the first task"REG);
+		++error_count;
+	}
+	
+	old_scheduler_size = SchedSize(scheduler);
+	
+	/* attempting to remove nonexisting tasks */
+	SchedRemoveTask(scheduler, first_uid);
+	SchedRemoveTask(scheduler, mid_uid);
+	SchedRemoveTask(scheduler, last_uid);
+	SchedRemoveTask(scheduler, dummy_uid);
+	SchedRemoveTask(scheduler, bad_uid);
+	SchedRemoveTask(scheduler, blank_uid);
+	
+	
+	if (old_scheduler_size != SchedSize(scheduler))
+	{
+		printf(BAD"the size changed after attempting to remove nonexisting tasks"REG);
+		++error_count;
+	}
+	
+	/* trying to run the scheduler after several removals and removal-attempts */
+	SchedRun(scheduler);
+	
+	if (0 == error_count)
+	{
+		printf(GOOD"SUCCESS"REG);
+	}
+	else 
+	{
+		printf(BAD"FAILURE. %lu errors was found"REG, error_count);
+		was_errors = 1;
+	}
+	
+	SchedDestroy(scheduler);
+
+    return error_count;
+}
+
+typedef struct to_clean
+{
+    int x;
+    int y;
+}to_clean_t;
+
+void CleanChangeParam(void *params)
+{
+    ((to_clean_t *)params)->x = 0;
+}
+
+size_t ParamCleanupTEST(void)
+{
+    size_t error_count = 0;
+    scheduler_t *scheduler = SchedCreate();
+    
+    to_clean_t first_struct = {5, 5};
+    to_clean_t mid_struct = {2, 2};
+    to_clean_t last_struct = {1, 1};
+
+    ilrd_uid_t first_uid = {0};
+    ilrd_uid_t mid_uid = {0};
+    ilrd_uid_t last_uid = {0};
+
+    UNUSED(mid_uid);
+    UNUSED(last_uid);
+
+    
+    printf("\n"HEAD"              Clean Func Functionality              "REG);
+
+    first_uid = SchedAddTask(scheduler, 0, GhostFunc, &first_struct, CleanChangeParam, &first_struct);
+    mid_uid = SchedAddTask(scheduler, 3 * SEC, SilentStopFunc, scheduler, CleanChangeParam, &mid_struct);
+    last_uid = SchedAddTask(scheduler, 6 * SEC, GhostFunc, &last_struct, CleanChangeParam, &last_struct);
+
+    SchedRemoveTask(scheduler, first_uid);
+    SchedRun(scheduler);
+    SchedClear(scheduler);
+
+    if (first_struct.x)
+    {
+        printf(BAD"clean_func at remove didn't use action params or acted at all"REG);
+        ++error_count;
+    }
+
+    if (!first_struct.y)
+    {
+        printf(BAD"clean_func at remove didn't use clean params or acted at all"REG);
+        ++error_count;
+    }
+
+    if (mid_struct.x)
+    {
+        printf(BAD"clean_func at run didn't use action params or acted at all"REG);
+        ++error_count;
+    }
+
+    if (!mid_struct.y)
+    {
+        printf(BAD"clean_func at run didn't use clean params or acted at all"REG);
+        ++error_count;
+    }
+
+    if (last_struct.x)
+    {
+        printf(BAD"clean_func at clear didn't use action params or acted at all"REG);
+        ++error_count;
+    }
+
+    if (!last_struct.y)
+    {
+        printf(BAD"clean_func at clear didn't use clean params or acted at all"REG);
+        ++error_count;
+    }
+
+
+
+
+    if (0 == error_count)
+    {
+        printf(GOOD"SUCCESS\n"REG);
+    }
+    else 
+    {
+        printf(BAD"FAILURE. %lu errors were found\n"REG, error_count);
+        was_errors = 1;
+    }
+
+    SchedDestroy(scheduler);
+    return error_count;
+}
+
+/* tasks spread over every level of the wheel, removed in a shuffled order */
+size_t ManyTasksTEST(void)
+{
+	size_t error_count = 0;
+	size_t n = 100000;
+	size_t i = 0;
+	size_t j = 0;
+	int some_var = 1;
+	ilrd_uid_t temp = {0};
+	ilrd_uid_t *uids = (ilrd_uid_t *)malloc(n * sizeof(ilrd_uid_t));
+	scheduler_t *scheduler = SchedCreate();
+	
+	printf("\n"HEAD"             Many tasks on all levels             "REG);
+	
+	for (i = 0; i < n; ++i)
+	{
+		uids[i] = SchedAddTask(scheduler, (1 + (size_t)rand() % MAX_INTERVAL) * SEC, 
+							   GhostFunc, &some_var, PsuedoClear, NULL);
+	}
+	
+	if (n != SchedSize(scheduler))
+	{
+		printf(BAD"error inserting tasks"REG);
+		++error_count;
+	}
+	
+	for (i = 0; i < n; ++i)
+	{
+		j = i + (size_t)rand() % (n - i);
+		temp = uids[i];
+		uids[i] = uids[j];
+		uids[j] = temp;
+	}
+	
+	for (i = 0; i < n / 2; ++i)
+	{
+		if (SUCCESS != SchedRemoveTask(scheduler, uids[i]))
+		{
+			++error_count;
+		}
+	}
+	
+	if (n - n / 2 != SchedSize(scheduler) || 
+		ERROR != SchedRemoveTask(scheduler, uids[0]))
+	{
+		printf(BAD"error removing tasks"REG);
+		++error_count;
+	}
+	
+	SchedClear(scheduler);
+	
+	if (0 == SchedIsEmpty(scheduler) || 
+		ERROR != SchedRemoveTask(scheduler, uids[n - 1]))
+	{
+		printf(BAD"scheduler isn't empty after Clear"REG);
+		++error_count;
+	}
+	
+	if (0 == error_count)
+	{
+		printf(GOOD"SUCCESS"REG);
+	}
+	else 
+	{
+		printf(BAD"FAILURE. %lu errors were found"REG, error_count);
+		was_errors = 1;
+	}
+	
+	SchedDestroy(scheduler);
+	free(uids);
+	
+	return error_count;
+}
+
+/******************** BENCHMARK ********************/
+static int CountFunc(void *counter)
+{
+	++*(size_t *)counter;
+	
+	return SUCCESS;
+}
+
+static int LoadBackend(backend_t *backend)
+{
+	void *lib = BenchLibOpen(backend->lib);
+	
+	if (NULL == lib ||
+		0 != BenchLibSym(lib, "SchedCreate", (void **)&backend->create) ||
+		0 != BenchLibSym(lib, "SchedDestroy", (void **)&backend->destroy) ||
+		0 != BenchLibSym(lib, "SchedAddTask", (void **)&backend->add) ||
+		0 != BenchLibSym(lib, "SchedRemoveTask", (void **)&backend->remove) ||
+		0 != BenchLibSym(lib, "SchedRun", (void **)&backend->run))
+	{
+		if (NULL != lib)
+		{
+			printf("%s is incomplete, skipped\n", backend->lib);
+		}
+		BenchLibClose(lib);
+		return 1;
+	}
+	
+	backend->handle = lib;
+	
+	return 0;
+}
+
+int BenchBackends(size_t list_max)
+{
+	backend_t backends[] = 
+	{
+		{"skip list", "./libscheduler.so", 0, NULL, NULL, NULL, NULL, NULL, NULL},
+		{"heap", "./libscheduler_heap.so", (size_t)-1, NULL, NULL, NULL, NULL, NULL, NULL},
+		{"timing wheel", "./libscheduler_wheel.so", (size_t)-1, NULL, NULL, NULL, NULL, NULL, NULL}
+	};
+	size_t num_backends = sizeof(backends) / sizeof(backends[0]);
+	size_t sizes[] = {1000, 100000, 1000000};
+	double result[3] = {0};
+	size_t s = 0;
+	size_t b = 0;
+	
+	backends[0].max_tasks = list_max;
+	
+	printf("\nscheduler benchmark, ns per operation");
+	printf(" (cancel: random sample of up to %d tasks)\n", CANCEL_SAMPLE);
+	
+	for (b = 0; b < num_backends; ++b)
+	{
+		LoadBackend(&backends[b]);
+	}
+	
+	printf("%-9s %-14s %12s %12s %12s\n", "tasks", "backend", "add", "cancel", 
+																	"fire");
+	
+	for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+	{
+		for (b = 0; b < num_backends; ++b)
+		{
+			if (NULL == backends[b].handle)
+			{
+				continue;
+			}
+			
+			if (sizes[s] > backends[b].max_tasks)
+			{
+				printf("%-9lu %-14s %12s %12s %12s\n", (unsigned long)sizes[s], 
+									backends[b].name, "skipped", "-", "-");
+				continue;
+			}
+			
+			BenchBackend(&backends[b], sizes[s], result);
+			printf("%-9lu %-14s %12.1f %12.1f %12.1f\n", 
+				   (unsigned long)sizes[s], backends[b].name, result[0], 
+				   result[1], result[2]);
+		}
+	}
+	
+	printf("\nfiring lateness, %d tasks over %lu ms, us:\n", LATENCY_TASKS, 
+										(unsigned long)(LATENCY_WINDOW / 1000000));
+	printf("%-14s %10s %10s %10s %10s\n", "backend", "p50", "p99", "p999", 
+																	"max");
+	
+	for (b = 0; b < num_backends; ++b)
+	{
+		if (NULL != backends[b].handle)
+		{
+			BenchLatency(&backends[b]);
+			BenchLibClose(backends[b].handle);
+		}
+	}
+	
+	return 0;
+}
+
+static void BenchBackend(backend_t *backend, size_t n, double result[3])
+{
+	size_t cancels = (n < CANCEL_SAMPLE) ? n : CANCEL_SAMPLE;
+	size_t fired = 0;
+	size_t i = 0;
+	size_t j = 0;
+	clock_t start = 0;
+	ilrd_uid_t temp = {0};
+	ilrd_uid_t *uids = (ilrd_uid_t *)malloc(n * sizeof(ilrd_uid_t));
+	scheduler_t *sched = backend->create();
+	
+	if (NULL == uids || NULL == sched)
+	{
+		free(uids);
+		return;
+	}
+	
+	start = clock();
+	for (i = 0; i < n; ++i)
+	{
+		uids[i] = backend->add(sched, (1 + (size_t)rand() % MAX_INTERVAL) * SEC, 
+							   CountFunc, &fired, NULL, NULL);
+	}
+	result[0] = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / n;
+	
+	for (i = 0; i < cancels; ++i)
+	{
+		j = i + (size_t)rand() % (n - i);
+		temp = uids[i];
+		uids[i] = uids[j];
+		uids[j] = temp;
+	}
+	
+	start = clock();
+	for (i = 0; i < cancels; ++i)
+	{
+		backend->remove(sched, uids[i]);
+	}
+	result[1] = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / cancels;
+	
+	backend->destroy(sched);
+	
+	/* every task is due right away, so run only pays for firing */
+	sched = backend->create();
+	for (i = 0; i < n; ++i)
+	{
+		backend->add(sched, 0, CountFunc, &fired, NULL, NULL);
+	}
+	
+	start = clock();
+	backend->run(sched);
+	result[2] = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / n;
+	
+	if (n != fired)
+	{
+		printf("%s fired %lu of %lu tasks!\n", backend->name, 
+			   (unsigned long)fired, (unsigned long)n);
+	}
+	
+	backend->destroy(sched);
+	free(uids);
+}
+
+typedef struct latency_probe
+{
+	size_t due;
+	size_t fired;
+} latency_probe_t;
+
+static int ProbeFunc(void *probe)
+{
+	((latency_probe_t *)probe)->fired = TaskTimeNow();
+	
+	return SUCCESS;
+}
+
+static int CmpSize(const void *a, const void *b)
+{
+	size_t lhs = *(const size_t *)a;
+	size_t rhs = *(const size_t *)b;
+	
+	return ((lhs > rhs) - (lhs < rhs));
+}
+
+/* due is read just before the task reads it, lateness is over by that much */
+static void BenchLatency(backend_t *backend)
+{
+	latency_probe_t *probes = (latency_probe_t *)malloc(LATENCY_TASKS * 
+												sizeof(latency_probe_t));
+	size_t *lateness = (size_t *)malloc(LATENCY_TASKS * sizeof(size_t));
+	scheduler_t *sched = backend->create();
+	size_t interval = 0;
+	size_t early = 0;
+	size_t i = 0;
+	
+	if (NULL == probes || NULL == lateness || NULL == sched)
+	{
+		free(probes);
+		free(lateness);
+		return;
+	}
+	
+	for (i = 0; i < LATENCY_TASKS; ++i)
+	{
+		interval = (size_t)rand() % LATENCY_WINDOW;
+		probes[i].due = TaskTimeNow() + interval;
+		backend->add(sched, interval, ProbeFunc, &probes[i], NULL, NULL);
+	}
+	
+	backend->run(sched);
+	
+	for (i = 0; i < LATENCY_TASKS; ++i)
+	{
+		early += (probes[i].fired < probes[i].due);
+		lateness[i] = (probes[i].fired < probes[i].due) ? 0 : 
+										probes[i].fired - probes[i].due;
+	}
+	
+	qsort(lateness, LATENCY_TASKS, sizeof(size_t), CmpSize);
+	
+	printf("%-14s %10.1f %10.1f %10.1f %10.1f\n", backend->name, 
+		   lateness[LATENCY_TASKS / 2] / 1e3, 
+		   lateness[LATENCY_TASKS * 99 / 100] / 1e3, 
+		   lateness[LATENCY_TASKS * 999 / 1000] / 1e3, 
+		   lateness[LATENCY_TASKS - 1] / 1e3);
+	
+	if (0 != early)
+	{
+		printf("%s fired %lu tasks early!\n", backend->name, 
+													(unsigned long)early);
+	}
+	
+	backend->destroy(sched);
+	free(probes);
+	free(lateness);
+}
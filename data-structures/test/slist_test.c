@@ -20,8 +20,8 @@ int TestSlist()
 	slist_t *list = SListCreate();
     size_t count = 0;
      
-    SListInsert(SListBegin(list), &data);
-    SListInsert(SListEnd(list), &data2);
+    SListInsert(list, SListBegin(list), &data);
+    SListInsert(list, SListEnd(list), &data2);
 
     if(*(int *)SListGetData(SListBegin(list)) != 6)
     {
@@ -41,7 +41,7 @@ int TestSlist()
         return FAIL;
     }
 
-    SListRemove(SListBegin(list));
+    SListRemove(list, SListBegin(list));
 
     if((*(int *)SListGetData(SListBegin(list)) != 10))
     {
@@ -55,12 +55,12 @@ int TestSlist()
         return FAIL;
     }
     
-    SListInsert(SListBegin(list), &data);
-    SListInsert(SListEnd(list), &data2);
-    SListInsert(SListEnd(list), &data2);
-    SListInsert(SListEnd(list), &data2);
-    SListInsert(SListEnd(list), &data2);
-    SListInsert(SListEnd(list), &data2);
+    SListInsert(list, SListBegin(list), &data);
+    SListInsert(list, SListEnd(list), &data2);
+    SListInsert(list, SListEnd(list), &data2);
+    SListInsert(list, SListEnd(list), &data2);
+    SListInsert(list, SListEnd(list), &data2);
+    SListInsert(list, SListEnd(list), &data2);
 
     if(SListCount(list) != 7)
     {
@@ -84,7 +84,7 @@ int TestSlist()
     
     for (count = SListCount(list); count != 0; --count)
     {
-        SListRemove(SListBegin(list));
+        SListRemove(list, SListBegin(list));
     }
 
     if(!SListIsEmpty(list))
@@ -98,9 +98,105 @@ int TestSlist()
     return (PASS);
 }
 
+int TestAppend()
+{
+    int data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    slist_t *dest = SListCreate();
+    slist_t *src = SListCreate();
+    slist_t *list = NULL;
+    size_t i = 0;
+
+    for (i = 0; i < 8; ++i)
+    {
+        list = (i < 3) ? dest : src;
+        SListInsert(list, SListEnd(list), &data[i]);
+    }
+
+    SListAppend(dest, src);
+
+    if (SListCount(dest) != 8 || SListCount(src) != 0 || !SListIsEmpty(src))
+    {
+        printf("Append count : Fail");
+        return FAIL;
+    }
+
+    /* both lists keep counting after the nodes changed hands */
+    SListRemove(dest, SListBegin(dest));
+    SListInsert(src, SListEnd(src), &data[0]);
+    SListAppend(dest, src);
+
+    if (SListCount(dest) != 8 || SListCount(src) != 0)
+    {
+        printf("Append count after reuse : Fail");
+        return FAIL;
+    }
+
+    SListAppend(dest, src);
+
+    if (SListCount(dest) != 8)
+    {
+        printf("Append of empty list : Fail");
+        return FAIL;
+    }
+
+    SListDestroy(dest);
+    SListDestroy(src);
+
+    return (PASS);
+}
+
+int TestPoolAppend()
+{
+    int data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    pool_t *pool = SListCreatePool(4);
+    slist_t *dest = NULL;
+    slist_t *src = NULL;
+    slist_t *list = NULL;
+    size_t i = 0;
+
+    if (NULL == pool)
+    {
+        printf("Pool creation : Fail");
+        return FAIL;
+    }
+
+    dest = SListCreateWithPool(pool);
+    src = SListCreateWithPool(pool);
+
+    for (i = 0; i < 8; ++i)
+    {
+        list = (i < 3) ? dest : src;
+        SListInsert(list, SListEnd(list), &data[i]);
+    }
+
+    /* lists on the same pool can be appended to each other */
+    SListAppend(dest, src);
+
+    if (SListCount(dest) != 8 || !SListIsEmpty(src) ||
+        *(int *)SListGetData(SListBegin(dest)) != 0)
+    {
+        printf("Pooled append : Fail");
+        return FAIL;
+    }
+
+    SListDestroy(dest);
+    SListDestroy(src);
+
+    /* the destroyed lists gave their nodes back */
+    if (PoolCount(pool) != 0)
+    {
+        printf("Pooled destroy : Fail");
+        return FAIL;
+    }
+
+    PoolDestroy(pool);
+
+    return (PASS);
+}
+
 int main()
 {
-    if(!TestSlist())
+    if(!TestSlist() && !TestAppend() && !TestPoolAppend())
      printf("\n SList Test : %s", "Pass\n");
 
 	return 0;
@@ -0,0 +1,499 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+
+Build: make TARGET=srtlist && make TARGET=srtlist_skip AF=-ldl
+Run:   ./srtlist_skip.out                    (tests, then benchmark)
+       ./srtlist_skip.out bench [linear_max] (benchmark only)
+
+TestSrtList is the srtlist.c test as is, the skip list has to pass it
+unchanged. The benchmark loads both sorted lists with dlopen and grows
+each to millions of elements, the linked list only up to linear_max
+(O(n) per insert).
+*/
+
+#define _GNU_SOURCE /* RTLD_DEEPBIND */
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* rand */
+#include <string.h> /* strcmp */
+#include <time.h> /* clock */
+
+#include "bench_lib.h" /* BenchLibOpen */
+#include "srtlist_skip.h" /* srtlist */
+
+#define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
+#define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
+
+#define RANDOM_SIZE 20000
+#define LINEAR_MAX 20000
+#define FIND_OPS 100000
+
+typedef struct item
+{
+	int key;
+	int id; /* insertion order, equal keys must keep it */
+} item_t;
+
+typedef struct backend
+{
+	const char *name;
+	const char *lib;
+	size_t max_size;
+	void *handle;
+	srtlist_t *(*create)(cmp_func_t cmp_func);
+	void (*destroy)(srtlist_t *list);
+	srtlist_iter_t (*insert)(srtlist_t *list, void *data);
+	srtlist_iter_t (*begin)(const srtlist_t *list);
+	srtlist_iter_t (*end)(const srtlist_t *list);
+	srtlist_iter_t (*find)(srtlist_t *list, srtlist_iter_t from,
+										srtlist_iter_t to, void *data);
+} backend_t;
+
+static size_t tests_fails = 0;
+
+static void RunTest(const char* test, int result, int expected);
+static void IsAllPassed();
+static int CmpFunc(const void *data, const void *param);
+static int IsEven(const void *data, void *param);
+static void TestSrtList();
+static void TestRandom();
+static int CheckOrder(srtlist_t *list, size_t expected_count);
+static int CmpItems(const void *data, const void *param);
+static int BenchBackends(size_t linear_max);
+static int LoadBackend(backend_t *backend);
+static void BenchBackend(const backend_t *backend, item_t *items, size_t n,
+															double result[2]);
+
+int main(int argc, char *argv[])
+{
+	if (argc > 1 && 0 == strcmp(argv[1], "bench"))
+	{
+		return (BenchBackends(argc > 2 ? (size_t)atol(argv[2]) : LINEAR_MAX));
+	}
+
+	TestSrtList();
+	TestRandom();
+	IsAllPassed();
+
+	if (0 != tests_fails)
+	{
+		return (1);
+	}
+
+	return (BenchBackends(LINEAR_MAX));
+}
+
+static void RunTest(const char* test, int result, int expected)
+{
+	if (result != expected)
+	{	
+    	printf("%s: %s\n", test, FAIL);
+    	tests_fails = 1;
+	}
+}
+
+static void IsAllPassed()
+{	
+	if (!tests_fails)
+	{
+		printf("All Tests: %s\n" , PASS);
+	}
+}
+
+static void TestSrtList()
+{   
+  	int num1 = 5 , num2 = 10 , num3 = 3 , num4 = 12 , num11 = 4, num12 = 6,
+  	num5 = 7, num6 = 2, num7 = 11, num8 = 1, num9 = 13, num10 = 20;
+  	size_t i = 0;
+  	
+    srtlist_iter_t iter = {NULL};
+    srtlist_t *srtlist = SrtListCreate(CmpFunc);
+    srtlist_t *srtlist_src = SrtListCreate(CmpFunc);
+    int merge_result[] = {1,2,3,3,4,5,5,6,7,7,7,10,10,11,12,12,13,20};
+    
+    tests_fails = 0;
+    
+    printf("TestSrtList:\n");
+ 
+    iter = SrtListBegin(srtlist);
+    RunTest("Is Empty", SrtListIsEmpty(srtlist) , 1);
+    iter = SrtListInsert(srtlist, &num1);
+    SrtListRemove(iter);
+    iter = SrtListInsert(srtlist, &num1);
+    iter = SrtListInsert(srtlist, &num2);
+    RunTest("Is Empty After Insert", SrtListIsEmpty(srtlist) , 0);
+        
+    SrtListInsert(srtlist, &num3);
+    SrtListInsert(srtlist, &num4);
+    SrtListInsert(srtlist, &num5);
+    RunTest("Count", SrtListCount(srtlist) , 5);
+    
+    iter = SrtListBegin(srtlist);
+    RunTest("Insert 1", *(int *)SrtListGetData(iter), num3);
+    iter = SrtListNext(iter);
+    RunTest("Insert 2", *(int *)SrtListGetData(iter), num1);
+    iter = SrtListNext(iter);
+    RunTest("Insert 3", *(int *)SrtListGetData(iter), num5);
+    iter = SrtListNext(iter);
+    RunTest("Insert 4", *(int *)SrtListGetData(iter), num2);
+    iter = SrtListNext(iter);
+    RunTest("Insert 5", *(int *)SrtListGetData(iter), num4);
+    
+    iter = SrtListEnd(srtlist);
+    iter = SrtListPrev(SrtListPrev(iter));
+    SrtListRemove(iter);
+    iter = SrtListBegin(srtlist);
+    RunTest("Element 1", *(int *)SrtListGetData(iter), num3);
+    iter = SrtListNext(iter);
+    RunTest("Element 2", *(int *)SrtListGetData(iter), num1);
+    iter = SrtListNext(iter);
+    RunTest("Element 3", *(int *)SrtListGetData(iter), num5);
+    iter = SrtListNext(iter);
+    RunTest("Element 4", *(int *)SrtListGetData(iter), num4);
+    
+    iter = SrtListPrev(iter);
+    SrtListPopBack(srtlist);
+    RunTest("After Pop Back", *(int *)SrtListGetData(iter), num5);
+    SrtListPopFront(srtlist);
+    iter = SrtListBegin(srtlist);
+    RunTest("After Pop Front", *(int *)SrtListGetData(iter), num1);
+    
+    SrtListInsert(srtlist, &num3);
+    SrtListInsert(srtlist, &num2);
+    SrtListInsert(srtlist, &num4);
+    SrtListInsert(srtlist, &num5);
+    
+  	iter = SrtListFind(srtlist, SrtListBegin(srtlist), 
+  					      SrtListEnd(srtlist), &num4);
+  					          
+    RunTest("Find" , *(int *)SrtListGetData(iter) , num4);
+    
+    iter = SrtListFindIf(SrtListBegin(srtlist), SrtListEnd(srtlist), IsEven, 0);
+    
+    RunTest("FindIf" , *(int *)SrtListGetData(iter) , num2);
+    
+    SrtListInsert(srtlist_src, &num1);
+    SrtListInsert(srtlist_src, &num2);
+    SrtListInsert(srtlist_src, &num3);
+    SrtListInsert(srtlist_src, &num4);
+    SrtListInsert(srtlist_src, &num5);
+    SrtListInsert(srtlist_src, &num6);
+    SrtListInsert(srtlist_src, &num7);
+    SrtListInsert(srtlist_src, &num8);
+    SrtListInsert(srtlist_src, &num9);
+    SrtListInsert(srtlist_src, &num10);
+    SrtListInsert(srtlist_src, &num11);
+    SrtListInsert(srtlist_src, &num12);
+    
+    
+    SrtListMerge(srtlist, srtlist_src);
+    
+    RunTest("Merge Count Dest", SrtListCount(srtlist), 18);
+    RunTest("Merge Count Src", SrtListCount(srtlist_src), 0);
+    
+    iter = SrtListBegin(srtlist);
+    
+    for (i = 0; i < 18; ++i)
+    {
+    	RunTest("Merge", *(int *)SrtListGetData(iter), merge_result[i]);
+    	
+    	iter = SrtListNext(iter);
+    }
+    
+	SrtListDestroy(srtlist);
+	SrtListDestroy(srtlist_src);
+	
+}
+
+/* random keys with many repeats, checked against the srtlist.c rules */
+static void TestRandom()
+{
+	item_t *items = (item_t *)malloc(3 * RANDOM_SIZE * sizeof(item_t));
+	srtlist_t *list = SrtListCreate(CmpItems);
+	srtlist_t *src = SrtListCreate(CmpItems);
+	srtlist_t *srcs[2] = {NULL};
+	srtlist_iter_t iter;
+	srtlist_iter_t found;
+	item_t probe = {0, 0};
+	size_t count = RANDOM_SIZE;
+	size_t i = 0;
+
+	printf("TestRandom:\n");
+
+	if (NULL == items || NULL == list || NULL == src)
+	{
+		RunTest("Create", 0, 1);
+		free(items);
+		return;
+	}
+
+	for (i = 0; i < 2 * RANDOM_SIZE; ++i)
+	{
+		items[i].key = rand() % (RANDOM_SIZE / 4);
+		items[i].id = (int)i;
+		SrtListInsert(i < RANDOM_SIZE ? list : src, &items[i]);
+	}
+
+	RunTest("Insert Order", CheckOrder(list, RANDOM_SIZE), 0);
+
+	/* Find returns the first equal node of the range, 'to' otherwise */
+	for (i = 0; i < RANDOM_SIZE / 4; ++i)
+	{
+		probe.key = (int)i;
+		found = SrtListFind(list, SrtListBegin(list), SrtListEnd(list), &probe);
+		iter = SrtListBegin(list);
+		while (!SrtListIsIterSame(iter, SrtListEnd(list)) &&
+			   ((item_t *)SrtListGetData(iter))->key < (int)i)
+		{
+			iter = SrtListNext(iter);
+		}
+		if (SrtListIsIterSame(iter, SrtListEnd(list)) ||
+			((item_t *)SrtListGetData(iter))->key != (int)i)
+		{
+			iter = SrtListEnd(list);
+		}
+		RunTest("Find", SrtListIsIterSame(found, iter), 1);
+
+		/* a range that starts on the match or ends right before it */
+		if (!SrtListIsIterSame(iter, SrtListEnd(list)))
+		{
+			RunTest("Find From", SrtListIsIterSame(iter, SrtListFind(list,
+								iter, SrtListEnd(list), &probe)), 1);
+			RunTest("Find To", SrtListIsIterSame(iter, SrtListFind(list,
+								SrtListBegin(list), iter, &probe)), 1);
+		}
+	}
+
+	/* removes every third node, walking backwards */
+	iter = SrtListPrev(SrtListEnd(list));
+	for (i = 0; !SrtListIsIterSame(iter, SrtListBegin(list)); ++i)
+	{
+		iter = SrtListPrev(iter);
+		if (0 == i % 3)
+		{
+			SrtListRemove(SrtListNext(iter));
+			--count;
+		}
+	}
+
+	RunTest("Remove Order", CheckOrder(list, count), 0);
+
+	SrtListMerge(list, src);
+	RunTest("Merge Order", CheckOrder(list, count + RANDOM_SIZE), 0);
+	RunTest("Merge Src", SrtListIsEmpty(src), 1);
+
+	/* ties go dest, srcs[0], srcs[1] - the ids grow the same way */
+	srcs[0] = src;
+	srcs[1] = SrtListCreate(CmpItems);
+	for (i = 2 * RANDOM_SIZE; i < 3 * RANDOM_SIZE; ++i)
+	{
+		items[i].key = rand() % (RANDOM_SIZE / 4);
+		items[i].id = (int)i;
+		SrtListInsert(srcs[i < 5 * RANDOM_SIZE / 2 ? 0 : 1], &items[i]);
+	}
+	count += 2 * RANDOM_SIZE;
+
+	SrtListMergeMany(list, srcs, 2);
+	RunTest("Merge Many Order", CheckOrder(list, count), 0);
+	RunTest("Merge Many Src", SrtListIsEmpty(srcs[0]) &&
+							  SrtListIsEmpty(srcs[1]), 1);
+	SrtListDestroy(srcs[1]);
+
+	while (!SrtListIsEmpty(list))
+	{
+		SrtListPopFront(list);
+		if (!SrtListIsEmpty(list))
+		{
+			SrtListPopBack(list);
+		}
+	}
+	RunTest("Pop", SrtListCount(list), 0);
+	RunTest("Pop Order", CheckOrder(list, 0), 0);
+
+	SrtListDestroy(list);
+	SrtListDestroy(src);
+	free(items);
+}
+
+/* sorted by key, equal keys by insertion order, and the same backwards */
+static int CheckOrder(srtlist_t *list, size_t expected_count)
+{
+	srtlist_iter_t iter = SrtListBegin(list);
+	const item_t *prev = NULL;
+	const item_t *curr = NULL;
+	size_t count = 0;
+
+	for (; !SrtListIsIterSame(iter, SrtListEnd(list));
+												iter = SrtListNext(iter))
+	{
+		curr = (const item_t *)SrtListGetData(iter);
+		if (NULL != prev && (prev->key > curr->key ||
+			(prev->key == curr->key && prev->id > curr->id)))
+		{
+			return (1);
+		}
+		prev = curr;
+		++count;
+	}
+
+	for (iter = SrtListEnd(list); !SrtListIsIterSame(iter,
+										SrtListBegin(list)); --count)
+	{
+		iter = SrtListPrev(iter);
+	}
+
+	return (expected_count != SrtListCount(list) || 0 != count ||
+			 SrtListCount(list) != expected_count);
+}
+
+/******************** BENCHMARK ********************/
+static int LoadBackend(backend_t *backend)
+{
+	void *lib = BenchLibOpen(backend->lib);
+
+	if (NULL == lib ||
+		0 != BenchLibSym(lib, "SrtListCreate", (void **)&backend->create) ||
+		0 != BenchLibSym(lib, "SrtListDestroy", (void **)&backend->destroy) ||
+		0 != BenchLibSym(lib, "SrtListInsert", (void **)&backend->insert) ||
+		0 != BenchLibSym(lib, "SrtListBegin", (void **)&backend->begin) ||
+		0 != BenchLibSym(lib, "SrtListEnd", (void **)&backend->end) ||
+		0 != BenchLibSym(lib, "SrtListFind", (void **)&backend->find))
+	{
+		if (NULL != lib)
+		{
+			printf("%s is incomplete, skipped\n", backend->lib);
+		}
+		BenchLibClose(lib);
+		return (1);
+	}
+
+	backend->handle = lib;
+
+	return (0);
+}
+
+static int BenchBackends(size_t linear_max)
+{
+	backend_t backends[] =
+	{
+		{"linked list", "./libsrtlist.so", 0, NULL, NULL, NULL, NULL, NULL,
+																NULL, NULL},
+		{"skip list", "./libsrtlist_skip.so", (size_t)-1, NULL, NULL, NULL,
+														NULL, NULL, NULL, NULL}
+	};
+	size_t num_backends = sizeof(backends) / sizeof(backends[0]);
+	size_t sizes[] = {1000, 10000, 100000, 1000000, 4000000};
+	size_t max_size = sizes[sizeof(sizes) / sizeof(sizes[0]) - 1];
+	item_t *items = (item_t *)malloc(max_size * sizeof(item_t));
+	double result[2] = {0};
+	size_t s = 0;
+	size_t b = 0;
+
+	if (NULL == items)
+	{
+		return (1);
+	}
+
+	backends[0].max_size = linear_max;
+
+	for (b = 0; b < num_backends; ++b)
+	{
+		LoadBackend(&backends[b]);
+	}
+
+	printf("\nsorted list, ns per operation (insert: random keys while the");
+	printf(" list grows\nfrom empty, find: %d random keys once it is full)\n",
+																	FIND_OPS);
+	printf("%-9s %-12s %12s %12s\n", "elements", "list", "insert", "find");
+
+	for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+	{
+		for (b = 0; b < num_backends; ++b)
+		{
+			if (NULL == backends[b].handle)
+			{
+				continue;
+			}
+
+			if (sizes[s] > backends[b].max_size)
+			{
+				printf("%-9lu %-12s %12s %12s\n", (unsigned long)sizes[s],
+										backends[b].name, "skipped", "-");
+				continue;
+			}
+
+			srand(1);
+			BenchBackend(&backends[b], items, sizes[s], result);
+			printf("%-9lu %-12s %12.1f %12.1f\n", (unsigned long)sizes[s],
+								backends[b].name, result[0], result[1]);
+		}
+	}
+
+	for (b = 0; b < num_backends; ++b)
+	{
+		BenchLibClose(backends[b].handle);
+	}
+
+	free(items);
+
+	return (0);
+}
+
+static void BenchBackend(const backend_t *backend, item_t *items, size_t n,
+															double result[2])
+{
+	srtlist_t *list = backend->create(CmpItems);
+	size_t finds = (n < FIND_OPS) ? n : FIND_OPS;
+	clock_t start = 0;
+	size_t i = 0;
+
+	if (NULL == list)
+	{
+		return;
+	}
+
+	for (i = 0; i < n; ++i)
+	{
+		items[i].key = rand();
+		items[i].id = 0;
+	}
+
+	start = clock();
+	for (i = 0; i < n; ++i)
+	{
+		backend->insert(list, &items[i]);
+	}
+	result[0] = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / n;
+
+	start = clock();
+	for (i = 0; i < finds; ++i)
+	{
+		backend->find(list, backend->begin(list), backend->end(list),
+											&items[(size_t)rand() % n]);
+	}
+	result[1] = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / finds;
+
+	backend->destroy(list);
+}
+
+/******************** HELPER FUNCTIONS ********************/
+static int CmpFunc(const void *data, const void *param)
+{
+    return (*(int *)data - *(int *)param);
+}
+
+static int IsEven(const void *data, void *param)
+{
+	(void)param;
+    return (*(int *)data % 2 == 0);
+}
+
+/* by key only, the id just records the order the items came in */
+static int CmpItems(const void *data, const void *param)
+{
+	int lhs = ((const item_t *)data)->key;
+	int rhs = ((const item_t *)param)->key;
+
+	return ((lhs > rhs) - (lhs < rhs));
+}
@@ -4,13 +4,26 @@ Date: Feb 22, 2024
 */
 
 #include <stdio.h> /* printf */
+#include <stdlib.h> /* rand */
 #include <string.h> /* strcmp */
+#include <time.h> /* clock */
  
 #include "srtlist.h" /* srtlist */
 
 #define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
 #define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
 
+#define SHARDS 16
+#define SHARD_SIZE 4000
+#define BENCH_SHARDS 64
+#define BENCH_SHARD_SIZE 4000
+
+typedef struct item
+{
+	int key;
+	int id; /* shard and insertion order, equal keys must keep it */
+} item_t;
+
 static size_t tests_fails = 0;
 
 static void RunTest(const char* test, int result, int expected);
@@ -18,10 +31,18 @@ static void IsAllPassed();
 static int CmpFunc(const void *data, const void *param);
 static int IsEven(const void *data, void *param);
 static void TestSrtList();
+static void TestMergeMany();
+static void BenchMerge();
+static void FillShards(srtlist_t **shards, item_t *items, size_t num_shards,
+															size_t shard_size);
+static int CheckOrder(srtlist_t *list, size_t expected_count);
+static int CmpItems(const void *data, const void *param);
 
 int main()
 {
 	TestSrtList();
+	TestMergeMany();
+	BenchMerge();
 	return (0);
 }
 
@@ -130,6 +151,9 @@ static void TestSrtList()
     
     SrtListMerge(srtlist, srtlist_src);
     
+    RunTest("Merge Count Dest", SrtListCount(srtlist), 18);
+    RunTest("Merge Count Src", SrtListCount(srtlist_src), 0);
+    
     iter = SrtListBegin(srtlist);
     
     for (i = 0; i < 18; ++i)
@@ -145,6 +169,166 @@ static void TestSrtList()
 	IsAllPassed();
 }
 
+/* shard 0 is the destination, the rest merge into it */
+static void TestMergeMany()
+{
+	item_t *items = (item_t *)malloc(SHARDS * SHARD_SIZE * sizeof(item_t));
+	srtlist_t *shards[SHARDS] = {NULL};
+	srtlist_t *other = SrtListCreate(CmpItems);
+	size_t i = 0;
+	
+	tests_fails = 0;
+	
+	printf("TestMergeMany:\n");
+	
+	if (NULL == items)
+	{
+		RunTest("Alloc", 0, 1);
+		return;
+	}
+	
+	for (i = 0; i < SHARDS; ++i)
+	{
+		shards[i] = SrtListCreate(CmpItems);
+	}
+	
+	FillShards(shards, items, SHARDS, SHARD_SIZE);
+	
+	/* ties between two lists, dest first */
+	SrtListMerge(shards[0], shards[1]);
+	RunTest("Merge Order", CheckOrder(shards[0], 2 * SHARD_SIZE), 0);
+	
+	/* an empty src on the way, and merging none at all */
+	while (!SrtListIsEmpty(shards[SHARDS / 2]))
+	{
+		SrtListPopFront(shards[SHARDS / 2]);
+	}
+	SrtListMergeMany(shards[0], shards + 2, SHARDS - 2);
+	SrtListMergeMany(shards[0], shards + 1, 0);
+	
+	RunTest("Merge Many Order", CheckOrder(shards[0], 
+									(SHARDS - 1) * SHARD_SIZE), 0);
+	for (i = 1; i < SHARDS; ++i)
+	{
+		RunTest("Merge Many Src", SrtListIsEmpty(shards[i]), 1);
+	}
+	
+	/* into an empty list */
+	SrtListMerge(other, shards[0]);
+	RunTest("Merge Into Empty", CheckOrder(other, 
+									(SHARDS - 1) * SHARD_SIZE), 0);
+	RunTest("Merge Src Empty", SrtListIsEmpty(shards[0]), 1);
+	
+	for (i = 0; i < SHARDS; ++i)
+	{
+		SrtListDestroy(shards[i]);
+	}
+	SrtListDestroy(other);
+	free(items);
+	
+	IsAllPassed();
+}
+
+/* k sorted shards, the way they come in every second - merged one at */
+/* a time into the first, and all at once                             */
+static void BenchMerge()
+{
+	item_t *items = (item_t *)malloc(BENCH_SHARDS * BENCH_SHARD_SIZE * 
+															sizeof(item_t));
+	srtlist_t *shards[BENCH_SHARDS] = {NULL};
+	double result[2] = {0};
+	clock_t start = 0;
+	size_t round = 0;
+	size_t i = 0;
+	
+	if (NULL == items)
+	{
+		return;
+	}
+	
+	for (round = 0; round < 2; ++round)
+	{
+		for (i = 0; i < BENCH_SHARDS; ++i)
+		{
+			shards[i] = SrtListCreate(CmpItems);
+		}
+		
+		srand(1);
+		FillShards(shards, items, BENCH_SHARDS, BENCH_SHARD_SIZE);
+		
+		start = clock();
+		if (0 == round)
+		{
+			for (i = 1; i < BENCH_SHARDS; ++i)
+			{
+				SrtListMerge(shards[0], shards[i]);
+			}
+		}
+		else
+		{
+			SrtListMergeMany(shards[0], shards + 1, BENCH_SHARDS - 1);
+		}
+		result[round] = (double)(clock() - start) / CLOCKS_PER_SEC * 1e3;
+		
+		for (i = 0; i < BENCH_SHARDS; ++i)
+		{
+			SrtListDestroy(shards[i]);
+		}
+	}
+	
+	printf("merge of %d shards of %d, ms: one by one %.2f, all at once "
+		   "%.2f\n", BENCH_SHARDS, BENCH_SHARD_SIZE, result[0], result[1]);
+	
+	free(items);
+}
+
+/* keys go down by 0 to 2, so each insert lands at the head and about a */
+/* third of them repeat. the id orders equal keys across the shards     */
+static void FillShards(srtlist_t **shards, item_t *items, size_t num_shards,
+															size_t shard_size)
+{
+	item_t *item = items;
+	int key = 0;
+	size_t s = 0;
+	size_t i = 0;
+	
+	for (s = 0; s < num_shards; ++s)
+	{
+		key = rand() % (int)shard_size + (int)shard_size;
+		for (i = 0; i < shard_size; ++i, ++item)
+		{
+			key -= rand() % 3;
+			item->key = key;
+			item->id = (int)(s * shard_size + i);
+			SrtListInsert(shards[s], item);
+		}
+	}
+}
+
+/* sorted by key, equal keys by id, and the count agrees */
+static int CheckOrder(srtlist_t *list, size_t expected_count)
+{
+	srtlist_iter_t iter = SrtListBegin(list);
+	const item_t *prev = NULL;
+	const item_t *curr = NULL;
+	size_t count = 0;
+	
+	for (; !SrtListIsIterSame(iter, SrtListEnd(list)); 
+												iter = SrtListNext(iter))
+	{
+		curr = (const item_t *)SrtListGetData(iter);
+		if (NULL != prev && (prev->key > curr->key || 
+			(prev->key == curr->key && prev->id > curr->id)))
+		{
+			return (1);
+		}
+		prev = curr;
+		++count;
+	}
+	
+	return (expected_count != count || SrtListCount(list) != count);
+}
+
 static int CmpFunc(const void *data, const void *param)
 {
     return (*(int *)data - *(int *)param);
@@ -156,3 +340,11 @@ static int IsEven(const void *data, void *param)
     return (*(int *)data % 2 == 0);
 }
 
+/* by key only, the id just records the order the items came in */
+static int CmpItems(const void *data, const void *param)
+{
+	int lhs = ((const item_t *)data)->key;
+	int rhs = ((const item_t *)param)->key;
+	
+	return ((lhs > rhs) - (lhs < rhs));
+}
@@ -9,6 +9,10 @@ Date: Feb 7, 2024
 #include <stdio.h> /* printf */
 #include "stack.h"
 
+#define SMALL_PUSHES 100
+
+static void TestSmall(void);
+
 /******************** TESTS ********************/
 
 int main()
@@ -44,5 +48,44 @@ int main()
 	printf("Is Empty: %d\n", StackIsEmpty(stack));
 	StackDestroy(stack);
 	
+	TestSmall();
+	
 	return 0;
 }
+
+static void TestSmall(void)
+{
+	stack_t *stack = StackCreateSmall(4, sizeof(int));
+	int values[SMALL_PUSHES];
+	int ok = 1;
+	int i = 0;
+	
+	printf("\nCreated small stack of 4 inline int elements.\n");
+	
+	for (i = 0; i < 4; ++i)
+	{
+		values[i] = i;
+		StackPush(stack, &values[i]);
+	}
+	printf("Inline while 4 fit: capacity 4: %s\n", 
+	(4 == StackCapacity(stack)) ? PASS : FAIL);
+	
+	for (i = 4; i < SMALL_PUSHES; ++i)
+	{
+		values[i] = i;
+		StackPush(stack, &values[i]);
+	}
+	printf("Spills when full: size %d: %s\n", SMALL_PUSHES, 
+	(SMALL_PUSHES == StackSize(stack) && 
+	 SMALL_PUSHES <= StackCapacity(stack)) ? PASS : FAIL);
+	
+	for (i = SMALL_PUSHES - 1; i >= 0; --i)
+	{
+		ok &= (*(int *)StackPeek(stack) == i);
+		StackPop(stack);
+	}
+	printf("Peek and Pop across the spill: %s\n", 
+	(ok && StackIsEmpty(stack)) ? PASS : FAIL);
+	
+	StackDestroy(stack);
+}
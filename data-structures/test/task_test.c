@@ -6,11 +6,14 @@ Date: Mar 3, 2024
 #include "task.h" /* task_t */
 
 #include <stdio.h> /* printf */
-#include <time.h> /* sleep */
+#include <unistd.h> /* sleep */
 
 #define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
 #define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
 
+#define SEC (1000000000UL) /* nanoseconds */
+#define TOLERANCE (10000000UL) /* 10 ms between computing a time and checking it */
+
 enum STATUS
 {
 	FAILED = -1,
@@ -19,6 +22,7 @@ enum STATUS
 
 static int TestFlow1();
 static int TestFlow2();
+static int IsAbout(size_t expected, size_t actual);
 
 static int ActionFunc(void *param);
 static void CleanFunc(void *param);
@@ -45,7 +49,7 @@ int main()
 static int TestFlow1()
 {
     task_t *tasks_arr[3];
-    size_t tasks_interval[3] = {1,5,7};
+    size_t tasks_interval[3] = {1 * SEC, 5 * SEC, 7 * SEC};
     char *action_params[3] = {"first", "seconds", "third"};
     size_t i = 0, size = sizeof(tasks_arr) / sizeof(tasks_arr[0]); 
 
@@ -73,14 +77,14 @@ static int TestFlow1()
 		return FAILED;
 	}
 
-    if (time(NULL) + 7 != (long int)TaskGetTimeToRun(tasks_arr[2]))
+    if (!IsAbout(TaskTimeNow() + 7 * SEC, TaskGetTimeToRun(tasks_arr[2])))
 	{
 		printf("TaskGetTimeToRun:%s\n",FAIL);
 		return FAILED;
 	}
     sleep(3);
     TaskUpdateTimeToRun(tasks_arr[1]);
-    if (time(NULL) + 5 != (long int)TaskGetTimeToRun(tasks_arr[1]))
+    if (!IsAbout(TaskTimeNow() + 5 * SEC, TaskGetTimeToRun(tasks_arr[1])))
 	{
 		printf("TaskUpdateTimeToRun:%s\n",FAIL);
 		return FAILED;
@@ -99,6 +103,12 @@ static int TestFlow2()
     return SUCCEEDED;
 }
 
+/* actual was computed a moment before expected, from the same clock */
+static int IsAbout(size_t expected, size_t actual)
+{
+    return (actual <= expected && expected - actual < TOLERANCE);
+}
+
 static int ActionFunc(void *param)
 {
     printf("%s\n", (char *)param);
@@ -0,0 +1,108 @@
+/*
+Owner: Uri Naor
+Date: Oct 17, 2026
+*/
+
+#include <stdio.h> /* printf */
+
+#include "uid_map.h" /* uid_map_t */
+
+#define PASS "\033[1;32mPASS\033[0m" /* green bold PASS string */
+#define FAIL "\033[1;31mFAIL\033[0m" /* red bold FAIL string */
+
+#define TEST_UIDS 1000 /* enough to make the map grow a few times */
+
+/******************** FORWARD DECLARATIONS ********************/
+static int TestFlow(void);
+
+/******************** TEST FUNCTIONS ********************/
+static int TestFlow(void)
+{
+    static ilrd_uid_t uids[TEST_UIDS];
+    static int values[TEST_UIDS];
+    uid_map_t *map = UIDMapCreate();
+    size_t i = 0;
+
+    if (NULL == map)
+    {
+        return (1);
+    }
+
+    for (i = 0; i < TEST_UIDS; ++i)
+    {
+        uids[i] = UIDGenerate();
+        values[i] = (int)i;
+        if (0 != UIDMapInsert(map, uids[i], &values[i]))
+        {
+            UIDMapDestroy(map);
+            return (2);
+        }
+    }
+
+    if (TEST_UIDS != UIDMapSize(map))
+    {
+        UIDMapDestroy(map);
+        return (3);
+    }
+
+    for (i = 0; i < TEST_UIDS; ++i)
+    {
+        if (&values[i] != UIDMapFind(map, uids[i]))
+        {
+            UIDMapDestroy(map);
+            return (4);
+        }
+    }
+
+    if (NULL != UIDMapFind(map, bad_uid) || NULL != UIDMapRemove(map, bad_uid))
+    {
+        UIDMapDestroy(map);
+        return (5);
+    }
+
+    /* every other uid goes, the rest must still be found */
+    for (i = 0; i < TEST_UIDS; i += 2)
+    {
+        if (&values[i] != UIDMapRemove(map, uids[i]))
+        {
+            UIDMapDestroy(map);
+            return (6);
+        }
+    }
+
+    if (TEST_UIDS / 2 != UIDMapSize(map))
+    {
+        UIDMapDestroy(map);
+        return (7);
+    }
+
+    for (i = 0; i < TEST_UIDS; ++i)
+    {
+        if ((0 == i % 2 ? NULL : &values[i]) != UIDMapFind(map, uids[i]))
+        {
+            UIDMapDestroy(map);
+            return (8);
+        }
+    }
+
+    UIDMapDestroy(map);
+
+    return (0);
+}
+
+/******************** MAIN ********************/
+int main(void)
+{
+    int test_status = TestFlow();
+
+    if (0 == test_status)
+    {
+        printf("UID MAP| ALL TESTS: %s\n", PASS);
+    }
+    else
+    {
+        printf("UID MAP| %s AT %d\n", FAIL, test_status);
+    }
+
+    return (test_status);
+}